@@ -0,0 +1,314 @@
+/**
+ * @file analysis/batch_runner.cpp
+ * @brief Monte Carlo batch runner with fixed-memory streaming statistics
+ */
+
+#include "batch_runner.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "battle/commands/damage.hpp"
+#include "battle/events.hpp"
+#include "battle/move_data.hpp"
+#include "battle/random.hpp"
+#include "kernels/dispatch.hpp"
+
+namespace analysis {
+
+namespace {
+
+/**
+ * @brief Event sink state: attributes HP loss to the move that caused it
+ */
+struct HitCollector {
+    stats::QuantileSketch* damage;
+    int8_t mover;  // Battler whose move is being reported (-1 = none)
+};
+
+void CollectHit(void* user, const battle::BattleEvent& event) {
+    HitCollector* collector = static_cast<HitCollector*>(user);
+    switch (event.type) {
+        case battle::EventType::MoveUsed:
+            collector->mover = static_cast<int8_t>(event.battler);
+            break;
+        case battle::EventType::TurnStart:
+        case battle::EventType::EndOfTurn:
+            collector->mover = -1;
+            break;
+        case battle::EventType::HpChanged:
+            if (collector->mover >= 0 && event.battler != collector->mover &&
+                event.value < event.extra) {
+                collector->damage->Add(event.extra - event.value);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief xorshift64 step (policy sampling, kept off the battle RNG stream)
+ */
+uint64_t NextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+battle::BattleAction SampleAction(const battle::BattleEngine& engine, battle::Player side,
+                                  Policy policy, uint64_t& rng) {
+    PolicyChoice choices[MAX_POLICY_CHOICES];
+    uint8_t count = policy(engine, side, choices);
+    double roll = static_cast<double>(NextRandom(rng) >> 11) * (1.0 / 9007199254740992.0);
+    for (uint8_t i = 0; i + 1 < count; i++) {
+        if (roll < choices[i].probability) {
+            return choices[i].action;
+        }
+        roll -= choices[i].probability;
+    }
+    return choices[count - 1].action;
+}
+
+/**
+ * @brief One shard's buffers for the batched kernel calls (sized once per shard)
+ */
+struct KernelScratch {
+    explicit KernelScratch(size_t group)
+        : terms(group),
+          scores(group),
+          choices(group * MAX_POLICY_CHOICES),
+          choice_count(group),
+          power(group * MAX_POLICY_CHOICES),
+          attack(group * MAX_POLICY_CHOICES),
+          defense(group * MAX_POLICY_CHOICES),
+          weather_modifier(group * MAX_POLICY_CHOICES),
+          damage(group * MAX_POLICY_CHOICES) {}
+
+    std::vector<battle::evaluation::Terms> terms;
+    std::vector<int16_t> scores;
+    std::vector<PolicyChoice> choices;  // MAX_POLICY_CHOICES per battle
+    std::vector<uint8_t> choice_count;
+    std::vector<uint8_t> power;  // Damage kernel inputs, one entry per offered choice
+    std::vector<uint16_t> attack;
+    std::vector<uint16_t> defense;
+    std::vector<uint8_t> weather_modifier;
+    std::vector<uint16_t> damage;
+};
+
+/**
+ * @brief Pick one side's highest-damage choice in every live battle of a group
+ *
+ * The choices of all battles are scored by a single damage kernel call.
+ */
+void ChooseGreedy(const std::vector<battle::BattleEngine>& engines,
+                  const std::vector<bool>& finished, size_t n, battle::Player side, Policy policy,
+                  KernelScratch& scratch, battle::BattleAction* actions) {
+    uint8_t battler = static_cast<uint8_t>(side);
+    size_t entries = 0;
+    for (size_t i = 0; i < n; i++) {
+        scratch.choice_count[i] = 0;
+        if (finished[i]) {
+            continue;
+        }
+        const battle::state::BattleState& state = engines[i].GetState();
+        const battle::state::Pokemon& user = state.battlers[battler];
+        const battle::state::Pokemon& target = state.battlers[battle::state::Opponent(battler)];
+        int attack = battle::commands::GetModifiedStat(user, domain::STAT_ATK);
+        int defense = battle::commands::GetModifiedStat(target, domain::STAT_DEF);
+        if (state.item_hooks & battle::items::HOOK_DAMAGE) {
+            attack = battle::items::ModifyAttack(user, attack);
+        }
+
+        PolicyChoice* choices = &scratch.choices[i * MAX_POLICY_CHOICES];
+        uint8_t count = policy(engines[i], side, choices);
+        scratch.choice_count[i] = count;
+        for (uint8_t c = 0; c < count; c++) {
+            const domain::MoveData& move = battle::GetMoveData(choices[c].action.move);
+            scratch.power[entries] = move.power;
+            scratch.attack[entries] = static_cast<uint16_t>(attack);
+            scratch.defense[entries] = static_cast<uint16_t>(defense > 0 ? defense : 1);
+            scratch.weather_modifier[entries] =
+                battle::weather::DamageModifier(state.field.weather, move.type);
+            entries++;
+        }
+    }
+
+    kernels::DamageInputs inputs = {scratch.power.data(), scratch.attack.data(),
+                                    scratch.defense.data(), scratch.weather_modifier.data()};
+    kernels::Active().base_damage(inputs, scratch.damage.data(), entries);
+
+    size_t entry = 0;
+    for (size_t i = 0; i < n; i++) {
+        const PolicyChoice* choices = &scratch.choices[i * MAX_POLICY_CHOICES];
+        uint8_t best = 0;
+        uint16_t best_damage = 0;
+        for (uint8_t c = 0; c < scratch.choice_count[i]; c++, entry++) {
+            uint16_t damage = scratch.power[entry] == 0 ? 0 : scratch.damage[entry];
+            if (damage > best_damage) {
+                best = c;
+                best_damage = damage;
+            }
+        }
+        if (scratch.choice_count[i] > 0) {
+            actions[2 * i + battler] = choices[best].action;
+        }
+    }
+}
+
+void RecordFinish(const battle::BattleEngine& engine, BatchReport& report) {
+    const battle::state::Pokemon& player = engine.GetPlayer();
+    const battle::state::Pokemon& enemy = engine.GetEnemy();
+    report.turns_to_finish.Add(engine.GetState().scheduler.turn);
+    if (player.is_fainted && enemy.is_fainted) {
+        report.draws++;
+    } else if (enemy.is_fainted) {
+        report.player_wins++;
+        report.remaining_hp.Add(player.current_hp);
+    } else {
+        report.enemy_wins++;
+        report.remaining_hp.Add(enemy.current_hp);
+    }
+}
+
+/**
+ * @brief Play one shard's battles on the calling thread
+ */
+void RunShard(const battle::BattleEngine& start, Policy player_policy, Policy enemy_policy,
+              const BatchOptions& options, uint64_t battles, uint32_t seed, BatchReport* report) {
+    battle::random::Initialize(seed == 0 ? 1 : seed);
+    uint64_t policy_rng = 0x9e3779b97f4a7c15ULL ^ seed;
+
+    size_t group = options.batch_size == 0 ? 1 : options.batch_size;
+    std::vector<battle::BattleEngine> engines(group);
+    std::vector<battle::BattleAction> actions(2 * group);
+    std::vector<bool> finished(group);
+    KernelScratch scratch(group);
+    HitCollector collector = {&report->damage_per_hit, -1};
+
+    while (battles > 0) {
+        size_t n = battles < group ? static_cast<size_t>(battles) : group;
+        battles -= n;
+        for (size_t i = 0; i < n; i++) {
+            engines[i] = start;
+            engines[i].SetEventSink(CollectHit, &collector);
+            finished[i] = false;
+        }
+
+        size_t active = n;
+        for (uint16_t turn = 0; turn < options.max_turns && active > 0; turn++) {
+            for (size_t i = 0; i < n; i++) {
+                if (finished[i]) {
+                    continue;
+                }
+                if (!options.greedy_player) {
+                    actions[2 * i] = SampleAction(engines[i], battle::Player::PLAYER,
+                                                  player_policy, policy_rng);
+                }
+                if (!options.greedy_enemy) {
+                    actions[2 * i + 1] =
+                        SampleAction(engines[i], battle::Player::ENEMY, enemy_policy, policy_rng);
+                }
+            }
+            if (options.greedy_player) {
+                ChooseGreedy(engines, finished, n, battle::Player::PLAYER, player_policy, scratch,
+                             actions.data());
+            }
+            if (options.greedy_enemy) {
+                ChooseGreedy(engines, finished, n, battle::Player::ENEMY, enemy_policy, scratch,
+                             actions.data());
+            }
+
+            battle::BattleEngine::StepMany(engines.data(), actions.data(), n);
+
+            // Score every battle that played this turn with one kernel call
+            size_t played = 0;
+            for (size_t i = 0; i < n; i++) {
+                if (!finished[i]) {
+                    scratch.terms[played++] = engines[i].GetEvaluation();
+                }
+            }
+            kernels::Active().score(scratch.terms.data(), scratch.scores.data(), played);
+            for (size_t k = 0; k < played; k++) {
+                report->position_score.Add(scratch.scores[k]);
+            }
+
+            for (size_t i = 0; i < n; i++) {
+                if (finished[i]) {
+                    continue;
+                }
+                report->distinct_states.Add(engines[i].HashState());
+                if (engines[i].IsBattleOver()) {
+                    finished[i] = true;
+                    active--;
+                    RecordFinish(engines[i], *report);
+                }
+            }
+        }
+
+        report->battles += n;
+        report->unfinished += active;
+    }
+}
+
+}  // namespace
+
+BatchReport::BatchReport(const BatchOptions& options)
+    : battles(0),
+      player_wins(0),
+      enemy_wins(0),
+      draws(0),
+      unfinished(0),
+      turns_to_finish(options.sketch_k),
+      damage_per_hit(options.sketch_k),
+      remaining_hp(options.sketch_k),
+      position_score(options.sketch_k),
+      distinct_states(options.hll_precision) {}
+
+void BatchReport::Merge(const BatchReport& other) {
+    battles += other.battles;
+    player_wins += other.player_wins;
+    enemy_wins += other.enemy_wins;
+    draws += other.draws;
+    unfinished += other.unfinished;
+    turns_to_finish.Merge(other.turns_to_finish);
+    damage_per_hit.Merge(other.damage_per_hit);
+    remaining_hp.Merge(other.remaining_hp);
+    position_score.Merge(other.position_score);
+    distinct_states.Merge(other.distinct_states);
+}
+
+BatchReport RunBatch(const battle::BattleEngine& start, Policy player_policy, Policy enemy_policy,
+                     const BatchOptions& options) {
+    uint32_t threads = options.threads == 0 ? 1 : options.threads;
+    std::vector<BatchReport> shards(threads, BatchReport(options));
+
+    uint64_t per_shard = options.battles / threads;
+    uint64_t remainder = options.battles % threads;
+    auto shard_battles = [&](uint32_t s) { return per_shard + (s < remainder ? 1 : 0); };
+
+    if (threads == 1) {
+        RunShard(start, player_policy, enemy_policy, options, options.battles, options.seed,
+                 &shards[0]);
+    } else {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (uint32_t s = 0; s < threads; s++) {
+            workers.emplace_back(RunShard, std::cref(start), player_policy, enemy_policy,
+                                 std::cref(options), shard_battles(s), options.seed + s,
+                                 &shards[s]);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    BatchReport report(options);
+    for (const BatchReport& shard : shards) {
+        report.Merge(shard);
+    }
+    return report;
+}
+
+}  // namespace analysis
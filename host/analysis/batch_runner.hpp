@@ -0,0 +1,89 @@
+/**
+ * @file analysis/batch_runner.hpp
+ * @brief Monte Carlo batch runner with fixed-memory streaming statistics (host only)
+ *
+ * Plays many battles of one matchup under a pair of policies and summarizes
+ * them without keeping per-battle results:
+ * - Battles are split into one shard per thread; each shard steps groups of
+ *   batch_size battles with BattleEngine::StepMany on its own RNG stream
+ * - Each shard fills its own report (quantile sketches and a distinct-state
+ *   counter), so the hot loop never shares or locks anything
+ * - Shard reports are merged once all threads finish
+ * - Per-group work outside the engine goes through the dispatched kernels:
+ *   position scores of every live battle after each turn (score kernel) and,
+ *   for greedy sides, the base damage of every offered move (damage kernel)
+ *
+ * Memory is fixed by the options (sketch size, counter precision, batch size),
+ * whatever the number of battles.
+ *
+ * Host only: uses std::thread and the standard library containers.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "battle/engine.hpp"
+#include "propagation.hpp"
+#include "stats/distinct_counter.hpp"
+#include "stats/quantile_sketch.hpp"
+
+namespace analysis {
+
+/**
+ * @brief Batch run configuration
+ */
+struct BatchOptions {
+    uint64_t battles = 1000;     // Battles to play
+    uint32_t threads = 1;        // Shards run in parallel (at least 1)
+    uint32_t seed = 1;           // Shard s uses seed + s (0 is treated as 1)
+    uint16_t max_turns = 200;    // Battles still going after this are unfinished
+    uint16_t batch_size = 64;    // Battles stepped together per StepMany call
+    uint16_t sketch_k = 200;     // Quantile sketch accuracy (see QuantileSketch)
+    uint8_t hll_precision = 12;  // Distinct counter precision (see DistinctCounter)
+    bool greedy_player = false;  // Player takes its highest-damage choice instead of sampling
+    bool greedy_enemy = false;   // Same for the enemy
+};
+
+/**
+ * @brief Merged statistics of a batch run
+ */
+struct BatchReport {
+    explicit BatchReport(const BatchOptions& options = BatchOptions());
+
+    uint64_t battles;      // Battles played
+    uint64_t player_wins;  // Enemy fainted, player did not
+    uint64_t enemy_wins;   // Player fainted, enemy did not
+    uint64_t draws;        // Both fainted on the same turn
+    uint64_t unfinished;   // Still going at max_turns
+
+    stats::QuantileSketch turns_to_finish;   // Turn count of finished battles
+    stats::QuantileSketch damage_per_hit;    // HP a move took from its target (multi-hit: total)
+    stats::QuantileSketch remaining_hp;      // Winner's HP when the battle ended
+    stats::QuantileSketch position_score;    // evaluation::Score after each turn (player's view)
+    stats::DistinctCounter distinct_states;  // Distinct post-turn states seen
+
+    /**
+     * @brief Fold another shard's report into this one
+     */
+    void Merge(const BatchReport& other);
+};
+
+/**
+ * @brief Play a batch of battles from one starting state
+ * @param start Initial state (after InitBattle)
+ * @param player_policy Player policy (choices are sampled by probability)
+ * @param enemy_policy Enemy policy
+ * @param options Run size, threading and sketch configuration
+ *
+ * A greedy side evaluates every choice its policy offers with the base damage
+ * formula (stages, Choice Band, weather; no chance) and plays the strongest,
+ * the first offered on ties; moves without power count as 0 damage.
+ *
+ * Reseeds the battle RNG of every worker thread. The calling thread's RNG is
+ * used (and reseeded) when options.threads is 1.
+ */
+BatchReport RunBatch(const battle::BattleEngine& start, Policy player_policy, Policy enemy_policy,
+                     const BatchOptions& options = BatchOptions());
+
+}  // namespace analysis
@@ -0,0 +1,179 @@
+/**
+ * @file analysis/opponent_model.cpp
+ * @brief Opponent action model for pruning opponent replies
+ */
+
+#include "opponent_model.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace analysis {
+
+namespace {
+
+/**
+ * @brief Model file identity mixed into the engine data hash
+ */
+constexpr uint64_t MODEL_TAG = 0x4f50504d4f44454cULL;  // "OPPMODEL"
+
+uint32_t HpQuarter(const battle::state::Pokemon& p) {
+    if (p.max_hp == 0 || p.current_hp == 0) {
+        return 0;
+    }
+    uint32_t quarter = (4u * p.current_hp - 1) / p.max_hp;
+    return quarter > 3 ? 3 : quarter;
+}
+
+/**
+ * @brief SplitMix64 step (picks the sampled reply)
+ */
+uint64_t Mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // namespace
+
+uint32_t SituationKey(const battle::BattleEngine& engine, battle::Player side) {
+    uint8_t self = static_cast<uint8_t>(side);
+    const battle::state::BattleState& state = engine.GetState();
+    const battle::state::Pokemon& own = state.battlers[self];
+    const battle::state::Pokemon& foe = state.battlers[battle::state::Opponent(self)];
+
+    uint32_t key = static_cast<uint8_t>(own.species);
+    key = (key << 8) | static_cast<uint8_t>(foe.species);
+    key = (key << 2) | HpQuarter(own);
+    key = (key << 2) | HpQuarter(foe);
+    key = (key << 1) | (own.status1 != 0 ? 1 : 0);
+    key = (key << 1) | (foe.status1 != 0 ? 1 : 0);
+    key = (key << 3) | static_cast<uint8_t>(state.field.weather);
+    key = (key << 1) | (own.has_substitute ? 1 : 0);
+    key = (key << 1) | (foe.is_seeded ? 1 : 0);
+    key = (key << 1) | (state.scheduler.turn == 0 ? 1 : 0);
+    return key;
+}
+
+bool OpponentModel::Open(const std::string& path, uint64_t capacity) {
+    return table_.Open(path, cache::EngineDataHash() ^ MODEL_TAG, sizeof(ActionCounts), capacity);
+}
+
+void OpponentModel::Observe(const battle::BattleEngine& engine, battle::Player side,
+                            domain::Move move) {
+    uint8_t index = static_cast<uint8_t>(move);
+    if (index >= domain::NUM_MOVES || !table_.IsOpen()) {
+        return;
+    }
+    uint64_t key = SituationKey(engine, side);
+    ActionCounts counts;
+    const void* found = table_.Find(key);
+    if (found != nullptr) {
+        memcpy(&counts, found, sizeof(counts));
+    } else {
+        memset(&counts, 0, sizeof(counts));
+    }
+
+    // Halve every count when one saturates (keeps the ratios, favours recent play)
+    if (counts.counts[index] == UINT16_MAX) {
+        for (uint16_t& count : counts.counts) {
+            count /= 2;
+        }
+    }
+    counts.counts[index]++;
+    counts.total++;
+    memcpy(table_.Insert(key), &counts, sizeof(counts));
+}
+
+uint32_t OpponentModel::Observations(const battle::BattleEngine& engine,
+                                     battle::Player side) const {
+    ActionCounts counts;
+    const void* found = table_.IsOpen() ? table_.Find(SituationKey(engine, side)) : nullptr;
+    if (found == nullptr) {
+        return 0;
+    }
+    memcpy(&counts, found, sizeof(counts));
+    return counts.total;
+}
+
+double OpponentModel::Frequency(const battle::BattleEngine& engine, battle::Player side,
+                                domain::Move move) const {
+    uint8_t index = static_cast<uint8_t>(move);
+    const void* found = table_.IsOpen() ? table_.Find(SituationKey(engine, side)) : nullptr;
+    if (found == nullptr || index >= domain::NUM_MOVES) {
+        return 0.0;
+    }
+    ActionCounts counts;
+    memcpy(&counts, found, sizeof(counts));
+    uint32_t scaled_total = 0;
+    for (uint16_t count : counts.counts) {
+        scaled_total += count;
+    }
+    return scaled_total == 0 ? 0.0 : static_cast<double>(counts.counts[index]) / scaled_total;
+}
+
+uint8_t OpponentModel::RankReplies(const battle::BattleEngine& engine, battle::Player side,
+                                   const PolicyChoice* choices, uint8_t count,
+                                   const ReplyPruning& pruning, uint64_t sample,
+                                   PolicyChoice* out) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    // Observed counts restricted to the offered moves, blended with the policy prior
+    ActionCounts counts;
+    memset(&counts, 0, sizeof(counts));
+    const void* found = table_.IsOpen() ? table_.Find(SituationKey(engine, side)) : nullptr;
+    if (found != nullptr) {
+        memcpy(&counts, found, sizeof(counts));
+    }
+    double observed = 0.0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t index = static_cast<uint8_t>(choices[i].action.move);
+        observed += index < domain::NUM_MOVES ? counts.counts[index] : 0;
+    }
+
+    PolicyChoice ranked[MAX_POLICY_CHOICES];
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t index = static_cast<uint8_t>(choices[i].action.move);
+        double seen = index < domain::NUM_MOVES ? counts.counts[index] : 0;
+        ranked[i] = choices[i];
+        ranked[i].probability = (seen + pruning.prior_weight * choices[i].probability) /
+                                (observed + pruning.prior_weight);
+    }
+    std::stable_sort(ranked, ranked + count, [](const PolicyChoice& a, const PolicyChoice& b) {
+        return a.probability > b.probability;
+    });
+
+    // Expand the likeliest replies until they cover enough of the mass
+    uint8_t expanded = 0;
+    double covered = 0.0;
+    while (expanded < count && (expanded == 0 || (covered < pruning.coverage &&
+                                                  expanded < pruning.max_expanded))) {
+        out[expanded] = ranked[expanded];
+        covered += ranked[expanded].probability;
+        expanded++;
+    }
+    if (expanded == count) {
+        return expanded;
+    }
+
+    // One of the rest stands in for all of them
+    double rest = 1.0 - covered;
+    double pick = static_cast<double>(Mix(sample) >> 11) * (1.0 / 9007199254740992.0) * rest;
+    uint8_t chosen = expanded;
+    for (uint8_t i = expanded; i < count; i++) {
+        chosen = i;
+        pick -= ranked[i].probability;
+        if (pick < 0.0) {
+            break;
+        }
+    }
+    out[expanded] = ranked[chosen];
+    out[expanded].probability = rest;
+    return static_cast<uint8_t>(expanded + 1);
+}
+
+}  // namespace analysis
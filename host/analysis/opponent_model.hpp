@@ -0,0 +1,106 @@
+/**
+ * @file analysis/opponent_model.hpp
+ * @brief Opponent action model for pruning opponent replies (host only)
+ *
+ * Human opponents concentrate on a few replies in a given situation, so
+ * expanding every opponent action evenly wastes most of a search budget. The
+ * model counts which move an opponent used, keyed by coarse situation
+ * features (species matchup, HP quarters, statuses, weather, substitute, Leech
+ * Seed, first turn), and stores the counts in a cache::MappedTable file so
+ * what was learned from earlier logs survives restarts.
+ *
+ * RankReplies turns a policy's choices into a pruned expansion list:
+ * - Each choice is reweighted by the observed frequencies, with the policy's
+ *   own probability as a prior (prior_weight pseudo-observations)
+ * - The likeliest replies are kept until they cover `coverage` of the mass
+ * - One of the remaining replies is sampled (in proportion to its weight) and
+ *   carries all the leftover mass, so the returned choices still sum to 1
+ *
+ * PropagateOutcomes applies it to the enemy's choices when
+ * PropagationOptions::enemy_model is set.
+ *
+ * Host only: uses cache::MappedTable.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+#include "cache/mapped_table.hpp"
+#include "propagation.hpp"
+
+namespace analysis {
+
+/**
+ * @brief Situation features of one side's decision, packed into a key
+ */
+uint32_t SituationKey(const battle::BattleEngine& engine, battle::Player side);
+
+/**
+ * @brief Observed move counts for one situation (the stored record)
+ */
+struct ActionCounts {
+    uint32_t total;                      // Observations (not reduced by rescaling)
+    uint16_t counts[domain::NUM_MOVES];  // Per move; halved together when one saturates
+};
+
+/**
+ * @brief File-backed opponent move frequencies by situation
+ */
+class OpponentModel {
+   public:
+    /**
+     * @brief Map (or create) the model file
+     * @param capacity Situations kept (older ones are replaced once full)
+     * @return false if the file could not be mapped
+     */
+    bool Open(const std::string& path, uint64_t capacity = 1 << 16);
+
+    void Close() { table_.Close(); }
+
+    /**
+     * @brief Whether the model started with observations from a previous run
+     */
+    bool WarmStarted() const { return table_.WarmStarted(); }
+
+    /**
+     * @brief Situations with at least one observation
+     */
+    uint64_t Situations() const { return table_.Size(); }
+
+    /**
+     * @brief Record that side used move in the given state (before the turn ran)
+     */
+    void Observe(const battle::BattleEngine& engine, battle::Player side, domain::Move move);
+
+    /**
+     * @brief Observations recorded for side's situation in this state
+     */
+    uint32_t Observations(const battle::BattleEngine& engine, battle::Player side) const;
+
+    /**
+     * @brief Observed frequency of move in side's situation (0 if never observed)
+     */
+    double Frequency(const battle::BattleEngine& engine, battle::Player side,
+                     domain::Move move) const;
+
+    /**
+     * @brief Reweight and prune a policy's choices for side
+     * @param choices Policy choices (probabilities summing to 1)
+     * @param count Number of choices
+     * @param pruning Limits
+     * @param sample Seed for picking the sampled reply (e.g. a state hash)
+     * @param out Receives the choices to expand, likeliest first
+     * @return Number of choices written (at most max_expanded + 1)
+     */
+    uint8_t RankReplies(const battle::BattleEngine& engine, battle::Player side,
+                        const PolicyChoice* choices, uint8_t count, const ReplyPruning& pruning,
+                        uint64_t sample, PolicyChoice* out) const;
+
+   private:
+    cache::MappedTable table_;
+};
+
+}  // namespace analysis
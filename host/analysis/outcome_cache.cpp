@@ -0,0 +1,67 @@
+/**
+ * @file analysis/outcome_cache.cpp
+ * @brief Persistent cache of propagated matchup outcomes
+ */
+
+#include "outcome_cache.hpp"
+
+#include <string.h>
+
+namespace analysis {
+
+namespace {
+
+/**
+ * @brief Cache key: state hash, policy pair and propagation limits
+ */
+uint64_t MatchupKey(const battle::BattleEngine& start, uint32_t policy_pair_id,
+                    const PropagationOptions& options) {
+    uint64_t epsilon_bits;
+    memcpy(&epsilon_bits, &options.epsilon, sizeof(epsilon_bits));
+    uint64_t key = start.HashState();
+    for (uint64_t part : {uint64_t(policy_pair_id), epsilon_bits, uint64_t(options.max_turns)}) {
+        key ^= part + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2);
+    }
+    return key;
+}
+
+}  // namespace
+
+bool OutcomeCache::Open(const std::string& path, uint64_t capacity) {
+    return table_.Open(path, cache::EngineDataHash(), sizeof(OutcomeSummary), capacity);
+}
+
+OutcomeSummary OutcomeCache::Propagate(const battle::BattleEngine& start, Policy player_policy,
+                                       Policy enemy_policy, uint32_t policy_pair_id,
+                                       const PropagationOptions& options, bool* hit) {
+    OutcomeSummary summary;
+    if (options.enemy_model != nullptr) {
+        // Pruned results depend on the model's contents, which no key can name
+        OutcomeDistribution result = PropagateOutcomes(start, player_policy, enemy_policy, options);
+        if (hit != nullptr) {
+            *hit = false;
+        }
+        summary = {result.player_win, result.enemy_win, result.draw, result.unresolved};
+        return summary;
+    }
+
+    uint64_t key = MatchupKey(start, policy_pair_id, options);
+    const void* cached = table_.Find(key);
+    if (hit != nullptr) {
+        *hit = (cached != nullptr);
+    }
+    if (cached != nullptr) {
+        memcpy(&summary, cached, sizeof(summary));
+        return summary;
+    }
+
+    OutcomeDistribution result = PropagateOutcomes(start, player_policy, enemy_policy, options);
+    summary = {result.player_win, result.enemy_win, result.draw, result.unresolved};
+    void* slot = table_.Insert(key);
+    if (slot != nullptr) {
+        memcpy(slot, &summary, sizeof(summary));
+    }
+    return summary;
+}
+
+}  // namespace analysis
@@ -0,0 +1,75 @@
+/**
+ * @file analysis/outcome_cache.hpp
+ * @brief Persistent cache of propagated matchup outcomes (host only)
+ *
+ * Exact propagation of a matchup can take seconds; its result depends only on
+ * the starting state, the policies and the propagation limits. This cache keeps
+ * the outcome totals in a MappedTable file so a restarted process answers
+ * repeated matchups immediately instead of recomputing them.
+ *
+ * Policies are function pointers, which are not stable across runs, so callers
+ * name each policy pair with a stable id.
+ *
+ * Host only: uses cache::MappedTable.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+#include "cache/mapped_table.hpp"
+#include "propagation.hpp"
+
+namespace analysis {
+
+/**
+ * @brief Outcome totals stored per matchup (the turn histogram is not cached)
+ */
+struct OutcomeSummary {
+    double player_win;
+    double enemy_win;
+    double draw;
+    double unresolved;
+};
+
+/**
+ * @brief File-backed matchup outcome cache
+ */
+class OutcomeCache {
+   public:
+    /**
+     * @brief Map (or create) the cache file
+     * @param capacity Matchups kept (older entries are replaced once full)
+     * @return false if the file could not be mapped (the cache then stays empty)
+     */
+    bool Open(const std::string& path, uint64_t capacity = 1 << 16);
+
+    void Close() { table_.Close(); }
+
+    /**
+     * @brief Whether the cache started with entries from a previous run
+     */
+    bool WarmStarted() const { return table_.WarmStarted(); }
+
+    uint64_t Size() const { return table_.Size(); }
+
+    /**
+     * @brief Cached outcome for a matchup, computing and storing it on a miss
+     * @param policy_pair_id Stable id of (player_policy, enemy_policy)
+     * @param hit Receives whether the result came from the cache (optional)
+     *
+     * With options.enemy_model set the result depends on the model's contents,
+     * so it is computed every time and never read from or written to the cache.
+     */
+    OutcomeSummary Propagate(const battle::BattleEngine& start, Policy player_policy,
+                             Policy enemy_policy, uint32_t policy_pair_id,
+                             const PropagationOptions& options = PropagationOptions(),
+                             bool* hit = nullptr);
+
+   private:
+    cache::MappedTable table_;
+};
+
+}  // namespace analysis
@@ -0,0 +1,231 @@
+/**
+ * @file analysis/propagation.cpp
+ * @brief Exact outcome-distribution propagation
+ */
+
+#include "propagation.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+#include "battle/random.hpp"
+#include "opponent_model.hpp"
+#include "transition_cache.hpp"
+
+namespace analysis {
+
+namespace {
+
+/**
+ * @brief A merged frontier state and the probability mass that reached it
+ */
+struct FrontierEntry {
+    battle::BattleEngine engine;
+    double mass;
+};
+
+using Frontier = std::unordered_map<std::string, FrontierEntry>;
+
+std::string StateKey(const battle::BattleEngine& engine) {
+    uint8_t buffer[battle::MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+    return std::string(reinterpret_cast<const char*>(buffer), size);
+}
+
+/**
+ * @brief Add a post-turn state to the outcome totals or the next frontier
+ */
+void Accumulate(const battle::BattleEngine& next, double mass, uint16_t turn, Frontier& frontier,
+                OutcomeDistribution& result) {
+    if (!next.IsBattleOver()) {
+        std::string key = StateKey(next);
+        auto it = frontier.find(key);
+        if (it == frontier.end()) {
+            frontier.emplace(std::move(key), FrontierEntry{next, mass});
+        } else {
+            it->second.mass += mass;
+        }
+        return;
+    }
+
+    bool player_fainted = next.GetPlayer().is_fainted;
+    bool enemy_fainted = next.GetEnemy().is_fainted;
+    if (player_fainted && enemy_fainted) {
+        result.draw += mass;
+    } else if (enemy_fainted) {
+        result.player_win += mass;
+    } else {
+        result.enemy_win += mass;
+    }
+    result.end_turn[turn] += mass;
+}
+
+/**
+ * @brief Add a cached transition's successors (rebuilt from their keys)
+ */
+void AccumulateCached(const battle::BattleEngine& state, const std::vector<Successor>& successors,
+                      double mass, uint16_t turn, Frontier& frontier, OutcomeDistribution& result) {
+    battle::state::BattleState start = state.GetState();
+    start.scheduler.turn++;
+    battle::BattleEngine next = state;
+    for (const Successor& successor : successors) {
+        next.LoadState(start);
+        next.UnpackKey(successor.state);
+        Accumulate(next, mass * successor.probability, turn, frontier, result);
+    }
+}
+
+/**
+ * @brief Record one chance outcome's successor (false if it has no keyed form)
+ */
+bool RecordSuccessor(const battle::BattleEngine& next, double probability,
+                     std::vector<Successor>& successors) {
+    battle::state::StateKey key;
+    if (!next.PackKey(&key)) {
+        return false;
+    }
+    for (Successor& successor : successors) {
+        if (successor.state == key) {
+            successor.probability += probability;
+            return true;
+        }
+    }
+    successors.push_back(Successor{key, probability});
+    return true;
+}
+
+/**
+ * @brief Step one state through every chance outcome of a turn
+ *
+ * The turn is rerun once per chance outcome under the exhaustive draw
+ * enumerator (random::Enumerator); each outcome carries 1 / (product of its
+ * draw bounds) of the incoming mass. If an outcome makes too many draws to
+ * enumerate, the mass not yet added by earlier outcomes is reported as
+ * unresolved, so the expansion never adds more than its incoming mass. With a
+ * transition cache, a cached turn is taken from the cache and a fully keyed one
+ * is stored in it.
+ */
+void ExpandChance(const battle::BattleEngine& state, const battle::BattleAction& player_action,
+                  const battle::BattleAction& enemy_action, double mass, uint16_t turn,
+                  TransitionCache* transitions, const Matchup& matchup, Frontier& frontier,
+                  OutcomeDistribution& result) {
+    TransitionKey key;
+    std::vector<Successor> successors;
+    bool record = transitions != nullptr && state.PackKey(&key.state);
+    if (record) {
+        key.matchup = matchup;
+        key.player = player_action;
+        key.enemy = enemy_action;
+        if (transitions->Lookup(key, &successors)) {
+            AccumulateCached(state, successors, mass, turn, frontier, result);
+            result.transitions_reused++;
+            return;
+        }
+    }
+
+    battle::random::Enumerator outcomes;
+    battle::random::BeginEnumeration(outcomes);
+    double accounted = 0.0;  // Mass already added by earlier outcomes of this expansion
+
+    do {
+        battle::BattleEngine next = state;
+        next.ExecuteTurn(player_action, enemy_action);
+        result.outcomes_expanded++;
+
+        if (battle::random::OutcomeTruncated(outcomes)) {
+            // Too many draws to enumerate: the outcomes not yet visited stay unresolved
+            battle::random::NextOutcome(outcomes);
+            result.unresolved += mass > accounted ? mass - accounted : 0.0;
+            return;
+        }
+
+        double probability = mass;
+        double share = 1.0;
+        for (uint8_t i = 0; i < battle::random::OutcomeDraws(outcomes); i++) {
+            probability /= outcomes.script.records[i].bound;
+            share /= outcomes.script.records[i].bound;
+        }
+        record = record && RecordSuccessor(next, share, successors);
+        Accumulate(next, probability, turn, frontier, result);
+        accounted += probability;
+    } while (battle::random::NextOutcome(outcomes));
+
+    if (record) {
+        transitions->Insert(key, successors);
+    }
+}
+
+}  // namespace
+
+OutcomeDistribution PropagateOutcomes(const battle::BattleEngine& start, Policy player_policy,
+                                      Policy enemy_policy, const PropagationOptions& options) {
+    OutcomeDistribution result;
+    result.player_win = 0.0;
+    result.enemy_win = 0.0;
+    result.draw = 0.0;
+    result.unresolved = 0.0;
+    result.end_turn.assign(static_cast<size_t>(options.max_turns) + 1, 0.0);
+    result.peak_states = 0;
+    result.outcomes_expanded = 0;
+    result.replies_pruned = 0;
+    result.transitions_reused = 0;
+    Matchup matchup = options.transitions != nullptr ? MakeMatchup(start) : Matchup();
+
+    Frontier frontier;
+    Accumulate(start, 1.0, 0, frontier, result);
+
+    PolicyChoice player_choices[MAX_POLICY_CHOICES];
+    PolicyChoice enemy_choices[MAX_POLICY_CHOICES];
+    PolicyChoice offered[MAX_POLICY_CHOICES];
+
+    for (uint16_t turn = 1; turn <= options.max_turns && !frontier.empty(); turn++) {
+        Frontier next;
+        for (const auto& item : frontier) {
+            const FrontierEntry& entry = item.second;
+            uint8_t player_count =
+                player_policy(entry.engine, battle::Player::PLAYER, player_choices);
+            uint8_t enemy_count = enemy_policy(entry.engine, battle::Player::ENEMY, enemy_choices);
+            if (options.enemy_model != nullptr && enemy_count > 1) {
+                // Likeliest replies first; one sampled reply stands in for the rest
+                std::copy(enemy_choices, enemy_choices + enemy_count, offered);
+                uint8_t kept = options.enemy_model->RankReplies(
+                    entry.engine, battle::Player::ENEMY, offered, enemy_count, options.pruning,
+                    entry.engine.HashState() ^ turn, enemy_choices);
+                result.replies_pruned += enemy_count - kept;
+                enemy_count = kept;
+            }
+
+            for (uint8_t p = 0; p < player_count; p++) {
+                for (uint8_t e = 0; e < enemy_count; e++) {
+                    double mass =
+                        entry.mass * player_choices[p].probability * enemy_choices[e].probability;
+                    if (mass > 0.0) {
+                        ExpandChance(entry.engine, player_choices[p].action,
+                                     enemy_choices[e].action, mass, turn, options.transitions,
+                                     matchup, next, result);
+                    }
+                }
+            }
+        }
+        frontier.swap(next);
+        if (frontier.size() > result.peak_states) {
+            result.peak_states = frontier.size();
+        }
+
+        double remaining = 0.0;
+        for (const auto& item : frontier) {
+            remaining += item.second.mass;
+        }
+        if (remaining < options.epsilon) {
+            break;
+        }
+    }
+
+    for (const auto& item : frontier) {
+        result.unresolved += item.second.mass;
+    }
+    return result;
+}
+
+}  // namespace analysis
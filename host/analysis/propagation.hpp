@@ -0,0 +1,109 @@
+/**
+ * @file analysis/propagation.hpp
+ * @brief Exact outcome-distribution propagation (host only)
+ *
+ * Computes the exact win/loss/draw probabilities of a matchup under a fixed pair
+ * of policies, instead of estimating them with Monte Carlo runs:
+ * - Each turn, every frontier state is stepped through every policy action pair
+ *   and every chance outcome (RNG draws are enumerated via forced-draw mode)
+ * - Identical resulting states are merged and their probability mass summed
+ * - Terminal states are moved into the outcome totals and the turn histogram
+ * - Propagation stops once the remaining mass drops below epsilon
+ * - Optionally, an OpponentModel prunes the enemy's replies: the likeliest are
+ *   expanded and one sampled reply stands in for the rest (approximate)
+ * - Optionally, a TransitionCache supplies turns already expanded (by this or an
+ *   earlier propagation) instead of rerunning them
+ *
+ * Host only: uses the standard library containers and double precision.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "battle/engine.hpp"
+
+namespace analysis {
+
+/**
+ * @brief Maximum number of actions a policy can choose between in one state
+ */
+constexpr uint8_t MAX_POLICY_CHOICES = 4;
+
+/**
+ * @brief One weighted action offered by a policy
+ */
+struct PolicyChoice {
+    battle::BattleAction action;
+    double probability;  // Choices returned for one state must sum to 1
+};
+
+/**
+ * @brief Policy: fills the weighted actions a side picks from in the given state
+ * @param engine Current battle state
+ * @param side Side to choose for
+ * @param out Receives up to MAX_POLICY_CHOICES choices
+ * @return Number of choices written (1 for a deterministic policy)
+ */
+using Policy = uint8_t (*)(const battle::BattleEngine& engine, battle::Player side,
+                           PolicyChoice* out);
+
+class OpponentModel;
+class TransitionCache;
+
+/**
+ * @brief Reply pruning limits (see OpponentModel::RankReplies)
+ */
+struct ReplyPruning {
+    double coverage = 0.9;      // Expand the likeliest replies up to this share of the mass
+    double prior_weight = 4.0;  // Pseudo-observations given to the policy's own probabilities
+    uint8_t max_expanded = 2;   // Most replies expanded before the rest are sampled
+};
+
+/**
+ * @brief Propagation limits
+ *
+ * With an enemy model the result depends on the model's contents, so it is an
+ * estimate and should not be cached under the unpruned policy pair's id.
+ */
+struct PropagationOptions {
+    double epsilon = 1e-9;                       // Stop once the unresolved mass falls below this
+    uint16_t max_turns = 200;                    // Hard turn cap (stalling matchups never resolve)
+    const OpponentModel* enemy_model = nullptr;  // Prunes enemy replies (nullptr = expand all)
+    ReplyPruning pruning;                        // Limits used with enemy_model
+    TransitionCache* transitions = nullptr;      // Memo of expanded turns (nullptr = rerun all)
+};
+
+/**
+ * @brief Exact outcome distribution of a matchup
+ */
+struct OutcomeDistribution {
+    double player_win;  // Enemy fainted, player did not
+    double enemy_win;   // Player fainted, enemy did not
+    double draw;        // Both fainted on the same turn
+    double unresolved;  // Mass still in play when propagation stopped
+    std::vector<double> end_turn;  // end_turn[t] = probability the battle ends on turn t
+    size_t peak_states;            // Largest frontier after merging (for profiling)
+    size_t outcomes_expanded;      // Number of single-turn simulations run
+    size_t replies_pruned;         // Enemy replies folded into a sampled stand-in
+    size_t transitions_reused;     // Turns taken from the transition cache
+};
+
+/**
+ * @brief Propagate the exact outcome distribution of a battle
+ * @param start Initial state (after InitBattle)
+ * @param player_policy Player policy
+ * @param enemy_policy Enemy policy
+ * @param options Stopping limits
+ *
+ * Turns that make more than battle::random::MAX_RECORDED_DRAWS draws cannot be
+ * enumerated; their mass is reported as unresolved.
+ */
+OutcomeDistribution PropagateOutcomes(const battle::BattleEngine& start, Policy player_policy,
+                                      Policy enemy_policy,
+                                      const PropagationOptions& options = PropagationOptions());
+
+}  // namespace analysis
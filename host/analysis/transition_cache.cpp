@@ -0,0 +1,153 @@
+/**
+ * @file analysis/transition_cache.cpp
+ * @brief Concurrent memo cache of whole-turn transitions
+ */
+
+#include "transition_cache.hpp"
+
+#include <string.h>
+
+namespace analysis {
+
+namespace {
+
+uint64_t Mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+uint32_t ActionBits(const battle::BattleAction& action) {
+    return static_cast<uint32_t>(action.type) | static_cast<uint32_t>(action.player) << 8 |
+           static_cast<uint32_t>(action.move_slot) << 16 |
+           static_cast<uint32_t>(action.move) << 24;
+}
+
+/**
+ * @brief Hash of a whole key (shard and bucket choice)
+ */
+uint64_t KeyHash64(const TransitionKey& key) {
+    uint64_t actions = static_cast<uint64_t>(ActionBits(key.player)) << 32 | ActionBits(key.enemy);
+    return Mix(battle::state::HashKey(key.state) ^ Mix(key.matchup.fingerprint ^ actions));
+}
+
+}  // namespace
+
+Matchup MakeMatchup(const battle::BattleEngine& engine) {
+    battle::state::BattleState fixed = engine.GetState();
+    battle::state::UnpackKey(battle::state::StateKey{{0, 0}}, &fixed);
+    fixed.scheduler.turn = 0;
+
+    battle::BattleEngine reset;
+    reset.LoadState(fixed);
+    uint8_t encoded[battle::MAX_ENCODED_STATE_SIZE];
+    reset.EncodeState(encoded);
+
+    Matchup matchup;
+    memcpy(matchup.bytes, encoded, MATCHUP_SIZE);
+    const battle::script::ScriptTable* scripts = engine.GetScriptTable();
+    matchup.scripts = scripts != nullptr ? scripts->checksum : 0;
+    matchup.fingerprint = Mix(battle::state::HashEncoded(matchup.bytes, MATCHUP_SIZE) ^
+                              Mix(matchup.scripts));
+    return matchup;
+}
+
+size_t TransitionCache::KeyHash::operator()(const TransitionKey& key) const {
+    return static_cast<size_t>(KeyHash64(key));
+}
+
+bool TransitionCache::KeyEqual::operator()(const TransitionKey& a, const TransitionKey& b) const {
+    return a.state == b.state && a.matchup.scripts == b.matchup.scripts &&
+           memcmp(a.matchup.bytes, b.matchup.bytes, MATCHUP_SIZE) == 0 &&
+           ActionBits(a.player) == ActionBits(b.player) &&
+           ActionBits(a.enemy) == ActionBits(b.enemy);
+}
+
+TransitionCache::TransitionCache(const TransitionCacheOptions& options) {
+    uint32_t shards = options.shards > 0 ? options.shards : 1;
+    for (uint32_t i = 0; i < shards; i++) {
+        shards_.emplace_back(new Shard());
+    }
+    shard_budget_ = options.capacity_mb * (size_t(1) << 20) / shards;
+}
+
+size_t TransitionCache::EntryBytes(size_t successors) {
+    // List node (two links) and index node (key, iterator, link, cached hash)
+    size_t list_node = sizeof(Entry) + 2 * sizeof(void*);
+    size_t index_node = sizeof(Index::value_type) + sizeof(void*) + sizeof(size_t);
+    return list_node + index_node + successors * sizeof(Successor);
+}
+
+TransitionCache::Shard& TransitionCache::ShardFor(const TransitionKey& key) {
+    // High bits of the 64-bit hash pick the shard; the index buckets use the low bits
+    return *shards_[static_cast<size_t>((KeyHash64(key) >> 40) % shards_.size())];
+}
+
+bool TransitionCache::Lookup(const TransitionKey& key, std::vector<Successor>* out) {
+    Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        shard.misses++;
+        return false;
+    }
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    *out = it->second->successors;
+    shard.hits++;
+    return true;
+}
+
+void TransitionCache::Insert(const TransitionKey& key, const std::vector<Successor>& successors) {
+    size_t bytes = EntryBytes(successors.size());
+    if (bytes > shard_budget_) {
+        return;
+    }
+
+    Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        shard.bytes -= EntryBytes(it->second->successors.size());
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+    }
+
+    while (shard.bytes + bytes > shard_budget_) {
+        const Entry& oldest = shard.entries.back();
+        shard.bytes -= EntryBytes(oldest.successors.size());
+        shard.index.erase(oldest.key);
+        shard.entries.pop_back();
+        shard.evictions++;
+    }
+
+    shard.entries.push_front(Entry{key, successors});
+    shard.index.emplace(key, shard.entries.begin());
+    shard.bytes += bytes;
+    shard.insertions++;
+}
+
+void TransitionCache::Clear() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->entries.clear();
+        shard->index.clear();
+        shard->bytes = 0;
+    }
+}
+
+TransitionCacheStats TransitionCache::Stats() const {
+    TransitionCacheStats stats = {};
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        stats.hits += shard->hits;
+        stats.misses += shard->misses;
+        stats.insertions += shard->insertions;
+        stats.evictions += shard->evictions;
+        stats.entries += shard->index.size();
+        stats.bytes += shard->bytes;
+    }
+    return stats;
+}
+
+}  // namespace analysis
@@ -0,0 +1,165 @@
+/**
+ * @file analysis/transition_cache.hpp
+ * @brief Concurrent memo cache of whole-turn transitions (host only)
+ *
+ * Search and propagation keep expanding the same (state, player action, enemy
+ * action) triples. Expanding one means rerunning the turn once per chance
+ * outcome; this cache keeps the result instead:
+ * - Key: the packed state key (state::StateKey), the matchup bytes the key
+ *   leaves out, the installed script table's checksum and the joint action
+ *   (an exact match: nothing is compared by hash alone)
+ * - Value: the outcome distribution, as successor state keys with their
+ *   probabilities (identical successors merged)
+ * - Sharded by key hash, one mutex per shard, so threads rarely contend
+ * - Bounded in MB; each shard evicts its least recently used entries once over
+ *   its share of the budget
+ *
+ * Only transitions whose start and every successor have a keyed form can be
+ * stored (see state_key.hpp). A reused transition emits no battle events.
+ *
+ * Host only: uses std::mutex and the standard library containers.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "battle/engine.hpp"
+
+namespace analysis {
+
+/**
+ * @brief Encoded size of the matchup data (everything the state encoding puts before the scheduler)
+ */
+constexpr size_t MATCHUP_SIZE = battle::state::ENCODED_FIXED_SIZE;
+
+/**
+ * @brief The fixed matchup data and engine configuration the state key leaves out
+ *
+ * The encoded state with every keyed field reset, so species, stats, types,
+ * abilities, items, levels and max HP are compared byte for byte. Equal for
+ * every state of one battle.
+ */
+struct Matchup {
+    uint8_t bytes[MATCHUP_SIZE];
+    uint64_t scripts;      // ScriptTable::checksum of the installed scripts (0 = native effects)
+    uint64_t fingerprint;  // Hash of the above (picks shard and bucket; never compared)
+};
+
+/**
+ * @brief Cached transition key
+ */
+struct TransitionKey {
+    battle::state::StateKey state;  // Start of the turn
+    Matchup matchup;                // MakeMatchup of the battle
+    battle::BattleAction player;
+    battle::BattleAction enemy;
+};
+
+/**
+ * @brief One successor of a cached transition
+ */
+struct Successor {
+    battle::state::StateKey state;  // State at the end of the turn
+    double probability;             // Share of the incoming mass (successors sum to 1)
+};
+
+/**
+ * @brief Matchup of a battle (its encoded fixed data and script table)
+ */
+Matchup MakeMatchup(const battle::BattleEngine& engine);
+
+/**
+ * @brief Cache configuration
+ */
+struct TransitionCacheOptions {
+    size_t capacity_mb = 64;  // Memory budget (keys, successor lists, bookkeeping)
+    uint32_t shards = 16;     // Independently locked partitions (at least 1)
+};
+
+/**
+ * @brief Cache counters (summed over shards)
+ */
+struct TransitionCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;  // Entries dropped to stay within the budget
+    uint64_t entries;    // Entries currently held
+    uint64_t bytes;      // Budgeted bytes currently held
+};
+
+/**
+ * @brief Bounded, thread-safe (state, joint action) -> outcome distribution cache
+ */
+class TransitionCache {
+   public:
+    explicit TransitionCache(const TransitionCacheOptions& options = TransitionCacheOptions());
+
+    TransitionCache(const TransitionCache&) = delete;
+    TransitionCache& operator=(const TransitionCache&) = delete;
+
+    /**
+     * @brief Cached successors of a transition
+     * @param out Receives the successors on a hit (left unchanged on a miss)
+     * @return true on a hit (the entry becomes the most recently used)
+     */
+    bool Lookup(const TransitionKey& key, std::vector<Successor>* out);
+
+    /**
+     * @brief Store (or replace) a transition's successors
+     *
+     * A distribution larger than a whole shard's budget is not stored.
+     */
+    void Insert(const TransitionKey& key, const std::vector<Successor>& successors);
+
+    void Clear();
+
+    TransitionCacheStats Stats() const;
+
+    /**
+     * @brief Budgeted size of an entry with the given number of successors
+     */
+    static size_t EntryBytes(size_t successors);
+
+   private:
+    struct Entry {
+        TransitionKey key;
+        std::vector<Successor> successors;
+    };
+
+    struct KeyHash {
+        size_t operator()(const TransitionKey& key) const;
+    };
+
+    struct KeyEqual {
+        bool operator()(const TransitionKey& a, const TransitionKey& b) const;
+    };
+
+    using Index = std::unordered_map<TransitionKey, std::list<Entry>::iterator, KeyHash, KeyEqual>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;  // Most recently used first
+        Index index;
+        size_t bytes = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+    };
+
+    Shard& ShardFor(const TransitionKey& key);
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    size_t shard_budget_;
+};
+
+}  // namespace analysis
@@ -0,0 +1,327 @@
+/**
+ * @file cache/mapped_table.cpp
+ * @brief Persistent memory-mapped cache table
+ */
+
+#include "mapped_table.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CACHE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define CACHE_HAS_MMAP 0
+#endif
+
+#include "battle/chance.hpp"
+#include "battle/engine.hpp"
+#include "battle/items.hpp"
+#include "battle/move_data.hpp"
+#include "battle/state/battle_state.hpp"
+#include "battle/status_tables.hpp"
+#include "battle/type_chart.hpp"
+#include "battle/weather_tables.hpp"
+
+namespace cache {
+
+namespace {
+
+constexpr char CACHE_MAGIC[8] = {'B', 'F', 'C', 'A', 'C', 'H', 'E', '1'};
+
+/**
+ * @brief Probe window before the home slot is replaced
+ */
+constexpr uint64_t MAX_PROBE = 8;
+
+/**
+ * @brief File header (followed by capacity slots of key + payload)
+ */
+struct Header {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t record_size;
+    uint64_t data_hash;
+    uint64_t capacity;
+    uint64_t used;
+};
+
+/**
+ * @brief Key stored for a lookup key (0 marks an empty slot)
+ */
+uint64_t StoredKey(uint64_t key) {
+    return key == 0 ? 1 : key;
+}
+
+/**
+ * @brief Home slot of a key (SplitMix64 finalizer: keys may be weak FNV hashes)
+ */
+uint64_t Home(uint64_t key, uint64_t capacity) {
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return (key ^ (key >> 31)) & (capacity - 1);
+}
+
+struct Fnv {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    void Add(uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++) {
+            hash ^= (value >> (8 * i)) & 0xff;
+            hash *= 0x100000001b3ULL;
+        }
+    }
+
+    void AddChance(const battle::chance::Table& table) {
+        Add(table.denominator, 2);
+        Add(table.outcome_count, 1);
+        for (uint8_t i = 0; i < battle::chance::MAX_OUTCOMES; i++) {
+            Add(table.threshold[i], 2);
+        }
+    }
+};
+
+}  // namespace
+
+uint64_t EngineDataHash() {
+    return EngineDataHash(battle::ENGINE_MECHANICS_VERSION);
+}
+
+uint64_t EngineDataHash(uint32_t mechanics_version) {
+    Fnv fnv;
+    fnv.Add(CACHE_FORMAT_VERSION, 4);
+    fnv.Add(mechanics_version, 4);
+    fnv.Add(sizeof(battle::state::BattleState), 4);
+    for (uint8_t m = 0; m < domain::NUM_MOVES; m++) {
+        const domain::MoveData& data = battle::GetMoveData(static_cast<domain::Move>(m));
+        fnv.Add(static_cast<uint8_t>(data.move), 1);
+        fnv.Add(static_cast<uint8_t>(data.type), 1);
+        fnv.Add(data.power, 1);
+        fnv.Add(data.accuracy, 1);
+        fnv.Add(data.pp, 1);
+        fnv.Add(data.effect_chance, 1);
+        fnv.Add(static_cast<uint8_t>(data.priority), 1);
+    }
+    for (uint8_t a = 0; a < domain::NUM_TYPES; a++) {
+        for (uint8_t d = 0; d < domain::NUM_TYPES; d++) {
+            fnv.Add(battle::types::TYPE_CHART[a][d], 1);
+        }
+    }
+
+    // Weather
+    for (uint8_t w = 0; w < domain::NUM_WEATHERS; w++) {
+        for (uint8_t t = 0; t < domain::NUM_TYPES; t++) {
+            fnv.Add(battle::weather::DAMAGE_TABLE.tenths[w][t], 1);
+        }
+        fnv.Add(battle::weather::RESIDUAL_DIVISOR[w], 1);
+        fnv.Add(battle::weather::RESIDUAL_IMMUNE_TYPES[w], 4);
+    }
+
+    // Status
+    fnv.Add(battle::status::MAX_TOXIC_COUNTER, 1);
+    for (const battle::status::Entry& entry : battle::status::TABLE.entries) {
+        fnv.Add(entry.act_roll, 1);
+        fnv.Add(entry.blocked_below, 1);
+        fnv.Add(entry.status_if_acts, 1);
+        fnv.Add(entry.status_if_blocked, 1);
+        fnv.Add(entry.residual_divisor, 1);
+        fnv.Add(entry.toxic_step, 1);
+    }
+
+    // Chance
+    fnv.AddChance(battle::chance::FULL_PARALYSIS);
+    fnv.AddChance(battle::chance::STAYS_FROZEN);
+    fnv.AddChance(battle::chance::SPEED_TIE);
+    fnv.AddChance(battle::chance::QUICK_CLAW);
+    fnv.AddChance(battle::chance::MULTI_HIT);
+    fnv.Add(battle::chance::MULTI_HIT_MIN, 1);
+    for (const battle::chance::Table& table : battle::chance::PROTECT) {
+        fnv.AddChance(table);
+    }
+
+    // Items
+    for (uint8_t hooks : battle::items::HOOKS) {
+        fnv.Add(hooks, 1);
+    }
+    return fnv.hash;
+}
+
+MappedTable::MappedTable()
+    : base_(nullptr), mapped_size_(0), slot_size_(0), warm_(false), mapped_(false) {}
+
+MappedTable::~MappedTable() {
+    Close();
+}
+
+bool MappedTable::Open(const std::string& path, uint64_t data_hash, uint32_t record_size,
+                       uint64_t capacity) {
+    Close();
+    uint64_t slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    path_ = path;
+    slot_size_ = sizeof(uint64_t) + record_size;
+    mapped_size_ = sizeof(Header) + slots * slot_size_;
+
+    Header expected = {};
+    memcpy(expected.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    expected.format_version = CACHE_FORMAT_VERSION;
+    expected.record_size = record_size;
+    expected.data_hash = data_hash;
+    expected.capacity = slots;
+
+#if CACHE_HAS_MMAP
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    bool same_size = fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) == mapped_size_;
+    if (!same_size && ftruncate(fd, 0) != 0) {
+        close(fd);
+        return false;
+    }
+    if (!same_size && ftruncate(fd, static_cast<off_t>(mapped_size_)) != 0) {
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    base_ = static_cast<uint8_t*>(map);
+    mapped_ = true;
+#else
+    buffer_.assign(mapped_size_, 0);
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file != nullptr) {
+        if (fread(buffer_.data(), 1, mapped_size_, file) != mapped_size_ || fgetc(file) != EOF) {
+            buffer_.assign(mapped_size_, 0);
+        }
+        fclose(file);
+    }
+    base_ = buffer_.data();
+    mapped_ = false;
+#endif
+
+    // Reuse the contents only if they were built by this layout and data
+    Header found;
+    memcpy(&found, base_, sizeof(Header));
+    warm_ = memcmp(found.magic, expected.magic, sizeof(expected.magic)) == 0 &&
+            found.format_version == expected.format_version &&
+            found.record_size == expected.record_size && found.data_hash == expected.data_hash &&
+            found.capacity == expected.capacity;
+    if (!warm_) {
+        memset(base_, 0, mapped_size_);
+        memcpy(base_, &expected, sizeof(Header));
+    }
+    return true;
+}
+
+void MappedTable::Sync() {
+    if (base_ == nullptr) {
+        return;
+    }
+#if CACHE_HAS_MMAP
+    msync(base_, mapped_size_, MS_SYNC);
+#else
+    FILE* file = fopen(path_.c_str(), "wb");
+    if (file != nullptr) {
+        fwrite(base_, 1, mapped_size_, file);
+        fclose(file);
+    }
+#endif
+}
+
+void MappedTable::Close() {
+    if (base_ == nullptr) {
+        return;
+    }
+    Sync();
+#if CACHE_HAS_MMAP
+    munmap(base_, mapped_size_);
+#endif
+    buffer_.clear();
+    base_ = nullptr;
+    warm_ = false;
+}
+
+uint8_t* MappedTable::Slot(uint64_t index) const {
+    return base_ + sizeof(Header) + index * slot_size_;
+}
+
+uint64_t MappedTable::Capacity() const {
+    if (base_ == nullptr) {
+        return 0;
+    }
+    Header header;
+    memcpy(&header, base_, sizeof(Header));
+    return header.capacity;
+}
+
+uint64_t MappedTable::Size() const {
+    if (base_ == nullptr) {
+        return 0;
+    }
+    Header header;
+    memcpy(&header, base_, sizeof(Header));
+    return header.used;
+}
+
+const void* MappedTable::Find(uint64_t key) const {
+    uint64_t capacity = Capacity();
+    if (capacity == 0) {
+        return nullptr;
+    }
+    uint64_t stored = StoredKey(key);
+    uint64_t home = Home(stored, capacity);
+    for (uint64_t i = 0; i < MAX_PROBE && i < capacity; i++) {
+        uint8_t* slot = Slot((home + i) & (capacity - 1));
+        uint64_t slot_key;
+        memcpy(&slot_key, slot, sizeof(slot_key));
+        if (slot_key == stored) {
+            return slot + sizeof(uint64_t);
+        }
+        if (slot_key == 0) {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void* MappedTable::Insert(uint64_t key) {
+    uint64_t capacity = Capacity();
+    if (capacity == 0) {
+        return nullptr;
+    }
+    uint64_t stored = StoredKey(key);
+    uint64_t home = Home(stored, capacity);
+    uint8_t* target = Slot(home);  // Replaced if the probe window is full
+    for (uint64_t i = 0; i < MAX_PROBE && i < capacity; i++) {
+        uint8_t* slot = Slot((home + i) & (capacity - 1));
+        uint64_t slot_key;
+        memcpy(&slot_key, slot, sizeof(slot_key));
+        if (slot_key == stored) {
+            return slot + sizeof(uint64_t);
+        }
+        if (slot_key == 0) {
+            Header header;
+            memcpy(&header, base_, sizeof(Header));
+            header.used++;
+            memcpy(base_, &header, sizeof(Header));
+            target = slot;
+            break;
+        }
+    }
+    memcpy(target, &stored, sizeof(stored));
+    memset(target + sizeof(uint64_t), 0, slot_size_ - sizeof(uint64_t));
+    return target + sizeof(uint64_t);
+}
+
+}  // namespace cache
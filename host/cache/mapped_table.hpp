@@ -0,0 +1,123 @@
+/**
+ * @file cache/mapped_table.hpp
+ * @brief Persistent memory-mapped cache table for warm starts (host only)
+ *
+ * A fixed-capacity hash table of fixed-size records that lives in a file:
+ * - The file is mapped at Open and written back by the OS; nothing is
+ *   serialized at shutdown beyond a final sync, so a restarted process maps
+ *   the previous process's contents and starts warm
+ * - The header records a format version, the record size and a data hash
+ *   (EngineDataHash: mechanics version, state layout, move data, rule tables);
+ *   a file written by a different engine build or record layout is discarded
+ *   and the table starts cold
+ * - Keys are 64-bit hashes with linear probing over a short window; when the
+ *   window is full the home slot is replaced (transposition-table style), so
+ *   inserts never fail and memory never grows
+ *
+ * Platforms without mmap load the file into memory and write it back at Close.
+ *
+ * Host only: uses POSIX file mapping and std::string.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace cache {
+
+/**
+ * @brief Bump when the file layout changes
+ */
+constexpr uint32_t CACHE_FORMAT_VERSION = 1;
+
+/**
+ * @brief Hash of everything derived cache contents depend on
+ *
+ * Covers the cache format version, the engine mechanics version, the battle
+ * state layout, the move database, the type chart and the weather, status,
+ * chance and item tables. Caches built against a different hash are stale.
+ */
+uint64_t EngineDataHash();
+
+/**
+ * @brief EngineDataHash() as it would be for another mechanics version
+ * @param mechanics_version Engine mechanics version (battle::ENGINE_MECHANICS_VERSION)
+ */
+uint64_t EngineDataHash(uint32_t mechanics_version);
+
+/**
+ * @brief File-backed table of fixed-size records keyed by 64-bit hashes
+ */
+class MappedTable {
+   public:
+    MappedTable();
+    ~MappedTable();
+
+    MappedTable(const MappedTable&) = delete;
+    MappedTable& operator=(const MappedTable&) = delete;
+
+    /**
+     * @brief Map (or create) a cache file
+     * @param path Cache file
+     * @param data_hash Version of the data the records derive from (e.g. EngineDataHash())
+     * @param record_size Payload bytes per record
+     * @param capacity Slots (rounded up to a power of two)
+     * @return false if the file could not be created or mapped
+     *
+     * An existing file is reused only if its header matches data_hash,
+     * record_size and capacity; otherwise it is reinitialized empty.
+     */
+    bool Open(const std::string& path, uint64_t data_hash, uint32_t record_size,
+              uint64_t capacity);
+
+    /**
+     * @brief Sync and unmap (called by the destructor)
+     */
+    void Close();
+
+    /**
+     * @brief Flush the mapping to disk without closing
+     */
+    void Sync();
+
+    bool IsOpen() const { return base_ != nullptr; }
+
+    /**
+     * @brief Whether Open found valid contents from a previous run
+     */
+    bool WarmStarted() const { return warm_; }
+
+    /**
+     * @brief Payload of a key's record (nullptr if absent)
+     */
+    const void* Find(uint64_t key) const;
+
+    /**
+     * @brief Payload to fill for a key (its existing record, a free slot or a replaced one)
+     */
+    void* Insert(uint64_t key);
+
+    /**
+     * @brief Number of occupied slots
+     */
+    uint64_t Size() const;
+
+    uint64_t Capacity() const;
+
+   private:
+    uint8_t* Slot(uint64_t index) const;
+
+    std::string path_;
+    uint8_t* base_;  // Mapped file (header, then slots)
+    size_t mapped_size_;
+    size_t slot_size_;  // Key + payload
+    bool warm_;
+    bool mapped_;                  // false: base_ is buffer_ (no mmap on this platform)
+    std::vector<uint8_t> buffer_;  // Backing memory when not mapped
+};
+
+}  // namespace cache
@@ -0,0 +1,276 @@
+/**
+ * @file capi/battle_capi.cpp
+ * @brief C ABI over pools of battle engines
+ */
+
+#include "battle_capi.h"
+
+#include <string.h>
+
+#include <new>
+#include <vector>
+
+#include "battle/engine.hpp"
+#include "battle/random.hpp"
+
+static_assert(sizeof(battle_step) == 8, "battle_step layout is part of the ABI");
+static_assert(sizeof(battle_step_result) == 8, "battle_step_result layout is part of the ABI");
+static_assert(battle::MAX_ENCODED_STATE_SIZE <= BATTLE_MAX_OBSERVATION_SIZE,
+              "Observations fit in BATTLE_MAX_OBSERVATION_SIZE");
+
+/**
+ * @brief Battle slots plus the scratch space one batch step needs
+ *
+ * The scratch vectors are reserved for a full pool at creation, so stepping
+ * never allocates.
+ */
+struct battle_pool {
+    std::vector<battle::BattleEngine> engines;
+    std::vector<uint8_t> started;               // Slot holds an initialized battle
+    std::vector<uint64_t> stepped;              // Batch generation that last stepped the slot
+    uint64_t generation = 0;                    // Bumped per battle_pool_step call
+    std::vector<battle::BattleEngine> slab;     // Gathered live battles of one batch
+    std::vector<battle::BattleAction> actions;  // Their action pairs
+    std::vector<size_t> slab_step;              // Step index of each gathered battle
+};
+
+namespace {
+
+constexpr uint8_t MAX_SPECIES = static_cast<uint8_t>(domain::Species::Skarmory);
+constexpr uint8_t MAX_ABILITY = static_cast<uint8_t>(domain::Ability::Intimidate);
+constexpr uint16_t MAX_TEAM_HP = 1023;  // Keeps every battle representable as a state key
+
+bool ValidType(uint8_t type, bool allow_none) {
+    return type < domain::NUM_TYPES ||
+           (allow_none && type == static_cast<uint8_t>(domain::Type::None));
+}
+
+/**
+ * @brief Decode one team code into a fresh Pokemon
+ * @return false if the code is malformed
+ */
+bool DecodeTeam(const uint8_t* code, battle::state::Pokemon* out) {
+    uint16_t max_hp = static_cast<uint16_t>(code[12] | code[13] << 8);
+    if (code[0] == 0 || code[0] > MAX_SPECIES || code[1] > MAX_ABILITY ||
+        !ValidType(code[2], false) || !ValidType(code[3], true) || code[4] < 1 ||
+        code[4] > 100 || code[10] >= domain::NUM_ITEMS || code[11] != 0 || code[14] != 0 ||
+        code[15] != 0 || max_hp == 0 || max_hp > MAX_TEAM_HP) {
+        return false;
+    }
+
+    battle::state::Pokemon p;
+    memset(&p, 0, sizeof(p));
+    p.species = static_cast<domain::Species>(code[0]);
+    p.ability = static_cast<domain::Ability>(code[1]);
+    p.type1 = static_cast<domain::Type>(code[2]);
+    p.type2 = static_cast<domain::Type>(code[3]);
+    p.level = code[4];
+    p.attack = code[5];
+    p.defense = code[6];
+    p.sp_attack = code[7];
+    p.sp_defense = code[8];
+    p.speed = code[9];
+    p.item = static_cast<domain::Item>(code[10]);
+    p.max_hp = max_hp;
+    p.current_hp = max_hp;
+    p.charging_move = domain::Move::None;
+    p.semi_invulnerable_type = battle::state::SemiInvulnerableType::None;
+    p.choiced_move = domain::Move::None;
+    *out = p;
+    return true;
+}
+
+uint8_t Winner(const battle::BattleEngine& engine) {
+    bool player_fainted = engine.GetPlayer().is_fainted;
+    bool enemy_fainted = engine.GetEnemy().is_fainted;
+    if (player_fainted && enemy_fainted) {
+        return BATTLE_WINNER_DRAW;
+    }
+    if (enemy_fainted) {
+        return BATTLE_WINNER_PLAYER;
+    }
+    return player_fainted ? BATTLE_WINNER_ENEMY : BATTLE_WINNER_NONE;
+}
+
+/**
+ * @brief Record a per-item status, keeping the first error as the call's result
+ */
+void Report(int32_t status, int32_t* statuses, size_t i, int32_t* first_error) {
+    if (statuses != nullptr) {
+        statuses[i] = status;
+    }
+    if (status != BATTLE_OK && *first_error == BATTLE_OK) {
+        *first_error = status;
+    }
+}
+
+}  // namespace
+
+extern "C" {
+
+uint32_t battle_abi_version(void) {
+    return BATTLE_ABI_VERSION;
+}
+
+void battle_seed_thread(uint32_t seed) {
+    battle::random::Initialize(seed);
+}
+
+battle_pool* battle_pool_create(uint32_t capacity, int32_t* status) {
+    int32_t result = BATTLE_OK;
+    battle_pool* pool = nullptr;
+    if (capacity == 0) {
+        result = BATTLE_ERR_INVALID_ARGUMENT;
+    } else {
+        try {
+            pool = new battle_pool();
+            pool->engines.resize(capacity);
+            pool->started.assign(capacity, 0);
+            pool->stepped.assign(capacity, 0);
+            pool->slab.reserve(capacity);
+            pool->actions.reserve(2 * static_cast<size_t>(capacity));
+            pool->slab_step.reserve(capacity);
+        } catch (const std::bad_alloc&) {
+            delete pool;
+            pool = nullptr;
+            result = BATTLE_ERR_OUT_OF_MEMORY;
+        }
+    }
+    if (status != nullptr) {
+        *status = result;
+    }
+    return pool;
+}
+
+void battle_pool_destroy(battle_pool* pool) {
+    delete pool;
+}
+
+uint32_t battle_pool_capacity(const battle_pool* pool) {
+    return pool != nullptr ? static_cast<uint32_t>(pool->engines.size()) : 0;
+}
+
+int32_t battle_pool_init(battle_pool* pool, const uint32_t* battles, const uint8_t* teams,
+                         size_t count, int32_t* statuses) {
+    if (pool == nullptr || (count > 0 && (battles == nullptr || teams == nullptr))) {
+        return BATTLE_ERR_INVALID_ARGUMENT;
+    }
+
+    int32_t first_error = BATTLE_OK;
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* codes = teams + 2 * i * BATTLE_TEAM_CODE_SIZE;
+        battle::state::Pokemon player;
+        battle::state::Pokemon enemy;
+        if (battles[i] >= pool->engines.size()) {
+            Report(BATTLE_ERR_OUT_OF_RANGE, statuses, i, &first_error);
+        } else if (!DecodeTeam(codes, &player) ||
+                   !DecodeTeam(codes + BATTLE_TEAM_CODE_SIZE, &enemy)) {
+            Report(BATTLE_ERR_INVALID_TEAM, statuses, i, &first_error);
+        } else {
+            pool->engines[battles[i]].InitBattle(player, enemy);
+            pool->started[battles[i]] = 1;
+            Report(BATTLE_OK, statuses, i, &first_error);
+        }
+    }
+    return first_error;
+}
+
+int32_t battle_pool_step(battle_pool* pool, const battle_step* steps, size_t count,
+                         battle_step_result* results) {
+    if (pool == nullptr || (count > 0 && (steps == nullptr || results == nullptr))) {
+        return BATTLE_ERR_INVALID_ARGUMENT;
+    }
+
+    // Validate and gather the live battles into a contiguous slab
+    pool->generation++;
+    pool->slab.clear();
+    pool->actions.clear();
+    pool->slab_step.clear();
+    int32_t first_error = BATTLE_OK;
+    for (size_t i = 0; i < count; i++) {
+        const battle_step& step = steps[i];
+        battle_step_result& result = results[i];
+        result.status = BATTLE_OK;
+        result.turn = 0;
+        result.winner = BATTLE_WINNER_NONE;
+        result.reserved = 0;
+
+        if (step.battle >= pool->engines.size()) {
+            result.status = BATTLE_ERR_OUT_OF_RANGE;
+        } else if (!pool->started[step.battle]) {
+            result.status = BATTLE_ERR_NOT_STARTED;
+        } else if (pool->stepped[step.battle] == pool->generation) {
+            result.status = BATTLE_ERR_INVALID_ARGUMENT;  // Slot listed twice
+        } else if (step.player_move >= domain::NUM_MOVES ||
+                   step.enemy_move >= domain::NUM_MOVES) {
+            result.status = BATTLE_ERR_INVALID_MOVE;
+        }
+        if (result.status != BATTLE_OK) {
+            Report(result.status, nullptr, i, &first_error);
+            continue;
+        }
+
+        pool->stepped[step.battle] = pool->generation;
+        const battle::BattleEngine& engine = pool->engines[step.battle];
+        if (engine.IsBattleOver()) {
+            result.turn = engine.GetState().scheduler.turn;
+            result.winner = Winner(engine);
+            continue;
+        }
+        pool->slab.push_back(engine);
+        pool->actions.push_back(battle::BattleAction{
+            battle::ActionType::MOVE, battle::Player::PLAYER, 0,
+            static_cast<domain::Move>(step.player_move)});
+        pool->actions.push_back(battle::BattleAction{
+            battle::ActionType::MOVE, battle::Player::ENEMY, 0,
+            static_cast<domain::Move>(step.enemy_move)});
+        pool->slab_step.push_back(i);
+    }
+
+    battle::BattleEngine::StepMany(pool->slab.data(), pool->actions.data(), pool->slab.size());
+
+    // Scatter back
+    for (size_t k = 0; k < pool->slab.size(); k++) {
+        size_t i = pool->slab_step[k];
+        pool->engines[steps[i].battle] = pool->slab[k];
+        results[i].turn = pool->slab[k].GetState().scheduler.turn;
+        results[i].winner = Winner(pool->slab[k]);
+    }
+    return first_error;
+}
+
+int32_t battle_pool_observe(const battle_pool* pool, const uint32_t* battles, size_t count,
+                            uint8_t* out, size_t stride, uint32_t* sizes) {
+    if (pool == nullptr || (count > 0 && (battles == nullptr || out == nullptr))) {
+        return BATTLE_ERR_INVALID_ARGUMENT;
+    }
+
+    int32_t first_error = BATTLE_OK;
+    uint8_t buffer[battle::MAX_ENCODED_STATE_SIZE];
+    for (size_t i = 0; i < count; i++) {
+        uint8_t* observation = out + i * stride;
+        memset(observation, 0, stride);
+        uint32_t size = 0;
+        int32_t status = BATTLE_OK;
+        if (battles[i] >= pool->engines.size()) {
+            status = BATTLE_ERR_OUT_OF_RANGE;
+        } else if (!pool->started[battles[i]]) {
+            status = BATTLE_ERR_NOT_STARTED;
+        } else {
+            size_t encoded = pool->engines[battles[i]].EncodeState(buffer);
+            if (encoded > stride) {
+                status = BATTLE_ERR_BUFFER_TOO_SMALL;
+            } else {
+                memcpy(observation, buffer, encoded);
+                size = static_cast<uint32_t>(encoded);
+            }
+        }
+        if (sizes != nullptr) {
+            sizes[i] = size;
+        }
+        Report(status, nullptr, i, &first_error);
+    }
+    return first_error;
+}
+
+}  // extern "C"
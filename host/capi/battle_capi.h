@@ -0,0 +1,173 @@
+/**
+ * @file capi/battle_capi.h
+ * @brief Stable C ABI for FFI consumers (host only)
+ *
+ * Plain C entry points over pools of battles, meant for ctypes / cffi / N-API
+ * callers. Every call works on a batch, so the cost of crossing the FFI
+ * boundary is paid once per batch and not once per battle:
+ * - battle_pool_create / battle_pool_destroy: a fixed number of battle slots
+ * - battle_pool_init: start battles from pairs of team codes
+ * - battle_pool_step: one turn on each of N battles
+ * - battle_pool_observe: encoded battle states into one strided buffer
+ *
+ * Memory rules: the library never hands out memory. Pools are opaque handles;
+ * every input and output is a caller-owned buffer that is only read or written
+ * during the call. No C++ exception escapes an entry point.
+ *
+ * Versioning: BATTLE_ABI_VERSION changes whenever a signature, a struct
+ * layout, the team code layout or the observation encoding changes. Callers
+ * compare it with battle_abi_version() before using a loaded library.
+ *
+ * Threading: a pool must not be used by two threads at once; separate pools
+ * can be stepped in parallel. Chance draws come from the calling thread's
+ * random streams (battle_seed_thread).
+ */
+
+#ifndef BATTLE_CAPI_H
+#define BATTLE_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#ifdef BATTLE_CAPI_BUILD
+#define BATTLE_API __declspec(dllexport)
+#else
+#define BATTLE_API __declspec(dllimport)
+#endif
+#else
+#define BATTLE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief ABI version of this header (compare with battle_abi_version()) */
+#define BATTLE_ABI_VERSION 1
+
+/**
+ * @brief Bytes per team code
+ *
+ * A team code is one Pokemon (singles, no switching), little-endian:
+ *   0 species   1 ability   2 type1   3 type2 (255 = none)   4 level (1-100)
+ *   5 attack    6 defense   7 sp_attack   8 sp_defense   9 speed
+ *   10 item     11 reserved (0)   12-13 max HP (1-1023)   14-15 reserved (0)
+ * Ids are the engine's enum values (domain::Species, domain::Type, ...).
+ */
+#define BATTLE_TEAM_CODE_SIZE 16
+
+/** @brief Largest observation (encoded battle state) in bytes */
+#define BATTLE_MAX_OBSERVATION_SIZE 160
+
+/** @brief Status codes (0 = success, negative = error) */
+#define BATTLE_OK 0
+#define BATTLE_ERR_INVALID_ARGUMENT -1 /* Null pointer or zero capacity */
+#define BATTLE_ERR_OUT_OF_RANGE -2     /* Battle index past the pool's capacity */
+#define BATTLE_ERR_INVALID_TEAM -3     /* Team code with an unknown id or bad value */
+#define BATTLE_ERR_NOT_STARTED -4      /* Battle slot was never initialized */
+#define BATTLE_ERR_INVALID_MOVE -5     /* Move id the engine does not know */
+#define BATTLE_ERR_BUFFER_TOO_SMALL -6 /* Observation stride below the encoded size */
+#define BATTLE_ERR_OUT_OF_MEMORY -7    /* Pool allocation failed */
+
+/** @brief Battle winners */
+#define BATTLE_WINNER_NONE 0 /* Battle still running */
+#define BATTLE_WINNER_PLAYER 1
+#define BATTLE_WINNER_ENEMY 2
+#define BATTLE_WINNER_DRAW 3
+
+/** @brief Opaque pool of battle slots */
+typedef struct battle_pool battle_pool;
+
+/** @brief One turn request (8 bytes) */
+typedef struct battle_step {
+    uint32_t battle;     /* Slot index */
+    uint8_t player_move; /* domain::Move id */
+    uint8_t enemy_move;  /* domain::Move id */
+    uint8_t reserved[2]; /* Set to 0 */
+} battle_step;
+
+/** @brief One turn reply (8 bytes) */
+typedef struct battle_step_result {
+    int32_t status; /* BATTLE_OK or the error for this step (battle unchanged) */
+    uint16_t turn;  /* Battle's turn counter after the call */
+    uint8_t winner; /* BATTLE_WINNER_* */
+    uint8_t reserved;
+} battle_step_result;
+
+/**
+ * @brief ABI version of the loaded library (BATTLE_ABI_VERSION it was built with)
+ */
+BATTLE_API uint32_t battle_abi_version(void);
+
+/**
+ * @brief Seed the calling thread's random streams
+ */
+BATTLE_API void battle_seed_thread(uint32_t seed);
+
+/**
+ * @brief Create a pool of empty battle slots
+ * @param capacity Number of slots (at least 1)
+ * @param status Receives BATTLE_OK or the error (optional)
+ * @return Pool handle, or NULL on error
+ *
+ * All memory the pool needs is allocated here; stepping allocates nothing.
+ */
+BATTLE_API battle_pool* battle_pool_create(uint32_t capacity, int32_t* status);
+
+/**
+ * @brief Destroy a pool (NULL is ignored)
+ */
+BATTLE_API void battle_pool_destroy(battle_pool* pool);
+
+/**
+ * @brief Number of slots in a pool (0 for NULL)
+ */
+BATTLE_API uint32_t battle_pool_capacity(const battle_pool* pool);
+
+/**
+ * @brief Start (or restart) battles from team codes
+ * @param battles count slot indices
+ * @param teams count * 2 team codes: player then enemy of each battle
+ * @param count Number of battles
+ * @param statuses Receives one status per battle (optional)
+ * @return BATTLE_OK if every battle started, else the first error
+ *
+ * A battle whose codes are rejected keeps its previous state.
+ */
+BATTLE_API int32_t battle_pool_init(battle_pool* pool, const uint32_t* battles,
+                                    const uint8_t* teams, size_t count, int32_t* statuses);
+
+/**
+ * @brief Execute one turn on each of count battles
+ * @param steps count turn requests (one per battle; a slot may appear once)
+ * @param results Receives count replies
+ * @return BATTLE_OK if every step was valid, else the first error
+ *
+ * Battles that are already over are left unchanged. Chance draws are
+ * interleaved across the batch, so results match one-by-one stepping in
+ * distribution, not draw for draw.
+ */
+BATTLE_API int32_t battle_pool_step(battle_pool* pool, const battle_step* steps, size_t count,
+                                    battle_step_result* results);
+
+/**
+ * @brief Write the encoded state of count battles
+ * @param battles count slot indices
+ * @param out count * stride bytes; observation i starts at out + i * stride
+ * @param stride Bytes per observation (BATTLE_MAX_OBSERVATION_SIZE always fits)
+ * @param sizes Receives the encoded size of each observation (0 on error; optional)
+ * @return BATTLE_OK if every observation was written, else the first error
+ *
+ * Bytes past an observation's size are zeroed. The encoding is the engine's
+ * canonical state encoding (BattleEngine::EncodeState).
+ */
+BATTLE_API int32_t battle_pool_observe(const battle_pool* pool, const uint32_t* battles,
+                                       size_t count, uint8_t* out, size_t stride,
+                                       uint32_t* sizes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BATTLE_CAPI_H */
@@ -0,0 +1,44 @@
+# Check that a battle_capi build exports only the battle_* entry points
+# and carries no replacement of the global allocation functions.
+#
+# Usage: cmake -DNM=<nm> -DLIBRARY=<libbattle_capi.so> -P check_exports.cmake
+
+execute_process(
+    COMMAND ${NM} -D --defined-only ${LIBRARY}
+    OUTPUT_VARIABLE DYNAMIC_SYMBOLS
+    RESULT_VARIABLE NM_RESULT
+)
+if(NOT NM_RESULT EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${LIBRARY}")
+endif()
+
+string(REPLACE "\n" ";" DYNAMIC_SYMBOLS "${DYNAMIC_SYMBOLS}")
+set(EXPORTED 0)
+foreach(LINE ${DYNAMIC_SYMBOLS})
+    # "<address> <type> <name>"; the version node of the script shows up as type A
+    if(LINE MATCHES "^[0-9a-fA-F]+ ([A-Za-z]) (.+)$")
+        set(TYPE ${CMAKE_MATCH_1})
+        set(NAME ${CMAKE_MATCH_2})
+        if(TYPE STREQUAL "A")
+            continue()
+        endif()
+        if(NOT NAME MATCHES "^battle_")
+            message(FATAL_ERROR "Unexpected exported symbol: ${NAME}")
+        endif()
+        math(EXPR EXPORTED "${EXPORTED} + 1")
+    endif()
+endforeach()
+if(EXPORTED EQUAL 0)
+    message(FATAL_ERROR "No battle_* symbols exported from ${LIBRARY}")
+endif()
+
+execute_process(
+    COMMAND ${NM} --defined-only ${LIBRARY}
+    OUTPUT_VARIABLE ALL_SYMBOLS
+)
+# Replaceable operator new / new[] (plain, aligned, nothrow); placement new is inline
+if(ALL_SYMBOLS MATCHES " [TtWw] _Zn[wa][mj](St11align_val_t|RKSt9nothrow_t)*\n")
+    message(FATAL_ERROR "${LIBRARY} defines a global operator new")
+endif()
+
+message(STATUS "${LIBRARY}: ${EXPORTED} battle_* symbols exported")
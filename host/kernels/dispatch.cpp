@@ -0,0 +1,94 @@
+/**
+ * @file kernels/dispatch.cpp
+ * @brief CPU detection and kernel table selection
+ */
+
+#include "dispatch.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "variants.hpp"
+
+namespace kernels {
+
+namespace {
+
+/**
+ * @brief Variant cap from BATTLE_KERNELS (unset or unknown = no cap)
+ */
+Isa EnvironmentCap() {
+    const char* value = getenv("BATTLE_KERNELS");
+    if (value != nullptr) {
+        for (uint8_t i = 0; i < NUM_ISAS; i++) {
+            if (strcmp(value, IsaName(static_cast<Isa>(i))) == 0) {
+                return static_cast<Isa>(i);
+            }
+        }
+    }
+    return static_cast<Isa>(NUM_ISAS - 1);
+}
+
+const KernelTable& Select() {
+    Isa cap = EnvironmentCap();
+    for (int i = static_cast<int>(cap); i > 0; i--) {
+        Isa isa = static_cast<Isa>(i);
+        if (Supported(isa)) {
+            return *Table(isa);
+        }
+    }
+    return SCALAR_TABLE;
+}
+
+}  // namespace
+
+bool Supported(Isa isa) {
+    switch (isa) {
+        case Isa::Scalar:
+            return true;
+#ifdef KERNELS_HAVE_X86
+        case Isa::Avx2:
+            return __builtin_cpu_supports("avx2");
+        case Isa::Avx512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                   __builtin_cpu_supports("avx512dq");
+#endif
+        default:
+            return false;
+    }
+}
+
+const KernelTable* Table(Isa isa) {
+    switch (isa) {
+        case Isa::Scalar:
+            return &SCALAR_TABLE;
+#ifdef KERNELS_HAVE_X86
+        case Isa::Avx2:
+            return &AVX2_TABLE;
+        case Isa::Avx512:
+            return &AVX512_TABLE;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+const KernelTable& Active() {
+    static const KernelTable& active = Select();
+    return active;
+}
+
+const char* IsaName(Isa isa) {
+    switch (isa) {
+        case Isa::Scalar:
+            return "scalar";
+        case Isa::Avx2:
+            return "avx2";
+        case Isa::Avx512:
+            return "avx512";
+        default:
+            return "unknown";
+    }
+}
+
+}  // namespace kernels
@@ -0,0 +1,90 @@
+/**
+ * @file kernels/dispatch.hpp
+ * @brief Batched kernels with runtime CPU dispatch (host only)
+ *
+ * Each kernel has a scalar, an AVX2 and an AVX-512 variant, compiled into the
+ * same binary (per-file target pragmas, no special build flags):
+ * - The best variant the CPU supports is chosen once, on first use, and every
+ *   later call goes through the same KernelTable of function pointers
+ * - BATTLE_KERNELS=scalar|avx2|avx512 in the environment caps the choice
+ *   (to pin a fleet or reproduce a host)
+ * - Every variant returns exactly what the scalar one does; the scalar ones are
+ *   built on the engine's own helpers (BaseDamage, evaluation::Score)
+ *
+ * Non-x86 builds only have the scalar table. Every kernel has a consumer:
+ * analysis::RunBatch drives score and base_damage once per group of battles.
+ *
+ * Host only: the calculator build never sees these files.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "battle/evaluation.hpp"
+
+namespace kernels {
+
+/**
+ * @brief Instruction set of a kernel variant (ordered: later is wider)
+ */
+enum class Isa : uint8_t {
+    Scalar,
+    Avx2,
+    Avx512,  // AVX-512 F + BW + DQ
+    NUM_ISAS,
+};
+
+constexpr uint8_t NUM_ISAS = static_cast<uint8_t>(Isa::NUM_ISAS);
+
+/**
+ * @brief Inputs of a batched damage calculation (structure of arrays, n entries each)
+ */
+struct DamageInputs {
+    const uint8_t* power;             // Move power
+    const uint16_t* attack;           // Attack after stages and items
+    const uint16_t* defense;          // Defense after stages (at least 1)
+    const uint8_t* weather_modifier;  // Tenths (weather::MODIFIER_NEUTRAL = 1x)
+};
+
+/**
+ * @brief One variant of every kernel
+ */
+struct KernelTable {
+    Isa isa;
+
+    /**
+     * @brief commands::BaseDamage for n entries (out truncated to 16 bits like damage_dealt)
+     */
+    void (*base_damage)(const DamageInputs& in, uint16_t* out, size_t n);
+
+    /**
+     * @brief evaluation::Score for n term blocks
+     */
+    void (*score)(const battle::evaluation::Terms* terms, int16_t* out, size_t n);
+};
+
+/**
+ * @brief True if this binary has the variant and this CPU (and OS) can run it
+ */
+bool Supported(Isa isa);
+
+/**
+ * @brief A variant's table (nullptr if not built into this binary)
+ *
+ * Calling a table that is not Supported() may fault.
+ */
+const KernelTable* Table(Isa isa);
+
+/**
+ * @brief The table chosen at startup: the widest supported variant, capped by BATTLE_KERNELS
+ */
+const KernelTable& Active();
+
+/**
+ * @brief Short name ("scalar", "avx2", "avx512")
+ */
+const char* IsaName(Isa isa);
+
+}  // namespace kernels
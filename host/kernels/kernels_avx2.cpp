@@ -0,0 +1,96 @@
+/**
+ * @file kernels/kernels_avx2.cpp
+ * @brief AVX2 kernels
+ *
+ * Compiled for AVX2 with a target pragma and only called after the dispatcher
+ * has checked the CPU. Every header is included before the pragma, so no
+ * shared inline function is ever emitted with AVX2 instructions (the linker
+ * could otherwise pick that copy for the scalar path).
+ */
+
+#include <string.h>
+
+#include "variants.hpp"
+
+#ifdef KERNELS_HAVE_X86
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+#include <immintrin.h>
+
+namespace kernels {
+
+namespace {
+
+void BaseDamage(const DamageInputs& in, uint16_t* out, size_t n) {
+    // Operands stay below 2^31, so truncated double division is exact integer division
+    const __m256d base = _mm256_set1_pd(22.0);
+    const __m256d fifty = _mm256_set1_pd(50.0);
+    const __m256d neutral = _mm256_set1_pd(10.0);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m128i low_halves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1,
+                                             -1, -1);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t power_bytes;
+        int32_t modifier_bytes;
+        memcpy(&power_bytes, in.power + i, sizeof(power_bytes));
+        memcpy(&modifier_bytes, in.weather_modifier + i, sizeof(modifier_bytes));
+        __m256d power = _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(power_bytes)));
+        __m256d modifier =
+            _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(modifier_bytes)));
+        __m256d attack = _mm256_cvtepi32_pd(
+            _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in.attack + i))));
+        __m256d defense = _mm256_cvtepi32_pd(
+            _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in.defense + i))));
+
+        __m256d damage = _mm256_mul_pd(_mm256_mul_pd(base, power), attack);
+        damage = _mm256_floor_pd(_mm256_div_pd(damage, defense));
+        damage = _mm256_floor_pd(_mm256_div_pd(damage, fifty));
+        damage = _mm256_floor_pd(_mm256_div_pd(_mm256_mul_pd(damage, modifier), neutral));
+        damage = _mm256_add_pd(damage, two);  // At least 2: the minimum of 1 never binds
+
+        __m128i narrow = _mm_shuffle_epi8(_mm256_cvttpd_epi32(damage), low_halves);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), narrow);
+    }
+    scalar::BaseDamage(DamageInputs{in.power + i, in.attack + i, in.defense + i,
+                                    in.weather_modifier + i},
+                       out + i, n - i);
+}
+
+void Score(const battle::evaluation::Terms* terms, int16_t* out, size_t n) {
+    static_assert(sizeof(battle::evaluation::Terms) == 4 * sizeof(int16_t), "Packed terms");
+    const __m256i weights = _mm256_setr_epi16(
+        1, battle::evaluation::STAGE_WEIGHT, -1, -1, 1, battle::evaluation::STAGE_WEIGHT, -1, -1,
+        1, battle::evaluation::STAGE_WEIGHT, -1, -1, 1, battle::evaluation::STAGE_WEIGHT, -1, -1);
+    const __m256i gather = _mm256_setr_epi8(0, 1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, 0, 1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1);
+    const __m256i pack = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        // Weighted terms, then a wrapping 16-bit sum of each group of four
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(terms + i));
+        __m256i weighted = _mm256_mullo_epi16(v, weights);
+        __m256i pairs = _mm256_add_epi16(weighted, _mm256_srli_epi32(weighted, 16));
+        __m256i sums = _mm256_add_epi16(pairs, _mm256_srli_epi64(pairs, 32));
+        __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(sums, gather), pack);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(packed));
+    }
+    scalar::Score(terms + i, out + i, n - i);
+}
+
+}  // namespace
+
+const KernelTable AVX2_TABLE = {
+    Isa::Avx2, BaseDamage, Score,
+};
+
+}  // namespace kernels
+
+#pragma GCC pop_options
+
+#endif  // KERNELS_HAVE_X86
@@ -0,0 +1,95 @@
+/**
+ * @file kernels/kernels_avx512.cpp
+ * @brief AVX-512 (F + BW + DQ) kernels
+ *
+ * Same rules as kernels_avx2.cpp: target pragma after every header, only
+ * called once the dispatcher has checked the CPU. GCC 12's AVX-512 intrinsic
+ * headers leave their undefined passthrough operands uninitialized, which
+ * -Wmaybe-uninitialized reports once they are inlined in an optimized build,
+ * so that warning is off for the intrinsics and the bodies below.
+ */
+
+#include <string.h>
+
+#include "variants.hpp"
+
+#ifdef KERNELS_HAVE_X86
+
+#pragma GCC push_options
+#pragma GCC target("avx2,avx512f,avx512bw,avx512dq")
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#include <immintrin.h>
+
+namespace kernels {
+
+namespace {
+
+void BaseDamage(const DamageInputs& in, uint16_t* out, size_t n) {
+    // Operands stay below 2^31, so truncated double division is exact integer division
+    const __m512d base = _mm512_set1_pd(22.0);
+    const __m512d fifty = _mm512_set1_pd(50.0);
+    const __m512d neutral = _mm512_set1_pd(10.0);
+    const __m512d two = _mm512_set1_pd(2.0);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int64_t power_bytes;
+        int64_t modifier_bytes;
+        memcpy(&power_bytes, in.power + i, sizeof(power_bytes));
+        memcpy(&modifier_bytes, in.weather_modifier + i, sizeof(modifier_bytes));
+        __m512d power = _mm512_cvtepi32_pd(_mm256_cvtepu8_epi32(_mm_cvtsi64_si128(power_bytes)));
+        __m512d modifier =
+            _mm512_cvtepi32_pd(_mm256_cvtepu8_epi32(_mm_cvtsi64_si128(modifier_bytes)));
+        __m512d attack = _mm512_cvtepi32_pd(_mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.attack + i))));
+        __m512d defense = _mm512_cvtepi32_pd(_mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.defense + i))));
+
+        __m512d damage = _mm512_mul_pd(_mm512_mul_pd(base, power), attack);
+        damage = _mm512_roundscale_pd(_mm512_div_pd(damage, defense), _MM_FROUND_TO_NEG_INF);
+        damage = _mm512_roundscale_pd(_mm512_div_pd(damage, fifty), _MM_FROUND_TO_NEG_INF);
+        damage = _mm512_roundscale_pd(_mm512_div_pd(_mm512_mul_pd(damage, modifier), neutral),
+                                      _MM_FROUND_TO_NEG_INF);
+        damage = _mm512_add_pd(damage, two);  // At least 2: the minimum of 1 never binds
+
+        // Truncate to 16 bits like the scalar cast
+        __m512i wide = _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(damage));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_cvtepi64_epi16(wide));
+    }
+    scalar::BaseDamage(DamageInputs{in.power + i, in.attack + i, in.defense + i,
+                                    in.weather_modifier + i},
+                       out + i, n - i);
+}
+
+void Score(const battle::evaluation::Terms* terms, int16_t* out, size_t n) {
+    static_assert(sizeof(battle::evaluation::Terms) == 4 * sizeof(int16_t), "Packed terms");
+    const __m512i weights =
+        _mm512_set1_epi64(static_cast<int64_t>(0xffffffff00000001ULL) |
+                          (static_cast<int64_t>(battle::evaluation::STAGE_WEIGHT) << 16));
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        // Weighted terms, then a wrapping 16-bit sum of each group of four
+        __m512i v = _mm512_loadu_si512(terms + i);
+        __m512i weighted = _mm512_mullo_epi16(v, weights);
+        __m512i pairs = _mm512_add_epi16(weighted, _mm512_srli_epi32(weighted, 16));
+        __m512i sums = _mm512_add_epi16(pairs, _mm512_srli_epi64(pairs, 32));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_cvtepi64_epi16(sums));
+    }
+    scalar::Score(terms + i, out + i, n - i);
+}
+
+}  // namespace
+
+const KernelTable AVX512_TABLE = {
+    Isa::Avx512, BaseDamage, Score,
+};
+
+}  // namespace kernels
+
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+
+#endif  // KERNELS_HAVE_X86
@@ -0,0 +1,31 @@
+/**
+ * @file kernels/kernels_scalar.cpp
+ * @brief Scalar kernels (the reference every SIMD variant must match)
+ */
+
+#include "battle/commands/damage.hpp"
+#include "variants.hpp"
+
+namespace kernels {
+namespace scalar {
+
+void BaseDamage(const DamageInputs& in, uint16_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = static_cast<uint16_t>(battle::commands::BaseDamage(
+            in.power[i], in.attack[i], in.defense[i], in.weather_modifier[i]));
+    }
+}
+
+void Score(const battle::evaluation::Terms* terms, int16_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = battle::evaluation::Score(terms[i]);
+    }
+}
+
+}  // namespace scalar
+
+const KernelTable SCALAR_TABLE = {
+    Isa::Scalar, scalar::BaseDamage, scalar::Score,
+};
+
+}  // namespace kernels
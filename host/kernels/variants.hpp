@@ -0,0 +1,29 @@
+/**
+ * @file kernels/variants.hpp
+ * @brief Per-ISA kernel tables (internal to kernels/)
+ *
+ * Each variant file defines its table; the SIMD variants finish their tails
+ * with the scalar kernels declared here.
+ */
+
+#pragma once
+
+#include "dispatch.hpp"
+
+namespace kernels {
+namespace scalar {
+
+void BaseDamage(const DamageInputs& in, uint16_t* out, size_t n);
+void Score(const battle::evaluation::Terms* terms, int16_t* out, size_t n);
+
+}  // namespace scalar
+
+extern const KernelTable SCALAR_TABLE;
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_HAVE_X86 1
+extern const KernelTable AVX2_TABLE;
+extern const KernelTable AVX512_TABLE;
+#endif
+
+}  // namespace kernels
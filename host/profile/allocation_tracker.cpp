@@ -0,0 +1,286 @@
+/**
+ * @file profile/allocation_tracker.cpp
+ * @brief Scoped heap allocation counting (replaces the global operator new/delete)
+ */
+
+#include "allocation_tracker.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <new>
+
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define ALLOCATION_TRACKER_HAS_DLADDR 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define CALLER_ADDRESS() _ReturnAddress()
+#else
+#define CALLER_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace profile {
+
+namespace {
+
+// Innermost active scope on this thread (constant-initialized: safe inside operator new)
+thread_local AllocationScope* t_scope = nullptr;
+
+void CountAllocation(size_t size, const void* caller) {
+    for (AllocationScope* scope = t_scope; scope != nullptr; scope = scope->Parent()) {
+        scope->RecordAllocation(size, caller);
+    }
+}
+
+void CountFree(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    for (AllocationScope* scope = t_scope; scope != nullptr; scope = scope->Parent()) {
+        scope->RecordFree();
+    }
+}
+
+void* Allocate(size_t size, const void* caller, bool nothrow) {
+    CountAllocation(size, caller);
+    for (;;) {
+        void* pointer = malloc(size == 0 ? 1 : size);
+        if (pointer != nullptr) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            if (nothrow) {
+                return nullptr;
+            }
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* AllocateAligned(size_t size, std::align_val_t align, const void* caller, bool nothrow) {
+    CountAllocation(size, caller);
+    size_t alignment = static_cast<size_t>(align);
+    if (alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    for (;;) {
+#ifdef _WIN32
+        void* pointer = _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+        void* pointer = nullptr;
+        if (posix_memalign(&pointer, alignment, size == 0 ? 1 : size) != 0) {
+            pointer = nullptr;
+        }
+#endif
+        if (pointer != nullptr) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            if (nothrow) {
+                return nullptr;
+            }
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void Free(void* pointer) {
+    CountFree(pointer);
+    free(pointer);
+}
+
+void FreeAligned(void* pointer) {
+    CountFree(pointer);
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    free(pointer);
+#endif
+}
+
+}  // namespace
+
+AllocationScope::AllocationScope(const char* name, uint32_t sample_period)
+    : name_(name),
+      sample_period_(sample_period),
+      countdown_(sample_period),
+      active_(true),
+      parent_(t_scope),
+      counts_() {
+    t_scope = this;
+}
+
+AllocationScope::~AllocationScope() {
+    Stop();
+}
+
+const AllocationCounts& AllocationScope::Stop() {
+    if (active_) {
+        active_ = false;
+        t_scope = parent_;
+    }
+    return counts_;
+}
+
+void AllocationScope::RecordAllocation(size_t size, const void* caller) {
+    counts_.allocations++;
+    counts_.bytes += size;
+    if (sample_period_ == 0 || --countdown_ != 0) {
+        return;
+    }
+    countdown_ = sample_period_;
+
+    for (uint8_t i = 0; i < counts_.site_count; i++) {
+        if (counts_.sites[i].caller == caller) {
+            counts_.sites[i].samples++;
+            return;
+        }
+    }
+    if (counts_.site_count == MAX_ALLOCATION_SITES) {
+        counts_.sites_dropped++;
+        return;
+    }
+    counts_.sites[counts_.site_count] = AllocationSite{caller, 1};
+    counts_.site_count++;
+}
+
+bool TrackingInstalled() {
+    AllocationScope probe("TrackingInstalled", 0);
+    void* volatile pointer = ::operator new(1);
+    ::operator delete(pointer);
+    return probe.Stop().allocations == 1;
+}
+
+std::string DescribeSite(const void* caller) {
+    char line[64];
+    snprintf(line, sizeof(line), "%p", caller);
+    std::string text = line;
+#ifdef ALLOCATION_TRACKER_HAS_DLADDR
+    Dl_info info;
+    if (dladdr(caller, &info) != 0) {
+        if (info.dli_sname != nullptr) {
+            snprintf(line, sizeof(line), "+0x%zx",
+                     static_cast<size_t>(static_cast<const char*>(caller) -
+                                         static_cast<const char*>(info.dli_saddr)));
+            text += std::string(" ") + info.dli_sname + line;
+        }
+        if (info.dli_fname != nullptr) {
+            text += std::string(" (") + info.dli_fname + ")";
+        }
+    }
+#endif
+    return text;
+}
+
+std::string DescribeScope(const AllocationScope& scope) {
+    const AllocationCounts& counts = scope.Counts();
+    char line[128];
+    snprintf(line, sizeof(line), "%s: %llu allocations (%llu bytes), %llu frees\n", scope.Name(),
+             static_cast<unsigned long long>(counts.allocations),
+             static_cast<unsigned long long>(counts.bytes),
+             static_cast<unsigned long long>(counts.frees));
+    std::string text = line;
+    for (uint8_t i = 0; i < counts.site_count; i++) {
+        snprintf(line, sizeof(line), "  %u samples at ", counts.sites[i].samples);
+        text += line + DescribeSite(counts.sites[i].caller) + "\n";
+    }
+    if (counts.sites_dropped > 0) {
+        snprintf(line, sizeof(line), "  %llu samples from further sites\n",
+                 static_cast<unsigned long long>(counts.sites_dropped));
+        text += line;
+    }
+    return text;
+}
+
+}  // namespace profile
+
+// ============================================================================
+// Replaced global allocation functions
+// ============================================================================
+
+void* operator new(size_t size) {
+    return profile::Allocate(size, CALLER_ADDRESS(), false);
+}
+
+void* operator new[](size_t size) {
+    return profile::Allocate(size, CALLER_ADDRESS(), false);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return profile::Allocate(size, CALLER_ADDRESS(), true);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return profile::Allocate(size, CALLER_ADDRESS(), true);
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+    return profile::AllocateAligned(size, align, CALLER_ADDRESS(), false);
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+    return profile::AllocateAligned(size, align, CALLER_ADDRESS(), false);
+}
+
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return profile::AllocateAligned(size, align, CALLER_ADDRESS(), true);
+}
+
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return profile::AllocateAligned(size, align, CALLER_ADDRESS(), true);
+}
+
+void operator delete(void* pointer) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    profile::Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    profile::FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    profile::FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    profile::FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept {
+    profile::FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    profile::FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    profile::FreeAligned(pointer);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file profile/allocation_tracker.hpp
+ * @brief Scoped heap allocation counting with call-site sampling (host only)
+ *
+ * Guards code that must not touch the heap (the turn loop, batched stepping,
+ * rollouts, a server batch step):
+ * - Linking this file replaces the global operator new/delete with counting
+ *   wrappers over malloc/free; binaries that never use an AllocationScope do
+ *   not link it and keep the default allocator
+ * - Allocations and frees are only counted on a thread with an active scope,
+ *   and are attributed to every scope open on that thread (scopes nest)
+ * - Every sample_period-th allocation records its caller's return address in a
+ *   fixed table, so the report shows where new allocations come from
+ *
+ * The counting path itself never allocates. Outside a scope the cost is one
+ * thread-local load per allocation.
+ *
+ * Host only: replaces the global allocation functions.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace profile {
+
+/**
+ * @brief Most distinct call sites one scope records
+ */
+constexpr uint8_t MAX_ALLOCATION_SITES = 16;
+
+/**
+ * @brief One sampled allocation call site
+ */
+struct AllocationSite {
+    const void* caller;  // Return address into the code that called operator new
+    uint32_t samples;    // Sampled allocations from this site
+};
+
+/**
+ * @brief What a scope saw
+ */
+struct AllocationCounts {
+    uint64_t allocations;    // operator new calls (all forms)
+    uint64_t frees;          // operator delete calls on non-null pointers
+    uint64_t bytes;          // Bytes requested by the counted allocations
+    uint64_t sites_dropped;  // Samples whose site did not fit in the table
+    uint8_t site_count;      // Valid entries in sites
+    AllocationSite sites[MAX_ALLOCATION_SITES];
+};
+
+/**
+ * @brief Counts heap traffic on the current thread while alive (RAII)
+ *
+ * Usage:
+ *   profile::AllocationScope scope("ExecuteTurn");
+ *   engine.ExecuteTurn(player_action, enemy_action);
+ *   const profile::AllocationCounts& counts = scope.Stop();
+ *   // counts.allocations == 0, or DescribeScope(scope) lists the callers
+ *
+ * Scopes must be destroyed (or stopped) in reverse order of creation.
+ */
+class AllocationScope {
+   public:
+    /**
+     * @brief Start counting
+     * @param name Region name for reports (must outlive the scope)
+     * @param sample_period Record the call site of every n-th allocation (0 = no sites)
+     */
+    explicit AllocationScope(const char* name, uint32_t sample_period = 1);
+
+    /**
+     * @brief Stops counting if still active
+     */
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    /**
+     * @brief Stop counting (idempotent)
+     * @return The final counts
+     */
+    const AllocationCounts& Stop();
+
+    /**
+     * @brief Counts so far (still updating while the scope is active)
+     */
+    const AllocationCounts& Counts() const { return counts_; }
+
+    const char* Name() const { return name_; }
+
+    /**
+     * @brief Count one allocation (called by the replaced operator new)
+     */
+    void RecordAllocation(size_t size, const void* caller);
+
+    /**
+     * @brief Count one free (called by the replaced operator delete)
+     */
+    void RecordFree() { counts_.frees++; }
+
+    AllocationScope* Parent() const { return parent_; }
+
+   private:
+    const char* name_;
+    uint32_t sample_period_;
+    uint32_t countdown_;  // Allocations left before the next sample
+    bool active_;
+    AllocationScope* parent_;  // Enclosing scope on this thread (nullptr = outermost)
+    AllocationCounts counts_;
+};
+
+/**
+ * @brief Whether the counting allocator is linked in and active for this process
+ *
+ * Always true once this file is linked; exposed so tests can tell a real zero
+ * from an uninstrumented build.
+ */
+bool TrackingInstalled();
+
+/**
+ * @brief Human-readable call site ("symbol+0xoffset (module)" where available)
+ *
+ * Allocates: call it outside any scope.
+ */
+std::string DescribeSite(const void* caller);
+
+/**
+ * @brief Multi-line report of a scope's counts and sampled call sites
+ *
+ * Allocates: call it after the scope has stopped.
+ */
+std::string DescribeScope(const AllocationScope& scope);
+
+}  // namespace profile
@@ -0,0 +1,68 @@
+/**
+ * @file service/admission_queue.cpp
+ * @brief Bounded turn queue with admission control
+ */
+
+#include "admission_queue.hpp"
+
+namespace service {
+
+AdmissionQueue::AdmissionQueue(size_t capacity, AdmissionPolicy policy, size_t degrade_depth)
+    : ring_(capacity == 0 ? 1 : capacity),
+      head_(0),
+      size_(0),
+      policy_(policy),
+      degrade_depth_(degrade_depth) {}
+
+void AdmissionQueue::Push(const TurnRequest& request) {
+    ring_[(head_ + size_) % ring_.size()] = request;
+    size_++;
+}
+
+OfferResult AdmissionQueue::Offer(const TurnRequest& request, Clock::time_point now) {
+    OfferResult result = {Admission::Accepted, false, TurnRequest()};
+    TurnRequest admitted = request;
+    admitted.enqueued = now;
+    admitted.degraded = false;
+
+    bool full = (size_ == ring_.size());
+    switch (policy_) {
+        case AdmissionPolicy::Reject:
+            if (full) {
+                result.admission = Admission::Rejected;
+                return result;
+            }
+            break;
+        case AdmissionPolicy::ShedOldest:
+            if (full) {
+                result.shed = true;
+                Pop(&result.shed_request);
+            }
+            break;
+        case AdmissionPolicy::Degrade:
+            if (full) {
+                result.admission = Admission::Rejected;
+                return result;
+            }
+            if (size_ >= degrade_depth_) {
+                admitted.degraded = true;
+                result.admission = Admission::Degraded;
+            }
+            break;
+    }
+
+    Push(admitted);
+    return result;
+}
+
+bool AdmissionQueue::Pop(TurnRequest* out) {
+    if (size_ == 0) {
+        return false;
+    }
+    *out = ring_[head_];
+    head_ = (head_ + 1) % ring_.size();
+    size_--;
+    return true;
+}
+
+}  // namespace service
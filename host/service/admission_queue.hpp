@@ -0,0 +1,109 @@
+/**
+ * @file service/admission_queue.hpp
+ * @brief Bounded turn queue with admission control (host only)
+ *
+ * Keeps a worker's backlog bounded so queueing delay stays bounded under overload:
+ * - Reject: a full queue turns new requests away
+ * - ShedOldest: a full queue drops its oldest request to admit the new one
+ *   (the oldest has already waited longest and is the most likely to miss its SLO)
+ * - Degrade: past degrade_depth requests are admitted flagged for the cheaper
+ *   fallback AI, so the backlog drains faster; a full queue still rejects
+ *
+ * The queue is a fixed ring: no allocation after construction. It is not
+ * synchronized; the server guards each worker's queue with the worker's lock.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "battle/engine.hpp"
+
+namespace service {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief What a full (or nearly full) queue does with a new request
+ */
+enum class AdmissionPolicy : uint8_t {
+    Reject,
+    ShedOldest,
+    Degrade,
+};
+
+/**
+ * @brief One submitted turn waiting for its session's worker
+ */
+struct TurnRequest {
+    uint64_t session;
+    battle::BattleAction player_action;
+    Clock::time_point enqueued;  // Set on admission; queue delay is measured from here
+    bool degraded;               // Enemy move comes from the fallback AI
+};
+
+/**
+ * @brief Admission decision for one request
+ */
+enum class Admission : uint8_t {
+    Accepted,
+    Degraded,  // Accepted, flagged for the fallback AI
+    Rejected,
+};
+
+/**
+ * @brief Result of offering a request to the queue
+ */
+struct OfferResult {
+    Admission admission;
+    bool shed;                 // An older request was dropped to make room
+    TurnRequest shed_request;  // The dropped request (valid when shed)
+};
+
+/**
+ * @brief Fixed-capacity FIFO of turn requests with an admission policy
+ */
+class AdmissionQueue {
+   public:
+    /**
+     * @param capacity Maximum queued requests (at least 1)
+     * @param policy Admission policy
+     * @param degrade_depth Degrade: depth from which new requests are degraded
+     */
+    AdmissionQueue(size_t capacity, AdmissionPolicy policy, size_t degrade_depth);
+
+    /**
+     * @brief Offer a request; admitted requests are stamped with now
+     */
+    OfferResult Offer(const TurnRequest& request, Clock::time_point now);
+
+    /**
+     * @brief Pop the oldest request
+     * @return false if the queue is empty
+     */
+    bool Pop(TurnRequest* out);
+
+    /**
+     * @brief Oldest request without removing it (nullptr if empty)
+     */
+    const TurnRequest* Front() const { return size_ == 0 ? nullptr : &ring_[head_]; }
+
+    size_t Size() const { return size_; }
+    size_t Capacity() const { return ring_.size(); }
+    bool Empty() const { return size_ == 0; }
+
+   private:
+    void Push(const TurnRequest& request);
+
+    std::vector<TurnRequest> ring_;
+    size_t head_;  // Index of the oldest request
+    size_t size_;
+    AdmissionPolicy policy_;
+    size_t degrade_depth_;
+};
+
+}  // namespace service
@@ -0,0 +1,378 @@
+/**
+ * @file service/battle_server.cpp
+ * @brief In-process battle server with bounded per-worker queues
+ */
+
+#include "battle_server.hpp"
+
+#include "battle/random.hpp"
+#include "hibernation.hpp"
+#include "profile/allocation_tracker.hpp"
+
+namespace service {
+
+namespace {
+
+/**
+ * @brief Longest a waiting thread sleeps before rechecking its condition
+ */
+constexpr std::chrono::milliseconds WAIT_SLICE(50);
+
+uint64_t Nanoseconds(Clock::time_point from, Clock::time_point to) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+}
+
+/**
+ * @brief The policy's most likely action for the enemy
+ */
+battle::BattleAction ChooseEnemyAction(const battle::BattleEngine& engine,
+                                       analysis::Policy policy) {
+    analysis::PolicyChoice choices[analysis::MAX_POLICY_CHOICES];
+    uint8_t count = policy(engine, battle::Player::ENEMY, choices);
+    uint8_t best = 0;
+    for (uint8_t i = 1; i < count; i++) {
+        if (choices[i].probability > choices[best].probability) {
+            best = i;
+        }
+    }
+    return choices[best].action;
+}
+
+}  // namespace
+
+ServerStats::ServerStats(uint16_t sketch_k)
+    : accepted(0),
+      degraded(0),
+      rejected(0),
+      shed(0),
+      completed(0),
+      batches(0),
+      hibernations(0),
+      rehydrations(0),
+      resident_sessions(0),
+      hibernated_sessions(0),
+      hibernated_bytes(0),
+      step_allocations(0),
+      queue_ns(sketch_k),
+      execution_ns(sketch_k),
+      batch_size(sketch_k),
+      rehydrate_ns(sketch_k) {}
+
+void ServerStats::Merge(const ServerStats& other) {
+    accepted += other.accepted;
+    degraded += other.degraded;
+    rejected += other.rejected;
+    shed += other.shed;
+    completed += other.completed;
+    batches += other.batches;
+    hibernations += other.hibernations;
+    rehydrations += other.rehydrations;
+    resident_sessions += other.resident_sessions;
+    hibernated_sessions += other.hibernated_sessions;
+    hibernated_bytes += other.hibernated_bytes;
+    step_allocations += other.step_allocations;
+    queue_ns.Merge(other.queue_ns);
+    execution_ns.Merge(other.execution_ns);
+    batch_size.Merge(other.batch_size);
+    rehydrate_ns.Merge(other.rehydrate_ns);
+}
+
+BattleServer::Worker::Worker(const ServerOptions& options)
+    : queue(options.queue_capacity, options.policy, options.degrade_depth),
+      busy(false),
+      stopping(false),
+      hibernated_bytes(0),
+      stats(options.sketch_k) {}
+
+BattleServer::BattleServer(const ServerOptions& options, ReplyFn reply, void* user)
+    : options_(options), reply_(reply), user_(user) {
+    if (options_.fallback_ai == nullptr) {
+        options_.fallback_ai = options_.ai;
+    }
+    uint32_t count = options_.workers == 0 ? 1 : options_.workers;
+    for (uint32_t w = 0; w < count; w++) {
+        workers_.emplace_back(new Worker(options_));
+    }
+    for (uint32_t w = 0; w < count; w++) {
+        Worker& worker = *workers_[w];
+        worker.thread = std::thread(&BattleServer::Run, this, std::ref(worker), options_.seed + w);
+    }
+}
+
+BattleServer::~BattleServer() {
+    for (std::unique_ptr<Worker>& worker : workers_) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->stopping = true;
+        }
+        worker->work_ready.notify_one();
+    }
+    for (std::unique_ptr<Worker>& worker : workers_) {
+        worker->thread.join();
+    }
+}
+
+bool BattleServer::OpenSession(uint64_t session, const battle::state::Pokemon& player,
+                               const battle::state::Pokemon& enemy) {
+    Worker& worker = WorkerFor(session);
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        auto inserted = worker.sessions.emplace(session, Session());
+        if (!inserted.second) {
+            return false;
+        }
+        Session& opened = inserted.first->second;
+        opened.engine.reset(new battle::BattleEngine());
+        opened.engine->InitBattle(player, enemy);
+        worker.resident.push_front(session);
+        opened.resident = worker.resident.begin();
+    }
+    // The worker trims its resident set while it is otherwise idle
+    worker.work_ready.notify_one();
+    return true;
+}
+
+Admission BattleServer::SubmitTurn(uint64_t session, const battle::BattleAction& player_action) {
+    Worker& worker = WorkerFor(session);
+    TurnRequest request = {session, player_action, Clock::time_point(), false};
+
+    OfferResult offer;
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        offer = worker.queue.Offer(request, Clock::now());
+        if (offer.admission == Admission::Rejected) {
+            worker.stats.rejected++;
+            return offer.admission;
+        }
+        worker.stats.accepted++;
+        worker.stats.degraded += (offer.admission == Admission::Degraded) ? 1 : 0;
+        worker.stats.shed += offer.shed ? 1 : 0;
+    }
+    worker.work_ready.notify_one();
+
+    if (offer.shed && reply_ != nullptr) {
+        TurnResult shed = {};
+        shed.session = offer.shed_request.session;
+        shed.status = TurnStatus::Shed;
+        shed.degraded = offer.shed_request.degraded;
+        shed.queue_ns = Nanoseconds(offer.shed_request.enqueued, Clock::now());
+        reply_(user_, shed);
+    }
+    return offer.admission;
+}
+
+void BattleServer::Drain() {
+    for (std::unique_ptr<Worker>& worker : workers_) {
+        std::unique_lock<std::mutex> lock(worker->mutex);
+        while (!worker->queue.Empty() || worker->busy || OverResidentLimit(*worker)) {
+            worker->idle.wait_for(lock, WAIT_SLICE);
+        }
+    }
+}
+
+ServerStats BattleServer::Stats() const {
+    ServerStats merged(options_.sketch_k);
+    for (const std::unique_ptr<Worker>& worker : workers_) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        ServerStats snapshot = worker->stats;
+        snapshot.resident_sessions = worker->resident.size();
+        snapshot.hibernated_sessions = worker->sessions.size() - worker->resident.size();
+        snapshot.hibernated_bytes = worker->hibernated_bytes;
+        merged.Merge(snapshot);
+    }
+    return merged;
+}
+
+bool BattleServer::OverResidentLimit(const Worker& worker) const {
+    return options_.max_resident_sessions != 0 &&
+           worker.resident.size() > options_.max_resident_sessions;
+}
+
+void BattleServer::Hibernate(Worker& worker) {
+    while (OverResidentLimit(worker)) {
+        Session& session = worker.sessions.find(worker.resident.back())->second;
+        PackState(*session.engine, &session.packed);
+        session.packed.shrink_to_fit();
+        session.engine.reset();
+        worker.resident.pop_back();
+        worker.hibernated_bytes += session.packed.size();
+        worker.stats.hibernations++;
+    }
+}
+
+battle::BattleEngine* BattleServer::Rehydrate(Worker& worker, uint64_t id, Session& session) {
+    Clock::time_point start = Clock::now();
+    std::unique_ptr<battle::BattleEngine> engine(new battle::BattleEngine());
+    if (!UnpackState(session.packed, engine.get())) {
+        return nullptr;
+    }
+    worker.hibernated_bytes -= session.packed.size();
+    std::vector<uint8_t>().swap(session.packed);
+    session.engine = std::move(engine);
+    worker.resident.push_front(id);
+    session.resident = worker.resident.begin();
+    worker.stats.rehydrations++;
+    worker.stats.rehydrate_ns.Add(static_cast<double>(Nanoseconds(start, Clock::now())));
+    return session.engine.get();
+}
+
+battle::BattleEngine* BattleServer::Touch(Worker& worker, uint64_t id) {
+    auto it = worker.sessions.find(id);
+    if (it == worker.sessions.end()) {
+        return nullptr;
+    }
+    Session& session = it->second;
+    if (session.engine == nullptr) {
+        return Rehydrate(worker, id, session);
+    }
+    worker.resident.splice(worker.resident.begin(), worker.resident, session.resident);
+    return session.engine.get();
+}
+
+void BattleServer::TakeBatch(Worker& worker, Batch& batch) {
+    batch.requests.clear();
+    batch.homes.clear();
+    size_t limit = options_.max_batch == 0 ? 1 : options_.max_batch;
+
+    // One turn per session per batch: a session's next turn starts the next batch
+    const TurnRequest* front = worker.queue.Front();
+    while (front != nullptr && batch.requests.size() < limit) {
+        bool repeat = false;
+        for (const TurnRequest& taken : batch.requests) {
+            repeat = repeat || taken.session == front->session;
+        }
+        if (repeat) {
+            break;
+        }
+
+        TurnRequest request;
+        worker.queue.Pop(&request);
+        batch.homes.push_back(Touch(worker, request.session));
+        batch.requests.push_back(request);
+        front = worker.queue.Front();
+    }
+}
+
+void BattleServer::StepBatch(Batch& batch) {
+    size_t count = batch.requests.size();
+    batch.results.assign(count, TurnResult());
+    batch.slab.clear();
+    batch.actions.clear();
+    batch.slab_request.clear();
+
+    // AI pass and gather: live battles are copied into the slab with their action pair
+    for (size_t i = 0; i < count; i++) {
+        const TurnRequest& request = batch.requests[i];
+        TurnResult& result = batch.results[i];
+        result.session = request.session;
+        result.degraded = request.degraded;
+
+        battle::BattleEngine* home = batch.homes[i];
+        if (home == nullptr) {
+            result.status = TurnStatus::UnknownSession;
+            continue;
+        }
+        if (home->IsBattleOver()) {
+            result.status = TurnStatus::BattleOver;
+            result.battle_over = true;
+            result.turn = home->GetState().scheduler.turn;
+            result.state_hash = home->HashState();
+            continue;
+        }
+
+        analysis::Policy ai = request.degraded ? options_.fallback_ai : options_.ai;
+        result.enemy_action = ChooseEnemyAction(*home, ai);
+        batch.slab.push_back(*home);
+        batch.actions.push_back(request.player_action);
+        batch.actions.push_back(result.enemy_action);
+        batch.slab_request.push_back(i);
+    }
+
+    battle::BattleEngine::StepMany(batch.slab.data(), batch.actions.data(), batch.slab.size());
+
+    // Scatter the stepped engines back to their sessions
+    for (size_t k = 0; k < batch.slab.size(); k++) {
+        size_t i = batch.slab_request[k];
+        *batch.homes[i] = batch.slab[k];
+        TurnResult& result = batch.results[i];
+        result.status = TurnStatus::Done;
+        result.battle_over = batch.slab[k].IsBattleOver();
+        result.turn = batch.slab[k].GetState().scheduler.turn;
+        result.state_hash = batch.slab[k].HashState();
+    }
+}
+
+void BattleServer::Run(Worker& worker, uint32_t seed) {
+    battle::random::Initialize(seed == 0 ? 1 : seed);
+    size_t limit = options_.max_batch == 0 ? 1 : options_.max_batch;
+
+    Batch batch;
+    batch.requests.reserve(limit);
+    batch.homes.reserve(limit);
+    batch.results.reserve(limit);
+    batch.slab.reserve(limit);
+    batch.actions.reserve(2 * limit);
+    batch.slab_request.reserve(limit);
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    for (;;) {
+        while (!worker.stopping && worker.queue.Empty() && !OverResidentLimit(worker)) {
+            worker.work_ready.wait_for(lock, WAIT_SLICE);
+        }
+        if (worker.stopping) {
+            return;
+        }
+        Hibernate(worker);
+        if (worker.queue.Empty()) {
+            continue;
+        }
+
+        // Give concurrent sessions a short window to join this batch
+        if (options_.coalesce_window.count() > 0) {
+            Clock::time_point deadline = Clock::now() + options_.coalesce_window;
+            while (!worker.stopping && worker.queue.Size() < limit && Clock::now() < deadline) {
+                worker.work_ready.wait_until(lock, deadline);
+            }
+        }
+
+        TakeBatch(worker, batch);
+        worker.busy = true;
+        lock.unlock();
+
+        Clock::time_point dequeued = Clock::now();
+        uint64_t step_allocations = 0;
+        if (options_.track_allocations) {
+            profile::AllocationScope scope("BattleServer::StepBatch", 0);
+            StepBatch(batch);
+            step_allocations = scope.Stop().allocations;
+        } else {
+            StepBatch(batch);
+        }
+        Clock::time_point stepped = Clock::now();
+        for (size_t i = 0; i < batch.requests.size(); i++) {
+            batch.results[i].queue_ns = Nanoseconds(batch.requests[i].enqueued, dequeued);
+            batch.results[i].execution_ns = Nanoseconds(dequeued, stepped);
+            if (reply_ != nullptr) {
+                reply_(user_, batch.results[i]);
+            }
+        }
+
+        lock.lock();
+        for (const TurnResult& result : batch.results) {
+            worker.stats.queue_ns.Add(static_cast<double>(result.queue_ns));
+            worker.stats.execution_ns.Add(static_cast<double>(result.execution_ns));
+        }
+        worker.stats.completed += batch.results.size();
+        worker.stats.batches++;
+        worker.stats.step_allocations += step_allocations;
+        worker.stats.batch_size.Add(static_cast<double>(batch.results.size()));
+        worker.busy = false;
+        Hibernate(worker);
+        if (worker.queue.Empty()) {
+            worker.idle.notify_all();
+        }
+    }
+}
+
+}  // namespace service
@@ -0,0 +1,219 @@
+/**
+ * @file service/battle_server.hpp
+ * @brief In-process battle server with bounded per-worker queues (host only)
+ *
+ * Serves many concurrent battles (sessions) on a fixed pool of workers:
+ * - A session lives on one worker (session id modulo worker count), so its
+ *   turns run in order and its engine is only touched by that worker
+ * - Each worker has its own bounded AdmissionQueue; overload is handled at
+ *   submission by the configured policy instead of growing the backlog
+ * - The enemy's move comes from the AI policy, or the fallback AI for
+ *   degraded turns
+ * - Workers coalesce queued turns into batches: up to max_batch turns (one
+ *   per session, in queue order) are taken at once, optionally waiting
+ *   coalesce_window for concurrent sessions to join. The batch's AI moves are
+ *   chosen in one pass, its engines are gathered into a contiguous slab and
+ *   stepped with one StepMany call, then every session gets its reply
+ * - With max_resident_sessions set, each worker keeps only its most recently
+ *   used sessions as live engines; the rest are hibernated into packed form
+ *   (PackState) and rehydrated transparently when their next turn is taken
+ * - Queue delay (admission to dequeue) and execution time (dequeue to reply)
+ *   are measured separately into per-worker quantile sketches
+ * - With track_allocations set, each batch step runs inside a
+ *   profile::AllocationScope and its heap allocations are counted (expected 0)
+ *
+ * Replies are delivered through a callback on the worker thread (or on the
+ * submitting thread for shed requests).
+ *
+ * Host only: uses std::thread, std::mutex and the standard library containers.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "admission_queue.hpp"
+#include "analysis/propagation.hpp"
+#include "battle/engine.hpp"
+#include "stats/quantile_sketch.hpp"
+
+namespace service {
+
+/**
+ * @brief Server configuration
+ */
+struct ServerOptions {
+    uint32_t workers = 1;                              // Worker threads (at least 1)
+    size_t queue_capacity = 256;                       // Per-worker queue bound
+    AdmissionPolicy policy = AdmissionPolicy::Reject;  // What a full queue does
+    size_t degrade_depth = 192;                        // Degrade: depth that triggers fallback_ai
+    analysis::Policy ai = nullptr;                     // Enemy AI (most likely choice is played)
+    analysis::Policy fallback_ai = nullptr;            // Cheaper AI for degraded turns (or ai)
+    uint32_t seed = 1;                                 // Worker w seeds its RNG with seed + w
+    uint16_t max_batch = 64;                           // Most turns stepped per batch
+    std::chrono::microseconds coalesce_window{0};      // Wait for a fuller batch (0 = no wait)
+    size_t max_resident_sessions = 0;                  // Live engines per worker (0 = no limit)
+    bool track_allocations = false;                    // Count heap allocations in batch steps
+    uint16_t sketch_k = 200;                           // Latency sketch accuracy
+};
+
+/**
+ * @brief How a submitted turn ended
+ */
+enum class TurnStatus : uint8_t {
+    Done,            // Turn executed
+    Shed,            // Dropped from a full queue by a newer request (ShedOldest)
+    UnknownSession,  // No open session with this id
+    BattleOver,      // Session's battle had already ended; nothing executed
+};
+
+/**
+ * @brief Reply for one admitted turn
+ */
+struct TurnResult {
+    uint64_t session;
+    TurnStatus status;
+    bool degraded;                      // Enemy move came from the fallback AI
+    battle::BattleAction enemy_action;  // Valid when status == Done
+    bool battle_over;                   // Battle ended this turn
+    uint16_t turn;                      // Session's turn counter after the turn
+    uint64_t state_hash;                // Session state after the turn
+    uint64_t queue_ns;                  // Admission to dequeue
+    uint64_t execution_ns;              // Dequeue to reply (the whole batch's step)
+};
+
+/**
+ * @brief Reply callback (called on the worker thread)
+ */
+using ReplyFn = void (*)(void* user, const TurnResult& result);
+
+/**
+ * @brief Server counters and latency distributions (merged across workers)
+ */
+struct ServerStats {
+    explicit ServerStats(uint16_t sketch_k = 200);
+
+    uint64_t accepted;                   // Admitted (including degraded)
+    uint64_t degraded;                   // Admitted for the fallback AI
+    uint64_t rejected;                   // Turned away at submission
+    uint64_t shed;                       // Admitted, then dropped for a newer request
+    uint64_t completed;                  // Replies sent for dequeued requests
+    uint64_t batches;                    // Batches stepped
+    uint64_t hibernations;               // Sessions packed after falling out of the resident set
+    uint64_t rehydrations;               // Hibernated sessions restored for a turn
+    uint64_t resident_sessions;          // Sessions currently held as live engines
+    uint64_t hibernated_sessions;        // Sessions currently held packed
+    uint64_t hibernated_bytes;           // Packed bytes currently held
+    uint64_t step_allocations;           // Heap allocations in batch steps (track_allocations)
+    stats::QuantileSketch queue_ns;      // Queue delay of dequeued requests
+    stats::QuantileSketch execution_ns;  // Execution time of dequeued requests
+    stats::QuantileSketch batch_size;    // Turns per batch
+    stats::QuantileSketch rehydrate_ns;  // Time to restore one hibernated session
+
+    void Merge(const ServerStats& other);
+};
+
+/**
+ * @brief Battle server: sessions on a pool of workers behind bounded queues
+ */
+class BattleServer {
+   public:
+    BattleServer(const ServerOptions& options, ReplyFn reply, void* user);
+
+    /**
+     * @brief Stops the workers; requests still queued are dropped without a reply
+     */
+    ~BattleServer();
+
+    BattleServer(const BattleServer&) = delete;
+    BattleServer& operator=(const BattleServer&) = delete;
+
+    /**
+     * @brief Start a battle for a session
+     * @return false if the id is already in use
+     */
+    bool OpenSession(uint64_t session, const battle::state::Pokemon& player,
+                     const battle::state::Pokemon& enemy);
+
+    /**
+     * @brief Submit the player's action for a session's next turn
+     * @return Admission decision (Rejected requests get no reply)
+     */
+    Admission SubmitTurn(uint64_t session, const battle::BattleAction& player_action);
+
+    /**
+     * @brief Block until every worker's queue is empty, idle and within its resident limit
+     */
+    void Drain();
+
+    /**
+     * @brief Counters and latency sketches merged across workers
+     */
+    ServerStats Stats() const;
+
+    uint32_t WorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+   private:
+    /**
+     * @brief One battle on its worker: a live engine or its packed form
+     */
+    struct Session {
+        std::unique_ptr<battle::BattleEngine> engine;  // nullptr while hibernated
+        std::vector<uint8_t> packed;                   // Packed state while hibernated
+        std::list<uint64_t>::iterator resident;        // Position in Worker::resident
+    };
+
+    struct Worker {
+        explicit Worker(const ServerOptions& options);
+
+        mutable std::mutex mutex;
+        std::condition_variable work_ready;
+        std::condition_variable idle;
+        AdmissionQueue queue;
+        bool busy;
+        bool stopping;
+        std::map<uint64_t, Session> sessions;  // Only the worker thread hibernates or restores
+        std::list<uint64_t> resident;          // Live sessions, most recently used first
+        uint64_t hibernated_bytes;
+        ServerStats stats;
+        std::thread thread;
+    };
+
+    /**
+     * @brief One coalesced batch on its worker (reused between batches)
+     */
+    struct Batch {
+        std::vector<TurnRequest> requests;
+        std::vector<battle::BattleEngine*> homes;  // Session engines (nullptr = unknown)
+        std::vector<TurnResult> results;
+        std::vector<battle::BattleEngine> slab;  // Gathered engines of the live battles
+        std::vector<battle::BattleAction> actions;
+        std::vector<size_t> slab_request;  // Request index of each slab entry
+    };
+
+    Worker& WorkerFor(uint64_t session) { return *workers_[session % workers_.size()]; }
+    bool OverResidentLimit(const Worker& worker) const;
+    void Hibernate(Worker& worker);  // Packs least recently used sessions down to the limit
+    battle::BattleEngine* Rehydrate(Worker& worker, uint64_t id, Session& session);
+    battle::BattleEngine* Touch(Worker& worker, uint64_t id);  // Live engine, marked most recent
+    void Run(Worker& worker, uint32_t seed);
+    void TakeBatch(Worker& worker, Batch& batch);
+    void StepBatch(Batch& batch);
+
+    ServerOptions options_;
+    ReplyFn reply_;
+    void* user_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+}  // namespace service
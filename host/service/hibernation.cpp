@@ -0,0 +1,55 @@
+/**
+ * @file service/hibernation.cpp
+ * @brief Compact packed form of an idle battle
+ */
+
+#include "hibernation.hpp"
+
+namespace service {
+
+// Packed layout: a nonzero byte stands for itself; 0x00 n stands for n zero bytes (1-255)
+
+void PackState(const battle::BattleEngine& engine, std::vector<uint8_t>* out) {
+    uint8_t encoded[battle::MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(encoded);
+
+    out->clear();
+    size_t i = 0;
+    while (i < size) {
+        if (encoded[i] != 0) {
+            out->push_back(encoded[i++]);
+            continue;
+        }
+        uint8_t run = 0;
+        while (i < size && encoded[i] == 0 && run < 255) {
+            run++;
+            i++;
+        }
+        out->push_back(0);
+        out->push_back(run);
+    }
+}
+
+bool UnpackState(const std::vector<uint8_t>& packed, battle::BattleEngine* engine) {
+    uint8_t encoded[battle::MAX_ENCODED_STATE_SIZE];
+    size_t size = 0;
+    for (size_t i = 0; i < packed.size(); i++) {
+        size_t run = 1;
+        uint8_t value = packed[i];
+        if (value == 0) {
+            if (i + 1 >= packed.size() || packed[i + 1] == 0) {
+                return false;
+            }
+            run = packed[++i];
+        }
+        if (size + run > sizeof(encoded)) {
+            return false;
+        }
+        for (size_t k = 0; k < run; k++) {
+            encoded[size++] = value;
+        }
+    }
+    return engine->DecodeState(encoded, size);
+}
+
+}  // namespace service
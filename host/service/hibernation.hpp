@@ -0,0 +1,35 @@
+/**
+ * @file service/hibernation.hpp
+ * @brief Compact packed form of an idle battle (host only)
+ *
+ * An idle session does not need a live BattleEngine. Its state is packed into
+ * the canonical encoding (EncodeState) with runs of zero bytes collapsed:
+ * stat stages, volatile flags and the empty scheduler are mostly zero, so a
+ * typical battle packs into a few dozen bytes. Unpacking decodes the state and
+ * recomputes the evaluation terms (DecodeState).
+ *
+ * Host only: uses std::vector.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "battle/engine.hpp"
+
+namespace service {
+
+/**
+ * @brief Pack an engine's battle state (replaces the contents of out)
+ */
+void PackState(const battle::BattleEngine& engine, std::vector<uint8_t>* out);
+
+/**
+ * @brief Restore a packed battle state into an engine
+ * @return false (engine unchanged) if the bytes are not a packed state
+ */
+bool UnpackState(const std::vector<uint8_t>& packed, battle::BattleEngine* engine);
+
+}  // namespace service
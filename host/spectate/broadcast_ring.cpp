@@ -0,0 +1,102 @@
+/**
+ * @file spectate/broadcast_ring.cpp
+ * @brief Broadcast ring of battle events
+ */
+
+#include "broadcast_ring.hpp"
+
+#include <string.h>
+
+namespace spectate {
+
+namespace {
+
+static_assert(sizeof(battle::BattleEvent) == sizeof(uint64_t),
+              "Events are published as one 64-bit word");
+
+uint64_t Pack(const battle::BattleEvent& event) {
+    uint64_t word;
+    memcpy(&word, &event, sizeof(word));
+    return word;
+}
+
+battle::BattleEvent Unpack(uint64_t word) {
+    battle::BattleEvent event;
+    memcpy(&event, &word, sizeof(event));
+    return event;
+}
+
+}  // namespace
+
+BroadcastRing::BroadcastRing(uint8_t capacity_log2)
+    : capacity_(size_t{1} << capacity_log2),
+      mask_(capacity_ - 1),
+      slots_(new Slot[capacity_]),
+      snapshot_() {}
+
+void BroadcastRing::Publish(const battle::BattleEvent& event) {
+    // Only the producer writes head_, so a relaxed load sees its own last store
+    uint64_t sequence = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[sequence & mask_];
+
+    // Seqlock write: mark busy, write payload, mark complete
+    slot.version.store(2 * sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.payload.store(Pack(event), std::memory_order_relaxed);
+    slot.version.store(2 * sequence + 2, std::memory_order_release);
+
+    head_.store(sequence + 1, std::memory_order_release);
+}
+
+bool BroadcastRing::PublishSnapshot(const battle::state::BattleState& state) {
+    std::unique_lock<std::mutex> lock(snapshot_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+    snapshot_ = state;
+    snapshot_sequence_ = head_.load(std::memory_order_relaxed);
+    has_snapshot_ = true;
+    return true;
+}
+
+void BroadcastRing::Sink(void* ring, const battle::BattleEvent& event) {
+    static_cast<BroadcastRing*>(ring)->Publish(event);
+}
+
+ReadStatus BroadcastReader::Next(battle::BattleEvent* out) {
+    uint64_t head = ring_->head_.load(std::memory_order_acquire);
+    if (cursor_ == head) {
+        return ReadStatus::Empty;
+    }
+    if (head - cursor_ > ring_->capacity_) {
+        return ReadStatus::Overrun;
+    }
+
+    // Seqlock read: the slot must hold our sequence before and after the payload load
+    const BroadcastRing::Slot& slot = ring_->slots_[cursor_ & ring_->mask_];
+    uint64_t expected = 2 * cursor_ + 2;
+    uint64_t before = slot.version.load(std::memory_order_acquire);
+    uint64_t word = slot.payload.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t after = slot.version.load(std::memory_order_relaxed);
+    if (before != expected || after != expected) {
+        return ReadStatus::Overrun;  // Overwritten while we were reading
+    }
+
+    *out = Unpack(word);
+    cursor_++;
+    return ReadStatus::Ok;
+}
+
+bool BroadcastReader::Resync(battle::state::BattleState* out) {
+    std::lock_guard<std::mutex> lock(ring_->snapshot_mutex_);
+    if (!ring_->has_snapshot_) {
+        cursor_ = ring_->Head();
+        return false;
+    }
+    *out = ring_->snapshot_;
+    cursor_ = ring_->snapshot_sequence_;
+    return true;
+}
+
+}  // namespace spectate
@@ -0,0 +1,149 @@
+/**
+ * @file spectate/broadcast_ring.hpp
+ * @brief Single-producer, multi-consumer broadcast ring of battle events (host only)
+ *
+ * Fans one battle's event stream out to any number of spectators:
+ * - The engine thread publishes each event once into a fixed ring of slots,
+ *   stamped with a sequence number; it never blocks and never copies per reader
+ * - Each reader keeps its own cursor and reads at its own pace
+ * - A reader that falls more than one ring behind is told it was overrun and
+ *   resyncs from the latest published state snapshot, then replays from there
+ *
+ * Slots are seqlocks over a single 64-bit payload, so a reader racing the
+ * producer sees either the whole event or an overrun, never a torn event.
+ *
+ * Host only: uses std::atomic and std::mutex.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "battle/engine.hpp"
+#include "battle/events.hpp"
+
+namespace spectate {
+
+/**
+ * @brief Result of a reader poll
+ */
+enum class ReadStatus : uint8_t {
+    Ok,       // An event was read and the cursor advanced
+    Empty,    // The reader is caught up
+    Overrun,  // The reader fell behind and the events it needs are gone: resync
+};
+
+class BroadcastReader;
+
+/**
+ * @brief Broadcast ring (one producer thread, any number of reader threads)
+ */
+class BroadcastRing {
+   public:
+    /**
+     * @brief Create a ring
+     * @param capacity_log2 Ring holds 2^capacity_log2 events
+     */
+    explicit BroadcastRing(uint8_t capacity_log2);
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    /**
+     * @brief Publish one event (producer only; never blocks)
+     */
+    void Publish(const battle::BattleEvent& event);
+
+    /**
+     * @brief Publish a state snapshot for readers to resync from (producer only)
+     * @param state Battle state after every event published so far
+     * @return false if a reader was copying the previous snapshot (skipped, not blocked)
+     */
+    bool PublishSnapshot(const battle::state::BattleState& state);
+
+    /**
+     * @brief Event sink adapter: engine.SetEventSink(BroadcastRing::Sink, &ring)
+     */
+    static void Sink(void* ring, const battle::BattleEvent& event);
+
+    /**
+     * @brief Sequence number the next published event will get
+     */
+    uint64_t Head() const { return head_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Number of events the ring holds
+     */
+    size_t Capacity() const { return capacity_; }
+
+   private:
+    friend class BroadcastReader;
+
+    /**
+     * @brief One ring slot
+     *
+     * version = 2 * (sequence + 1) once the event with that sequence is complete,
+     * odd while the producer is overwriting the slot, 0 if never written.
+     */
+    struct Slot {
+        std::atomic<uint64_t> version{0};
+        std::atomic<uint64_t> payload{0};
+    };
+
+    size_t capacity_;
+    uint64_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> head_{0};
+
+    // Latest snapshot (only touched on the resync path)
+    std::mutex snapshot_mutex_;
+    battle::state::BattleState snapshot_;
+    uint64_t snapshot_sequence_ = 0;
+    bool has_snapshot_ = false;
+};
+
+/**
+ * @brief One spectator's view of a ring
+ */
+class BroadcastReader {
+   public:
+    /**
+     * @brief Attach to a ring, starting at the next event to be published
+     */
+    explicit BroadcastReader(BroadcastRing& ring) : ring_(&ring), cursor_(ring.Head()) {}
+
+    /**
+     * @brief Read the next event
+     * @param out Receives the event when the result is ReadStatus::Ok
+     *
+     * On Ok the event's sequence number is Cursor() - 1.
+     */
+    ReadStatus Next(battle::BattleEvent* out);
+
+    /**
+     * @brief Recover from an overrun using the latest snapshot
+     * @param out Receives the snapshot state
+     * @return true if a snapshot was copied (the cursor moves to the first event after it);
+     *         false if none was published yet (the cursor skips to the live head)
+     *
+     * If the snapshot is itself more than a ring behind, the next read overruns
+     * again; the producer should publish snapshots more often than once per ring.
+     */
+    bool Resync(battle::state::BattleState* out);
+
+    /**
+     * @brief Sequence number of the next event this reader will read
+     */
+    uint64_t Cursor() const { return cursor_; }
+
+   private:
+    BroadcastRing* ring_;
+    uint64_t cursor_;
+};
+
+}  // namespace spectate
@@ -0,0 +1,83 @@
+/**
+ * @file stats/distinct_counter.cpp
+ * @brief Mergeable distinct-count estimator (HyperLogLog)
+ */
+
+#include "distinct_counter.hpp"
+
+#include <math.h>
+
+namespace stats {
+
+namespace {
+
+constexpr uint8_t MIN_PRECISION = 4;
+constexpr uint8_t MAX_PRECISION = 18;
+
+/**
+ * @brief SplitMix64 finalizer (FNV state hashes have weak high bits)
+ */
+uint64_t Mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // namespace
+
+DistinctCounter::DistinctCounter(uint8_t precision)
+    : precision_(precision < MIN_PRECISION   ? MIN_PRECISION
+                 : precision > MAX_PRECISION ? MAX_PRECISION
+                                             : precision),
+      registers_(size_t(1) << precision_, 0) {}
+
+void DistinctCounter::Add(uint64_t hash) {
+    uint64_t x = Mix(hash);
+    size_t index = static_cast<size_t>(x >> (64 - precision_));
+
+    // Rank = position of the first set bit in the remaining bits (1-based)
+    uint64_t rest = x << precision_;
+    uint8_t max_rank = static_cast<uint8_t>(64 - precision_ + 1);
+    uint8_t rank = 1;
+    while (rank < max_rank && (rest & (1ULL << 63)) == 0) {
+        rest <<= 1;
+        rank++;
+    }
+    if (rank > registers_[index]) {
+        registers_[index] = rank;
+    }
+}
+
+bool DistinctCounter::Merge(const DistinctCounter& other) {
+    if (other.precision_ != precision_) {
+        return false;
+    }
+    for (size_t i = 0; i < registers_.size(); i++) {
+        if (other.registers_[i] > registers_[i]) {
+            registers_[i] = other.registers_[i];
+        }
+    }
+    return true;
+}
+
+double DistinctCounter::Estimate() const {
+    double m = static_cast<double>(registers_.size());
+    double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    double sum = 0;
+    size_t zeros = 0;
+    for (uint8_t r : registers_) {
+        sum += ldexp(1.0, -r);
+        zeros += (r == 0) ? 1 : 0;
+    }
+    double estimate = alpha * m * m / sum;
+
+    // Small-range correction: linear counting while registers are still empty
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * log(m / static_cast<double>(zeros));
+    }
+    return estimate;
+}
+
+}  // namespace stats
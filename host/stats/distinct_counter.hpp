@@ -0,0 +1,57 @@
+/**
+ * @file stats/distinct_counter.hpp
+ * @brief Mergeable distinct-count estimator (HyperLogLog) in fixed memory (host only)
+ *
+ * Estimates how many distinct items (e.g. battle state hashes) a stream held:
+ * - Each 64-bit hash is remixed; its top `precision` bits pick a register and
+ *   the register keeps the longest run of leading zeros seen in the rest
+ * - The estimate is the bias-corrected harmonic mean of 2^register, with
+ *   linear counting while many registers are still empty
+ * - Merging takes the per-register maximum, so per-thread counters combine
+ *   into exactly the counter a single thread would have built
+ *
+ * Memory is 2^precision bytes (precision 12: 4 KiB, about 1.6% standard error).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace stats {
+
+/**
+ * @brief HyperLogLog distinct counter
+ */
+class DistinctCounter {
+   public:
+    /**
+     * @param precision Register index bits, clamped to [4, 18]
+     */
+    explicit DistinctCounter(uint8_t precision = 12);
+
+    /**
+     * @brief Add an item by its 64-bit hash (duplicates do not change the estimate)
+     */
+    void Add(uint64_t hash);
+
+    /**
+     * @brief Fold another counter into this one
+     * @return false (and no change) if the precisions differ
+     */
+    bool Merge(const DistinctCounter& other);
+
+    /**
+     * @brief Estimated number of distinct items added
+     */
+    double Estimate() const;
+
+    uint8_t Precision() const { return precision_; }
+
+   private:
+    uint8_t precision_;
+    std::vector<uint8_t> registers_;
+};
+
+}  // namespace stats
@@ -0,0 +1,168 @@
+/**
+ * @file stats/quantile_sketch.cpp
+ * @brief Mergeable streaming quantile sketch (KLL)
+ */
+
+#include "quantile_sketch.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace stats {
+
+namespace {
+
+/**
+ * @brief Minimum capacity of any level (a compaction needs a pair)
+ */
+constexpr size_t MIN_LEVEL_CAPACITY = 2;
+
+/**
+ * @brief Capacity ratio between a level and the one above it
+ */
+constexpr double LEVEL_DECAY = 2.0 / 3.0;
+
+/**
+ * @brief xorshift64 step (compaction coin flips)
+ */
+uint64_t NextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+}  // namespace
+
+QuantileSketch::QuantileSketch(uint16_t k)
+    : k_(k < 8 ? 8 : k), count_(0), min_(0), max_(0), rng_(0x2545f4914f6cdd1dULL), levels_(1) {}
+
+size_t QuantileSketch::LevelCapacity(size_t level) const {
+    size_t depth = levels_.size() - 1 - level;
+    double capacity = k_;
+    for (size_t i = 0; i < depth; i++) {
+        capacity *= LEVEL_DECAY;
+    }
+    size_t rounded = static_cast<size_t>(capacity + 0.999);
+    return rounded < MIN_LEVEL_CAPACITY ? MIN_LEVEL_CAPACITY : rounded;
+}
+
+size_t QuantileSketch::TotalCapacity() const {
+    size_t total = 0;
+    for (size_t h = 0; h < levels_.size(); h++) {
+        total += LevelCapacity(h);
+    }
+    return total;
+}
+
+size_t QuantileSketch::RetainedItems() const {
+    size_t total = 0;
+    for (const std::vector<double>& level : levels_) {
+        total += level.size();
+    }
+    return total;
+}
+
+void QuantileSketch::Add(double value) {
+    if (count_ == 0) {
+        min_ = value;
+        max_ = value;
+    } else {
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+    count_++;
+    levels_[0].push_back(value);
+    Compress();
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other) {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (count_ == 0) {
+        min_ = other.min_;
+        max_ = other.max_;
+    } else {
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+    count_ += other.count_;
+
+    if (levels_.size() < other.levels_.size()) {
+        levels_.resize(other.levels_.size());
+    }
+    for (size_t h = 0; h < other.levels_.size(); h++) {
+        levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+    }
+    Compress();
+}
+
+void QuantileSketch::Compress() {
+    while (RetainedItems() > TotalCapacity()) {
+        // Lowest level at or over its capacity
+        size_t h = 0;
+        while (levels_[h].size() < LevelCapacity(h)) {
+            h++;
+        }
+        if (h + 1 == levels_.size()) {
+            levels_.emplace_back();
+        }
+
+        std::vector<double>& level = levels_[h];
+        std::vector<double>& above = levels_[h + 1];
+
+        // An odd item out stays behind so promoted items carry exactly double weight
+        bool odd = (level.size() % 2) != 0;
+        double leftover = odd ? level.back() : 0;
+        if (odd) {
+            level.pop_back();
+        }
+
+        std::sort(level.begin(), level.end());
+        size_t offset = NextRandom(rng_) & 1;
+        for (size_t i = offset; i < level.size(); i += 2) {
+            above.push_back(level[i]);
+        }
+        level.clear();
+        if (odd) {
+            level.push_back(leftover);
+        }
+    }
+}
+
+double QuantileSketch::Quantile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    if (q <= 0) {
+        return min_;
+    }
+    if (q >= 1) {
+        return max_;
+    }
+
+    std::vector<std::pair<double, uint64_t>> weighted;
+    weighted.reserve(RetainedItems());
+    uint64_t total = 0;
+    for (size_t h = 0; h < levels_.size(); h++) {
+        uint64_t weight = 1ULL << h;
+        for (double value : levels_[h]) {
+            weighted.emplace_back(value, weight);
+            total += weight;
+        }
+    }
+    std::sort(weighted.begin(), weighted.end());
+
+    double target = q * static_cast<double>(total);
+    uint64_t cumulative = 0;
+    for (const std::pair<double, uint64_t>& item : weighted) {
+        cumulative += item.second;
+        if (static_cast<double>(cumulative) >= target) {
+            return item.first;
+        }
+    }
+    return max_;
+}
+
+}  // namespace stats
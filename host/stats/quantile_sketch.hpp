@@ -0,0 +1,79 @@
+/**
+ * @file stats/quantile_sketch.hpp
+ * @brief Mergeable streaming quantile sketch (KLL) in bounded memory (host only)
+ *
+ * Keeps approximate quantiles of an unbounded stream without storing it:
+ * - Values enter level 0; an item at level h stands for 2^h stream values
+ * - When the sketch is full, the lowest full level is sorted and every other
+ *   item (random offset) is promoted to the next level, halving it
+ * - Level capacities shrink geometrically (2/3) below the top level, so the
+ *   sketch holds O(k) items however long the stream is
+ * - Two sketches merge by concatenating levels and compacting again, so
+ *   per-thread sketches can be combined at the end of a run
+ *
+ * Rank error is about 1.7 / k with high probability (k = 200: under 1%).
+ *
+ * Host only: uses std::vector and double precision.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace stats {
+
+/**
+ * @brief KLL quantile sketch
+ */
+class QuantileSketch {
+   public:
+    /**
+     * @param k Accuracy/size parameter (top-level capacity, at least 8)
+     */
+    explicit QuantileSketch(uint16_t k = 200);
+
+    /**
+     * @brief Add one value to the stream
+     */
+    void Add(double value);
+
+    /**
+     * @brief Fold another sketch's stream into this one
+     *
+     * The result is as accurate as a single sketch with this sketch's k.
+     */
+    void Merge(const QuantileSketch& other);
+
+    /**
+     * @brief Approximate value at rank q of the stream
+     * @param q Rank in [0, 1] (0.5 = median); clamped
+     * @return Approximate quantile (0 for an empty sketch; exact min/max at q = 0/1)
+     */
+    double Quantile(double q) const;
+
+    uint64_t Count() const { return count_; }
+    double Min() const { return min_; }
+    double Max() const { return max_; }
+
+    /**
+     * @brief Number of items currently stored (bounded by O(k))
+     */
+    size_t RetainedItems() const;
+
+   private:
+    size_t LevelCapacity(size_t level) const;
+    size_t TotalCapacity() const;
+    void Compress();
+
+    uint16_t k_;
+    uint64_t count_;
+    double min_;
+    double max_;
+    uint64_t rng_;  // Compaction coin flips (independent of the battle RNG)
+    std::vector<std::vector<double>> levels_;
+};
+
+}  // namespace stats
@@ -0,0 +1,214 @@
+/**
+ * @file verify/shadow.cpp
+ * @brief Shadow verification of fast stepping paths
+ */
+
+#include "shadow.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace verify {
+
+namespace {
+
+/**
+ * @brief Repro file header ("BFSHADOW", then the layout size for a sanity check)
+ */
+constexpr char REPRO_MAGIC[8] = {'B', 'F', 'S', 'H', 'A', 'D', 'O', 'W'};
+
+/**
+ * @brief SplitMix64 finalizer (spreads battle ids before sampling)
+ */
+uint64_t Mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // namespace
+
+ShadowVerifier::ShadowVerifier(FastStep fast, const ShadowOptions& options)
+    : fast_(fast), options_(options), stats_(), first_divergence_() {}
+
+bool ShadowVerifier::IsSampled(uint64_t battle_id) const {
+    if (options_.sample_one_in == 0) {
+        return false;
+    }
+    return Mix(battle_id ^ options_.sample_salt) % options_.sample_one_in == 0;
+}
+
+bool ShadowVerifier::StepMany(battle::BattleEngine* engines, const battle::BattleAction* actions,
+                              const uint64_t* battle_ids, size_t n) {
+    stats_.turns_stepped += n;
+    shadowed_.clear();
+    for (size_t i = 0; i < n; i++) {
+        if (IsSampled(battle_ids[i]) && !engines[i].IsBattleOver()) {
+            shadowed_.push_back(Shadowed{i, engines[i].GetState(), 0, {}});
+        }
+    }
+    if (shadowed_.empty()) {
+        fast_(engines, actions, n);
+        return true;
+    }
+    return StepShadowed(engines, actions, battle_ids, n);
+}
+
+bool ShadowVerifier::StepVerified(uint64_t battle_id, battle::BattleEngine& engine,
+                                  const battle::BattleAction& player_action,
+                                  const battle::BattleAction& enemy_action) {
+    if (engine.IsBattleOver()) {
+        return true;
+    }
+    stats_.turns_stepped++;
+
+    shadowed_.clear();
+    shadowed_.push_back(Shadowed{0, engine.GetState(), 0, {}});
+    battle::BattleAction pair[2] = {player_action, enemy_action};
+    return StepShadowed(&engine, pair, &battle_id, 1);
+}
+
+void ShadowVerifier::Observe(void* context, const void* owner, uint16_t bound, uint16_t value) {
+    ShadowVerifier& verifier = *static_cast<ShadowVerifier*>(context);
+    const battle::BattleEngine* engine = static_cast<const battle::BattleEngine*>(owner);
+    if (engine < verifier.batch_ || engine >= verifier.batch_ + verifier.batch_size_) {
+        return;
+    }
+    uint32_t slot = verifier.slots_[static_cast<size_t>(engine - verifier.batch_)];
+    if (slot == 0) {
+        return;
+    }
+
+    Shadowed& shadowed = verifier.shadowed_[slot - 1];
+    if (shadowed.draw_count < battle::random::MAX_RECORDED_DRAWS) {
+        shadowed.draws[shadowed.draw_count] = battle::random::DrawRecord{bound, value};
+    }
+    shadowed.draw_count++;
+}
+
+bool ShadowVerifier::StepShadowed(battle::BattleEngine* engines,
+                                  const battle::BattleAction* actions,
+                                  const uint64_t* battle_ids, size_t n) {
+    batch_ = engines;
+    batch_size_ = n;
+    slots_.assign(n, 0);
+    for (size_t s = 0; s < shadowed_.size(); s++) {
+        slots_[shadowed_[s].index] = static_cast<uint32_t>(s + 1);
+    }
+
+    // Fast path on the live batch, tapping the real RNG stream
+    battle::random::BeginTap(battle::random::Tap{Observe, this});
+    fast_(engines, actions, n);
+    battle::random::ResetSource();
+    batch_ = nullptr;
+    batch_size_ = 0;
+
+    bool ok = true;
+    for (const Shadowed& shadowed : shadowed_) {
+        size_t i = shadowed.index;
+        ok = Check(battle_ids[i], engines[i], shadowed, actions[2 * i], actions[2 * i + 1]) && ok;
+    }
+    return ok;
+}
+
+bool ShadowVerifier::Check(uint64_t battle_id, const battle::BattleEngine& engine,
+                           const Shadowed& shadowed, const battle::BattleAction& player_action,
+                           const battle::BattleAction& enemy_action) {
+    if (shadowed.draw_count > battle::random::MAX_RECORDED_DRAWS) {
+        stats_.turns_unverifiable++;
+        return true;
+    }
+    uint8_t draw_count = static_cast<uint8_t>(shadowed.draw_count);
+
+    ShadowRepro repro;
+    repro.battle_id = battle_id;
+    repro.before = shadowed.before;
+    repro.player_action = player_action;
+    repro.enemy_action = enemy_action;
+    repro.draw_count = draw_count;
+    for (uint8_t i = 0; i < draw_count; i++) {
+        repro.draws[i] = shadowed.draws[i].value;
+    }
+
+    // Reference path on a copy of the pre-turn state with the same draws
+    battle::BattleEngine reference;
+    reference.LoadState(shadowed.before);
+    battle::random::Script replay;
+    battle::random::BeginScript(replay, repro.draws, draw_count);
+    reference.ExecuteTurn(player_action, enemy_action);
+    uint8_t replay_count = battle::random::EndScript(replay);
+    stats_.turns_checked++;
+
+    bool same_draws = (replay_count == draw_count);
+    for (uint8_t i = 0; same_draws && i < draw_count; i++) {
+        same_draws = replay.records[i].bound == shadowed.draws[i].bound;
+    }
+    repro.fast_hash = engine.HashState();
+    repro.reference_hash = reference.HashState();
+    repro.evaluation_drift =
+        !battle::evaluation::Equal(engine.GetEvaluation(), engine.RecomputeEvaluation()) ||
+        !battle::evaluation::Equal(engine.GetEvaluation(), reference.GetEvaluation());
+
+    if (same_draws && repro.fast_hash == repro.reference_hash && !repro.evaluation_drift) {
+        return true;
+    }
+
+    if (stats_.divergences == 0) {
+        first_divergence_ = repro;
+        if (!options_.repro_path.empty()) {
+            WriteRepro(repro, options_.repro_path);
+        }
+    }
+    stats_.divergences++;
+    return false;
+}
+
+bool WriteRepro(const ShadowRepro& repro, const std::string& path) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint32_t layout = sizeof(ShadowRepro);
+    bool ok = fwrite(REPRO_MAGIC, sizeof(REPRO_MAGIC), 1, file) == 1 &&
+              fwrite(&layout, sizeof(layout), 1, file) == 1 &&
+              fwrite(&repro, sizeof(repro), 1, file) == 1;
+    return (fclose(file) == 0) && ok;
+}
+
+bool ReadRepro(const std::string& path, ShadowRepro* out) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char magic[sizeof(REPRO_MAGIC)];
+    uint32_t layout = 0;
+    bool ok = fread(magic, sizeof(magic), 1, file) == 1 &&
+              memcmp(magic, REPRO_MAGIC, sizeof(magic)) == 0 &&
+              fread(&layout, sizeof(layout), 1, file) == 1 && layout == sizeof(ShadowRepro) &&
+              fread(out, sizeof(*out), 1, file) == 1;
+    fclose(file);
+    return ok;
+}
+
+uint64_t ReplayRepro(const ShadowRepro& repro, FastStep step) {
+    battle::BattleEngine engine;
+    engine.LoadState(repro.before);
+    battle::BattleAction pair[2] = {repro.player_action, repro.enemy_action};
+
+    battle::random::Script replay;
+    battle::random::BeginScript(replay, repro.draws, repro.draw_count);
+    step(&engine, pair, 1);
+    battle::random::EndScript(replay);
+    return engine.HashState();
+}
+
+void ReferenceStep(battle::BattleEngine* engines, const battle::BattleAction* actions, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (!engines[i].IsBattleOver()) {
+            engines[i].ExecuteTurn(actions[2 * i], actions[2 * i + 1]);
+        }
+    }
+}
+
+}  // namespace verify
@@ -0,0 +1,187 @@
+/**
+ * @file verify/shadow.hpp
+ * @brief Shadow verification of fast stepping paths against the reference Engine (host only)
+ *
+ * Lets optimized stepping paths stay on in production while a sampled fraction
+ * of battles is cross-checked every turn:
+ * - A battle is sampled by hashing its id (1 in sample_one_in battles)
+ * - The whole batch runs through the fast path in one call, exactly as it would
+ *   unshadowed (same grouping, interleaving and RNG stream), while a tap
+ *   records each sampled battle's draws (random::BeginTap: draws are
+ *   attributed to the engine making them)
+ * - Each sampled battle's turn is then replayed on a copy of its pre-turn state
+ *   through the plain ExecuteTurn with its recorded draws
+ * - State hashes, draw sequences and running evaluation terms must match
+ * - The first divergence is kept (and optionally written to disk) as a minimal
+ *   repro: pre-turn state block, both actions and the draw tape
+ *
+ * Host only: uses std::string and stdio.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "battle/engine.hpp"
+#include "battle/random.hpp"
+
+namespace verify {
+
+/**
+ * @brief Fast stepping path: same contract as BattleEngine::StepMany
+ */
+using FastStep = void (*)(battle::BattleEngine* engines, const battle::BattleAction* actions,
+                          size_t n);
+
+/**
+ * @brief Shadow sampling options
+ */
+struct ShadowOptions {
+    uint32_t sample_one_in = 64;  // Shadow 1 in N battles (0 = off, 1 = every battle)
+    uint64_t sample_salt = 0;     // Changes which battles are picked
+    std::string repro_path;       // First divergence is written here ("" = keep in memory only)
+};
+
+/**
+ * @brief Minimal reproducible case for one diverging turn
+ */
+struct ShadowRepro {
+    uint64_t battle_id;
+    battle::state::BattleState before;  // State before the turn
+    battle::BattleAction player_action;
+    battle::BattleAction enemy_action;
+    uint16_t draws[battle::random::MAX_RECORDED_DRAWS];  // Draw values the fast path made
+    uint8_t draw_count;
+    uint64_t fast_hash;       // State hash after the fast path
+    uint64_t reference_hash;  // State hash after the reference Engine
+    bool evaluation_drift;    // Fast path's running evaluation differs from a recompute
+};
+
+/**
+ * @brief Shadow verification counters
+ */
+struct ShadowStats {
+    uint64_t turns_stepped;       // Battle-turns stepped (sampled or not)
+    uint64_t turns_checked;       // Sampled battle-turns cross-checked
+    uint64_t turns_unverifiable;  // Sampled turns with too many draws to replay
+    uint64_t divergences;         // Checked turns that did not match
+};
+
+/**
+ * @brief Runs batches through a fast path, shadowing sampled battles with the reference Engine
+ */
+class ShadowVerifier {
+   public:
+    explicit ShadowVerifier(FastStep fast = battle::BattleEngine::StepMany,
+                            const ShadowOptions& options = ShadowOptions());
+
+    /**
+     * @brief Whether a battle is shadowed (stable for a given id and salt)
+     */
+    bool IsSampled(uint64_t battle_id) const;
+
+    /**
+     * @brief Step a batch of battles one turn
+     * @param engines Array of n battles
+     * @param actions Array of 2n actions (player, enemy per battle)
+     * @param battle_ids Stable id per battle (drives sampling and repros)
+     * @param n Number of battles
+     * @return false if any sampled battle diverged this turn
+     *
+     * The batch goes through the fast path in one call whether or not any battle
+     * is sampled. A fast path that moves or copies engines loses the draw
+     * attribution, which shows up as a divergence.
+     */
+    bool StepMany(battle::BattleEngine* engines, const battle::BattleAction* actions,
+                  const uint64_t* battle_ids, size_t n);
+
+    /**
+     * @brief Step one battle through the fast path (alone) and check it against the reference
+     * @return false on divergence
+     *
+     * Battles that are already over are skipped (as StepMany does).
+     */
+    bool StepVerified(uint64_t battle_id, battle::BattleEngine& engine,
+                      const battle::BattleAction& player_action,
+                      const battle::BattleAction& enemy_action);
+
+    const ShadowStats& Stats() const { return stats_; }
+
+    /**
+     * @brief Whether a divergence has been seen
+     */
+    bool HasDivergence() const { return stats_.divergences > 0; }
+
+    /**
+     * @brief The first divergence seen (valid when HasDivergence())
+     */
+    const ShadowRepro& FirstDivergence() const { return first_divergence_; }
+
+   private:
+    /**
+     * @brief A sampled battle of the batch being stepped
+     */
+    struct Shadowed {
+        size_t index;                       // Position in the batch
+        battle::state::BattleState before;  // State before the turn
+        uint32_t draw_count;                // Draws made (may exceed MAX_RECORDED_DRAWS)
+        battle::random::DrawRecord draws[battle::random::MAX_RECORDED_DRAWS];  // First draws
+    };
+
+    /**
+     * @brief Tap callback: keeps a draw if a sampled battle of the current batch made it
+     */
+    static void Observe(void* context, const void* owner, uint16_t bound, uint16_t value);
+
+    /**
+     * @brief Run the batch through the fast path with the tap installed, then check shadowed_
+     */
+    bool StepShadowed(battle::BattleEngine* engines, const battle::BattleAction* actions,
+                      const uint64_t* battle_ids, size_t n);
+
+    /**
+     * @brief Replay one sampled battle on the reference Engine and compare
+     */
+    bool Check(uint64_t battle_id, const battle::BattleEngine& engine, const Shadowed& shadowed,
+               const battle::BattleAction& player_action, const battle::BattleAction& enemy_action);
+
+    FastStep fast_;
+    ShadowOptions options_;
+    ShadowStats stats_;
+    ShadowRepro first_divergence_;
+
+    // Batch being stepped (reused across batches)
+    const battle::BattleEngine* batch_ = nullptr;
+    size_t batch_size_ = 0;
+    std::vector<Shadowed> shadowed_;
+    std::vector<uint32_t> slots_;  // Per battle: 1 + index into shadowed_ (0 = not sampled)
+};
+
+/**
+ * @brief Write a repro to a file (raw state block: readable by the same build only)
+ * @return false if the file could not be written
+ */
+bool WriteRepro(const ShadowRepro& repro, const std::string& path);
+
+/**
+ * @brief Read a repro written by WriteRepro
+ * @return false if the file is missing or not a repro from this build's layout
+ */
+bool ReadRepro(const std::string& path, ShadowRepro* out);
+
+/**
+ * @brief Replay a repro through the given stepping path with its draw tape
+ * @return State hash after the turn
+ */
+uint64_t ReplayRepro(const ShadowRepro& repro, FastStep step);
+
+/**
+ * @brief Reference stepping path: ExecuteTurn on each battle (for ReplayRepro)
+ */
+void ReferenceStep(battle::BattleEngine* engines, const battle::BattleAction* actions, size_t n);
+
+}  // namespace verify
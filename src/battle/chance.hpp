@@ -0,0 +1,137 @@
+/**
+ * @file battle/chance.hpp
+ * @brief Chance events as precomputed threshold tables
+ *
+ * Every random mechanic is one table and one raw draw:
+ * - The draw is Random(denominator), made exactly once per event
+ * - Outcome i covers draws in [threshold[i-1], threshold[i]), so picking the
+ *   outcome is a few compares: no division or per-event arithmetic
+ * - An outcome's probability is its width over the denominator, so search and
+ *   tests can enumerate events exactly (Weight / denominator)
+ *
+ * Binary events put "it happens" in outcome 0: Occurs() is Roll() == 0.
+ * Engine call sites roll on their own random::Stream, so one mechanic's draws
+ * never shift another's.
+ *
+ * Based on pokeemerald:
+ * - src/battle_util.c:AtkCanceller_UnableToUseMove (full paralysis, Random() % 4; thaw, 1 in 5)
+ * - src/battle_main.c:GetWhoStrikesFirst (speed tie, Random() & 1; Quick Claw)
+ * - src/battle_script_commands.c:Cmd_setmultihitcounter (2-5 hits, 3/8 3/8 1/8 1/8)
+ * - src/battle_script_commands.c:Cmd_protectaffects (sProtectSuccessRates)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "random.hpp"
+
+namespace battle {
+namespace chance {
+
+/**
+ * @brief Maximum number of outcomes of one event
+ */
+constexpr uint8_t MAX_OUTCOMES = 4;
+
+/**
+ * @brief Cumulative threshold table for one chance event
+ */
+struct Table {
+    uint16_t denominator;              // The raw draw is in [0, denominator)
+    uint8_t outcome_count;             // Number of outcomes (at least 1)
+    uint16_t threshold[MAX_OUTCOMES];  // Cumulative; threshold[outcome_count - 1] == denominator
+};
+
+/**
+ * @brief Binary event that happens with probability numerator / denominator
+ */
+constexpr Table Binary(uint16_t numerator, uint16_t denominator) {
+    return Table{denominator, 2, {numerator, denominator, 0, 0}};
+}
+
+/**
+ * @brief Binary event that happens percent% of the time (a Random(100) roll)
+ */
+constexpr Table Percent(uint8_t percent) {
+    return Binary(percent > 100 ? 100 : percent, 100);
+}
+
+/**
+ * @brief Make the event's draw and return the outcome it falls in
+ * @param table The event
+ * @param stream Substream of the call site
+ */
+inline uint8_t Roll(const Table& table, random::Stream stream = random::Stream::General) {
+    uint16_t draw = random::Random(table.denominator, stream);
+    uint8_t outcome = 0;
+    while (outcome + 1 < table.outcome_count && draw >= table.threshold[outcome]) {
+        outcome++;
+    }
+    return outcome;
+}
+
+/**
+ * @brief Make a binary event's draw: true if it happens
+ */
+inline bool Occurs(const Table& table, random::Stream stream = random::Stream::General) {
+    return Roll(table, stream) == 0;
+}
+
+/**
+ * @brief Number of draw values that land in an outcome (probability = Weight / denominator)
+ */
+constexpr uint16_t Weight(const Table& table, uint8_t outcome) {
+    return table.threshold[outcome] - (outcome == 0 ? 0 : table.threshold[outcome - 1]);
+}
+
+// ============================================================================
+// Engine chance events
+// ============================================================================
+
+/**
+ * @brief Full paralysis: 1 in 4 (outcome 0 = cannot move)
+ */
+inline constexpr Table FULL_PARALYSIS = Binary(1, 4);
+
+/**
+ * @brief Freeze: 4 in 5 (outcome 0 = stays frozen and cannot move)
+ */
+inline constexpr Table STAYS_FROZEN = Binary(4, 5);
+
+/**
+ * @brief Speed tie: 1 in 2 (outcome 0 = player moves first)
+ */
+inline constexpr Table SPEED_TIE = Binary(1, 2);
+
+/**
+ * @brief Quick Claw activation: 20% (outcome 0 = holders move first within their priority)
+ */
+inline constexpr Table QUICK_CLAW = Percent(20);
+
+/**
+ * @brief Multi-hit count: outcome i means MULTI_HIT_MIN + i hits (2, 3: 3/8 each; 4, 5: 1/8)
+ */
+inline constexpr Table MULTI_HIT = {8, 4, {3, 6, 7, 8}};
+constexpr uint8_t MULTI_HIT_MIN = 2;
+
+/**
+ * @brief Protect success by consecutive successful uses: 100% / 2^n (outcome 0 = success)
+ *
+ * Counts past the end of the table use the last entry, which never succeeds.
+ */
+inline constexpr Table PROTECT[] = {
+    Percent(100), Percent(50), Percent(25), Percent(12),
+    Percent(6),   Percent(3),  Percent(1),  Percent(0),
+};
+constexpr uint8_t PROTECT_TABLE_SIZE = sizeof(PROTECT) / sizeof(PROTECT[0]);
+
+/**
+ * @brief Protect success table for a consecutive-use count
+ */
+inline const Table& ProtectChance(uint8_t protect_count) {
+    return PROTECT[protect_count < PROTECT_TABLE_SIZE ? protect_count : PROTECT_TABLE_SIZE - 1];
+}
+
+}  // namespace chance
+}  // namespace battle
@@ -30,7 +30,7 @@ namespace commands {
  *
  * DESIGN DECISION:
  * - Abilities are triggered via BattleContext (same pattern as move effects)
- * - Switch-in abilities affect the opponent (ctx.defender)
+ * - Switch-in abilities affect the opponent (ctx.Defender())
  * - Stat modifications use existing ModifyStatStage() command
  *
  * IMPLEMENTATION NOTES:
@@ -45,7 +45,7 @@ namespace commands {
  */
 inline void TriggerSwitchInAbilities(BattleContext& ctx) {
     // Check the Pokemon switching in (attacker) for switch-in abilities
-    switch (ctx.attacker->ability) {
+    switch (ctx.Attacker().ability) {
         case domain::Ability::Intimidate:
             // Lower opponent's Attack by 1 stage
             // Note: ModifyStatStage with affects_user=false targets defender
@@ -14,7 +14,7 @@ namespace commands {
  * @brief Check if move hits based on accuracy
  *
  * CONTRACT:
- * - Inputs: ctx.move->accuracy, ctx.attacker/defender accuracy/evasion stages
+ * - Inputs: ctx.move->accuracy, ctx.Attacker()/defender accuracy/evasion stages
  * - Outputs: Sets ctx.move_failed if miss
  * - Does: Roll against accuracy formula, check protection
  * - Does NOT: Check type immunity (separate command)
@@ -33,13 +33,13 @@ inline void AccuracyCheck(BattleContext& ctx) {
 
     // For Pass 1: always hit
     // TODO: Implement real accuracy formula:
-    // - Roll random number 1-100
+    // - Roll random number 1-100 (on random::Stream::Accuracy)
     // - Apply accuracy/evasion stage modifiers
     // - Check against move's accuracy
     // - Set ctx.move_failed = true if miss
 
     // Check if defender is protected (Protect blocks this move)
-    if (ctx.defender->is_protected) {
+    if (ctx.Defender().is_protected) {
         ctx.move_failed = true;
         return;
     }
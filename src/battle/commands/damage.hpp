@@ -8,6 +8,9 @@
 #include "../../domain/stats.hpp"
 #include "../../domain/status.hpp"
 #include "../context.hpp"
+#include "../evaluation.hpp"
+#include "../items.hpp"
+#include "../weather_tables.hpp"
 
 namespace battle {
 namespace commands {
@@ -90,11 +93,38 @@ inline int GetModifiedStat(const state::Pokemon& p, domain::Stat stat) {
     return modified_stat;
 }
 
+/**
+ * @brief Simplified Gen III damage from final stats (level 50)
+ * @param power Move power
+ * @param attack Attack after stages and items
+ * @param defense Defense after stages (at least 1)
+ * @param weather_modifier Weather modifier in tenths (weather::MODIFIER_NEUTRAL = 1x)
+ * @return Damage (at least 1)
+ *
+ * Shared by CalculateDamage and the host's batched damage kernels, so both
+ * round identically.
+ */
+inline int BaseDamage(int power, int attack, int defense, int weather_modifier) {
+    // damage = (((2 * Level / 5 + 2) * Power * A / D) / 50) + 2
+    // For level 50: damage = ((22 * Power * A / D) / 50) + 2
+    int damage = (22 * power * attack / defense) / 50;
+
+    // Weather modifier (tenths), applied before the +2 like pokeemerald
+    damage = damage * weather_modifier / weather::MODIFIER_NEUTRAL;
+    damage += 2;
+
+    // Minimum damage is 1 (unless immune, but we don't have types yet)
+    if (damage < 1) {
+        damage = 1;
+    }
+    return damage;
+}
+
 /**
  * @brief Calculate damage using simplified Gen III formula
  *
  * CONTRACT:
- * - Inputs: ctx.attacker stats, ctx.defender stats, ctx.move->power
+ * - Inputs: ctx.Attacker() stats, ctx.Defender() stats, ctx.move->power
  * - Outputs: Sets ctx.damage_dealt
  * - Does: Calculate damage with stat stages applied
  * - Does NOT: Apply the damage (that's ApplyDamage's job)
@@ -104,11 +134,13 @@ inline int GetModifiedStat(const state::Pokemon& p, domain::Stat stat) {
  * - No critical hits
  * - No type effectiveness
  * - No STAB
- * - No weather/ability/item modifiers
+ * - Weather modifier by (weather, move type) table: Rain/Sun 1.5x or 0.5x Water/Fire
+ * - Attacker's held item (Choice Band 1.5x Attack) when the battle hooks damage
+ * - No ability modifiers
  * - No random variance
  *
- * Formula: damage = (22 * power * modified_attack / modified_defense) / 50 + 2
- * (This is the Gen III formula for level 50 with all modifiers = 1)
+ * Formula: damage = (22 * power * modified_attack / modified_defense) / 50 * weather + 2
+ * (This is the Gen III formula for level 50 with all other modifiers = 1)
  *
  * Stat stages range from -6 to +6:
  * - If stage >= 0: multiplier = (2 + stage) / 2
@@ -124,28 +156,23 @@ inline void CalculateDamage(BattleContext& ctx) {
     // For now, we assume all moves are physical (Normal type is physical in Gen III)
     // TODO: Add physical/special split based on type when we add more move types
     // Get modified stats with stat stages applied
-    int attack = GetModifiedStat(*ctx.attacker, domain::STAT_ATK);
-    int defense = GetModifiedStat(*ctx.defender, domain::STAT_DEF);
-
-    // Simplified Gen III damage formula (level 50)
-    // damage = (((2 * Level / 5 + 2) * Power * A / D) / 50) + 2
-    // For level 50: damage = ((22 * Power * A / D) / 50) + 2
-    int damage = ((22 * power * attack / defense) / 50) + 2;
-
-    // Minimum damage is 1 (unless immune, but we don't have types yet)
-    if (damage < 1) {
-        damage = 1;
+    int attack = GetModifiedStat(ctx.Attacker(), domain::STAT_ATK);
+    int defense = GetModifiedStat(ctx.Defender(), domain::STAT_DEF);
+    if (ctx.state.item_hooks & items::HOOK_DAMAGE) {
+        attack = items::ModifyAttack(ctx.Attacker(), attack);
     }
 
-    ctx.damage_dealt = static_cast<uint16_t>(damage);
+    int modifier = weather::DamageModifier(ctx.state.field.weather, ctx.move->type);
+
+    ctx.damage_dealt = static_cast<uint16_t>(BaseDamage(power, attack, defense, modifier));
 }
 
 /**
  * @brief Apply calculated damage to defender
  *
  * CONTRACT:
- * - Inputs: ctx.damage_dealt, ctx.defender
- * - Outputs: Modifies ctx.defender->current_hp
+ * - Inputs: ctx.damage_dealt, ctx.Defender()
+ * - Outputs: Modifies ctx.Defender().current_hp, ctx.state.eval material term
  * - Does: Subtract damage from HP, clamp to 0
  * - Does NOT: Calculate damage, check for faint
  */
@@ -153,12 +180,17 @@ inline void ApplyDamage(BattleContext& ctx) {
     if (ctx.move_failed)
         return;
 
+    int16_t material_before = evaluation::MaterialTerm(ctx.Defender());
+
     // Subtract damage
-    if (ctx.damage_dealt >= ctx.defender->current_hp) {
-        ctx.defender->current_hp = 0;
+    if (ctx.damage_dealt >= ctx.Defender().current_hp) {
+        ctx.Defender().current_hp = 0;
     } else {
-        ctx.defender->current_hp -= ctx.damage_dealt;
+        ctx.Defender().current_hp -= ctx.damage_dealt;
     }
+
+    evaluation::UpdateMaterial(&ctx.state.eval, ctx.defender_battler, material_before,
+                               ctx.Defender());
 }
 
 }  // namespace commands
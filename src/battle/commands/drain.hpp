@@ -6,6 +6,8 @@
 #pragma once
 
 #include "../context.hpp"
+#include "../evaluation.hpp"
+#include "../items.hpp"
 
 namespace battle {
 namespace commands {
@@ -14,8 +16,8 @@ namespace commands {
  * @brief Apply drain healing to attacker based on damage dealt
  *
  * CONTRACT:
- * - Inputs: ctx.attacker, ctx.damage_dealt, drain_percent
- * - Outputs: Modifies ctx.attacker->current_hp, ctx.drain_received
+ * - Inputs: ctx.Attacker(), ctx.damage_dealt, drain_percent
+ * - Outputs: Modifies ctx.Attacker().current_hp, ctx.drain_received, ctx.state.eval material term
  * - Does: Calculate drain amount, heal attacker, clamp HP to max_hp
  * - Does NOT: Check for faint (that's CheckFaint's job)
  *
@@ -32,7 +34,7 @@ namespace commands {
  * - Cannot overheal (HP clamped to max_hp)
  * - Already at max HP: Drain still calculated, but HP remains at max
  * - Liquid Ooze ability: Reverses drain to damage (future implementation)
- * - Big Root item: Increases drain by 30% (future implementation)
+ * - Big Root item: Increases drain by 30% (after the minimum of 1)
  *
  * Based on pokeemerald: src/battle_script_commands.c (Cmd_negativedamage)
  * gBattleMoveDamage = -(gHpDealt / 2); // negative damage = healing
@@ -68,35 +70,36 @@ inline void ApplyDrain(BattleContext& ctx, uint8_t drain_percent) {
         drain_amount = 1;
     }
 
+    // Big Root: +30% healing
+    if (ctx.state.item_hooks & items::HOOK_DRAIN) {
+        drain_amount = items::ModifyDrain(ctx.Attacker(), drain_amount);
+    }
+
     // Apply drain to attacker (heal HP)
-    uint16_t new_hp = ctx.attacker->current_hp + drain_amount;
+    int16_t material_before = evaluation::MaterialTerm(ctx.Attacker());
+    uint16_t new_hp = ctx.Attacker().current_hp + drain_amount;
 
     // Clamp to max HP (cannot overheal)
-    if (new_hp > ctx.attacker->max_hp) {
-        ctx.attacker->current_hp = ctx.attacker->max_hp;
+    if (new_hp > ctx.Attacker().max_hp) {
+        ctx.Attacker().current_hp = ctx.Attacker().max_hp;
     } else {
-        ctx.attacker->current_hp = new_hp;
+        ctx.Attacker().current_hp = new_hp;
     }
+    evaluation::UpdateMaterial(&ctx.state.eval, ctx.attacker_battler, material_before,
+                               ctx.Attacker());
 
     // Store drain amount for testing/display
     ctx.drain_received = drain_amount;
 
     // TODO (future): Check Liquid Ooze ability to reverse drain
-    // if (HasAbility(ctx.defender, ABILITY_LIQUID_OOZE)) {
+    // if (HasAbility(ctx.Defender(), ABILITY_LIQUID_OOZE)) {
     //     // Reverse the healing - attacker takes damage instead
-    //     if (drain_amount >= ctx.attacker->current_hp) {
-    //         ctx.attacker->current_hp = 0;
+    //     if (drain_amount >= ctx.Attacker().current_hp) {
+    //         ctx.Attacker().current_hp = 0;
     //     } else {
-    //         ctx.attacker->current_hp -= drain_amount;
+    //         ctx.Attacker().current_hp -= drain_amount;
     //     }
     // }
-
-    // TODO (future): Check Big Root item to increase drain
-    // if (HasItem(ctx.attacker, ITEM_BIG_ROOT)) {
-    //     uint16_t bonus = (drain_amount * 30) / 100; // +30%
-    //     drain_amount += bonus;
-    //     // Apply bonus healing (still clamped to max_hp)
-    // }
 }
 
 }  // namespace commands
@@ -14,7 +14,7 @@ namespace commands {
  * @brief Check if Pokemon has fainted and set flag
  *
  * CONTRACT:
- * - Inputs: ctx.defender or ctx.attacker (based on check_attacker), current_hp
+ * - Inputs: ctx.Defender() or ctx.Attacker() (based on check_attacker), current_hp
  * - Outputs: Sets target->is_fainted if HP = 0
  * - Does: Check if HP <= 0 and set faint flag
  * - Does NOT: Process the faint (switch-in, exp, etc.) - that's Engine's job
@@ -33,7 +33,7 @@ namespace commands {
  */
 inline void CheckFaint(BattleContext& ctx, bool check_attacker = false) {
     // Select target based on check_attacker flag
-    state::Pokemon* target = check_attacker ? ctx.attacker : ctx.defender;
+    state::Pokemon* target = check_attacker ? &ctx.Attacker() : &ctx.Defender();
 
     // Set faint flag if HP is 0
     if (target->current_hp == 0) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "../context.hpp"
+#include "../evaluation.hpp"
 
 namespace battle {
 namespace commands {
@@ -14,8 +15,8 @@ namespace commands {
  * @brief Apply recoil damage to attacker based on damage dealt
  *
  * CONTRACT:
- * - Inputs: ctx.attacker, ctx.damage_dealt, recoil_percent
- * - Outputs: Modifies ctx.attacker->current_hp, ctx.recoil_dealt
+ * - Inputs: ctx.Attacker(), ctx.damage_dealt, recoil_percent
+ * - Outputs: Modifies ctx.Attacker().current_hp, ctx.recoil_dealt, ctx.state.eval material term
  * - Does: Calculate recoil damage, apply to attacker, clamp HP to 0
  * - Does NOT: Check for faint (that's CheckFaint's job)
  *
@@ -67,20 +68,23 @@ inline void ApplyRecoil(BattleContext& ctx, uint8_t recoil_percent) {
     }
 
     // Apply recoil to attacker
-    if (recoil_damage >= ctx.attacker->current_hp) {
+    int16_t material_before = evaluation::MaterialTerm(ctx.Attacker());
+    if (recoil_damage >= ctx.Attacker().current_hp) {
         // Recoil kills attacker
-        ctx.attacker->current_hp = 0;
+        ctx.Attacker().current_hp = 0;
     } else {
         // Subtract recoil from attacker HP
-        ctx.attacker->current_hp -= recoil_damage;
+        ctx.Attacker().current_hp -= recoil_damage;
     }
+    evaluation::UpdateMaterial(&ctx.state.eval, ctx.attacker_battler, material_before,
+                               ctx.Attacker());
 
     // Store recoil amount for testing/display
     ctx.recoil_dealt = recoil_damage;
 
     // TODO (future): Check Rock Head ability to prevent recoil
-    // if (HasAbility(ctx.attacker, ABILITY_ROCK_HEAD)) {
-    //     ctx.attacker->current_hp += recoil_damage; // Restore HP
+    // if (HasAbility(ctx.Attacker(), ABILITY_ROCK_HEAD)) {
+    //     ctx.Attacker().current_hp += recoil_damage; // Restore HP
     //     ctx.recoil_dealt = 0;
     // }
 }
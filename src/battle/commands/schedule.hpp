@@ -0,0 +1,95 @@
+/**
+ * @file battle/commands/schedule.hpp
+ * @brief Delayed-effect scheduling commands
+ *
+ * Commands for queuing effects on the turn-indexed scheduler and popping them
+ * when they come due at end of turn.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../state/scheduler.hpp"
+
+namespace battle {
+namespace commands {
+
+/**
+ * @brief Schedule an effect to resolve at the end of a later turn
+ *
+ * @param scheduler Scheduler to insert into
+ * @param delay Number of turns from now (0 = end of this turn)
+ * @param battler Battler the effect applies to (0 = player, 1 = enemy)
+ * @param effect Effect kind
+ * @param value Effect payload (e.g., stored damage)
+ * @return true if scheduled, false if the scheduler is full
+ *
+ * Insertion keeps the array sorted by due turn (descending). Events with the same
+ * due turn resolve in the order they were scheduled.
+ */
+inline bool ScheduleEffect(state::Scheduler& scheduler, uint8_t delay, uint8_t battler,
+                           state::ScheduledEffect effect, uint16_t value = 0) {
+    if (scheduler.count >= state::MAX_SCHEDULED_EVENTS) {
+        return false;
+    }
+
+    state::ScheduledEvent event;
+    event.due_turn = scheduler.turn + delay;
+    event.battler = battler;
+    event.effect = effect;
+    event.value = value;
+
+    // Shift later-due events' tail right until we find the insertion point.
+    // Stop at events due strictly later, so equal-turn events stay FIFO at pop time.
+    uint8_t i = scheduler.count;
+    while (i > 0 && scheduler.events[i - 1].due_turn <= event.due_turn) {
+        scheduler.events[i] = scheduler.events[i - 1];
+        i--;
+    }
+    scheduler.events[i] = event;
+    scheduler.count++;
+    return true;
+}
+
+/**
+ * @brief Pop the next effect that is due this turn
+ *
+ * @param scheduler Scheduler to pop from
+ * @param out Receives the popped event
+ * @return true if an event was due, false if nothing is due
+ *
+ * Only looks at the tail of the array, so the cost per turn is O(due events).
+ */
+inline bool PopDueEffect(state::Scheduler& scheduler, state::ScheduledEvent& out) {
+    if (scheduler.count == 0) {
+        return false;
+    }
+
+    const state::ScheduledEvent& next = scheduler.events[scheduler.count - 1];
+    if (next.due_turn > scheduler.turn) {
+        return false;
+    }
+
+    out = next;
+    scheduler.count--;
+    return true;
+}
+
+/**
+ * @brief Check whether an effect of a given kind is pending for a battler
+ *
+ * Used for "only one at a time" rules (e.g., Future Sight fails if one is pending).
+ */
+inline bool HasScheduledEffect(const state::Scheduler& scheduler, uint8_t battler,
+                               state::ScheduledEffect effect) {
+    for (uint8_t i = 0; i < scheduler.count; i++) {
+        if (scheduler.events[i].battler == battler && scheduler.events[i].effect == effect) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace commands
+}  // namespace battle
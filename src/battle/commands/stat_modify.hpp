@@ -7,6 +7,7 @@
 
 #include "../../domain/stats.hpp"
 #include "../context.hpp"
+#include "../evaluation.hpp"
 
 namespace battle {
 namespace commands {
@@ -15,8 +16,8 @@ namespace commands {
  * @brief Modify a Pokemon's stat stage
  *
  * CONTRACT:
- * - Inputs: ctx.attacker or ctx.defender (based on affects_user), stat, change amount
- * - Outputs: Modifies target->stat_stages[stat]
+ * - Inputs: ctx.Attacker() or ctx.Defender() (based on affects_user), stat, change amount
+ * - Outputs: Modifies target->stat_stages[stat], ctx.state.eval stage term
  * - Does: Clamps stat stage to -6..+6, checks if change occurred, respects protection
  * - Does NOT: Deal damage, check accuracy (already done)
  *
@@ -57,14 +58,14 @@ inline void ModifyStatStage(BattleContext& ctx, domain::Stat stat, int8_t change
 
     // Check protection: if targeting opponent and they're protected, fail
     // Self-targeting moves (affects_user = true) ignore protection
-    if (!affects_user && ctx.defender->is_protected) {
+    if (!affects_user && ctx.Defender().is_protected) {
         ctx.move_failed = true;
         return;
     }
 
     // Select target based on affects_user flag
     // This matches pokeemerald's MOVE_EFFECT_AFFECTS_USER flag behavior
-    state::Pokemon* target = affects_user ? ctx.attacker : ctx.defender;
+    state::Pokemon* target = affects_user ? &ctx.Attacker() : &ctx.Defender();
 
     // Get current stage for this stat
     int8_t current_stage = target->stat_stages[stat];
@@ -86,8 +87,10 @@ inline void ModifyStatStage(BattleContext& ctx, domain::Stat stat, int8_t change
         return;
     }
 
-    // Apply the stat stage change
+    // Apply the stat stage change (stage term moves by exactly the stage delta)
     target->stat_stages[stat] = new_stage;
+    uint8_t battler = affects_user ? ctx.attacker_battler : ctx.defender_battler;
+    ctx.state.eval.stages += evaluation::Sign(battler) * (new_stage - current_stage);
 
     // TODO (future): Set battle message
     // If change < 0: "[Pokemon]'s [Stat] fell!"
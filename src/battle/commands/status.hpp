@@ -6,8 +6,9 @@
 #pragma once
 
 #include "../../domain/status.hpp"
+#include "../chance.hpp"
 #include "../context.hpp"
-#include "../random.hpp"
+#include "../evaluation.hpp"
 
 namespace battle {
 namespace commands {
@@ -16,8 +17,8 @@ namespace commands {
  * @brief Attempt to inflict Burn status on defender
  *
  * CONTRACT:
- * - Inputs: ctx.defender, chance (0-100)
- * - Outputs: Sets ctx.defender->status1 to BURN if successful
+ * - Inputs: ctx.Defender(), chance (0-100)
+ * - Outputs: Sets ctx.Defender().status1 to BURN if successful, updates ctx.state.eval status term
  * - Does: Check immunities, roll RNG, apply burn
  * - Does NOT: Deal damage, check accuracy (already done)
  *
@@ -41,17 +42,17 @@ inline void TryApplyBurn(BattleContext& ctx, uint8_t chance) {
         return;
 
     // Guard: skip if target fainted (damage already applied)
-    if (ctx.defender->current_hp == 0)
+    if (ctx.Defender().current_hp == 0)
         return;
 
     // Check immunities
     // Fire type is immune to burn
-    if (ctx.defender->type1 == domain::Type::Fire || ctx.defender->type2 == domain::Type::Fire) {
+    if (ctx.Defender().type1 == domain::Type::Fire || ctx.Defender().type2 == domain::Type::Fire) {
         return;
     }
 
     // Already has a status condition (Sleep, Poison, Burn, etc.)
-    if (ctx.defender->status1 != 0) {
+    if (ctx.Defender().status1 != 0) {
         return;
     }
 
@@ -60,8 +61,11 @@ inline void TryApplyBurn(BattleContext& ctx, uint8_t chance) {
     // TODO (future): Check Safeguard on defender's side
 
     // Roll for burn
-    if (random::Random(100) < chance) {
-        ctx.defender->status1 = domain::Status1::BURN;
+    if (chance::Occurs(chance::Percent(chance), random::Stream::BurnChance)) {
+        int16_t status_before = evaluation::StatusTerm(ctx.Defender());
+        ctx.Defender().status1 = domain::Status1::BURN;
+        evaluation::UpdateStatus(&ctx.state.eval, ctx.defender_battler, status_before,
+                                 ctx.Defender());
         // TODO (future): Add battle message: "[Pokemon] was burned!"
     }
 }
@@ -70,8 +74,9 @@ inline void TryApplyBurn(BattleContext& ctx, uint8_t chance) {
  * @brief Attempt to inflict Paralysis status on defender
  *
  * CONTRACT:
- * - Inputs: ctx.defender, chance (0-100)
- * - Outputs: Sets ctx.defender->status1 to PARALYSIS if successful
+ * - Inputs: ctx.Defender(), chance (0-100)
+ * - Outputs: Sets ctx.Defender().status1 to PARALYSIS if successful, updates ctx.state.eval status
+ *   term
  * - Does: Check immunities, roll RNG, apply paralysis
  * - Does NOT: Deal damage, check accuracy (already done)
  *
@@ -94,22 +99,22 @@ inline void TryApplyParalysis(BattleContext& ctx, uint8_t chance) {
         return;
 
     // Guard: skip if target fainted
-    if (ctx.defender->current_hp == 0)
+    if (ctx.Defender().current_hp == 0)
         return;
 
     // Check Electric type immunity
     // In Gen III, Electric types cannot be paralyzed by Electric-type moves
     // Note: Body Slam (Normal-type) CAN paralyze Electric types
     if (ctx.move->type == domain::Type::Electric) {
-        if (ctx.defender->type1 == domain::Type::Electric ||
-            ctx.defender->type2 == domain::Type::Electric) {
+        if (ctx.Defender().type1 == domain::Type::Electric ||
+            ctx.Defender().type2 == domain::Type::Electric) {
             // TODO: Display message: "It doesn't affect [Pokemon]..."
             return;
         }
     }
 
     // Already has a status condition (Sleep, Poison, Burn, etc.)
-    if (ctx.defender->status1 != 0) {
+    if (ctx.Defender().status1 != 0) {
         return;
     }
 
@@ -117,8 +122,11 @@ inline void TryApplyParalysis(BattleContext& ctx, uint8_t chance) {
     // TODO (future): Check Safeguard on defender's side
 
     // Roll for paralysis
-    if (random::Random(100) < chance) {
-        ctx.defender->status1 = domain::Status1::PARALYSIS;
+    if (chance::Occurs(chance::Percent(chance), random::Stream::ParalysisChance)) {
+        int16_t status_before = evaluation::StatusTerm(ctx.Defender());
+        ctx.Defender().status1 = domain::Status1::PARALYSIS;
+        evaluation::UpdateStatus(&ctx.state.eval, ctx.defender_battler, status_before,
+                                 ctx.Defender());
         // TODO (future): Add battle message: "[Pokemon] was paralyzed!"
     }
 }
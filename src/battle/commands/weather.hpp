@@ -9,6 +9,7 @@
 
 #include "../../domain/weather.hpp"
 #include "../context.hpp"
+#include "../evaluation.hpp"
 
 namespace battle {
 namespace commands {
@@ -19,10 +20,12 @@ namespace commands {
  * @param weather Weather type to set
  * @param duration Duration in turns (default 5 for normal weather moves)
  *
- * Sets the weather condition. If weather is already active, it is replaced.
+ * Sets the weather condition. A different active weather is replaced; the
+ * same weather makes the move fail and keeps its remaining duration.
  * Weather duration of 0 clears weather.
  *
- * Based on pokeemerald's SetWeather function.
+ * Based on pokeemerald's SetWeather function and the Cmd_setrain / Cmd_setsunny /
+ * Cmd_setsandstorm / Cmd_sethail checks (MOVE_RESULT_MISSED if already active).
  */
 inline void SetWeather(BattleContext& ctx, domain::Weather weather, uint8_t duration = 5) {
     // Guard: check move_failed (standard command pattern)
@@ -30,9 +33,26 @@ inline void SetWeather(BattleContext& ctx, domain::Weather weather, uint8_t dura
         return;
     }
 
+    // Fail if this weather is already active (the duration is not refreshed)
+    if (weather != domain::Weather::None && ctx.state.field.weather == weather) {
+        ctx.move_failed = true;
+        return;
+    }
+
+    // Weather chip is part of the hazard term for both active Pokemon
+    int16_t attacker_before =
+        evaluation::HazardTerm(ctx.Attacker(), ctx.AttackerSide(), ctx.state.field);
+    int16_t defender_before =
+        evaluation::HazardTerm(ctx.Defender(), ctx.DefenderSide(), ctx.state.field);
+
     // Set weather state
-    ctx.field->weather = weather;
-    ctx.field->weather_duration = duration;
+    ctx.state.field.weather = weather;
+    ctx.state.field.weather_duration = duration;
+
+    evaluation::UpdateHazards(&ctx.state.eval, ctx.attacker_battler, attacker_before,
+                              ctx.Attacker(), ctx.AttackerSide(), ctx.state.field);
+    evaluation::UpdateHazards(&ctx.state.eval, ctx.defender_battler, defender_before,
+                              ctx.Defender(), ctx.DefenderSide(), ctx.state.field);
 
     // TODO: Display weather message
     // - "A sandstorm kicked up!"
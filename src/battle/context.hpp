@@ -4,6 +4,10 @@
  *
  * The BattleContext is passed to effect functions and commands.
  * It contains all the information needed to execute a move.
+ *
+ * A context is a transient view: BindContext() pairs one contiguous
+ * state::BattleState with battler indices and a move, right before the move
+ * runs. Nothing stores a context, so the state block itself stays pointer-free.
  */
 
 #pragma once
@@ -11,9 +15,9 @@
 #include <stdint.h>
 
 #include "../domain/move.hpp"
-#include "state/field.hpp"
-#include "state/pokemon.hpp"
-#include "state/side.hpp"
+#include "evaluation.hpp"
+#include "move_data.hpp"
+#include "state/battle_state.hpp"
 
 namespace battle {
 
@@ -22,15 +26,17 @@ namespace battle {
  *
  * This struct is created by the Engine and passed to effect functions.
  * Commands read from and write to this context to execute moves.
+ *
+ * The context addresses the battle by battler index: the battlers, sides,
+ * field, scheduler and evaluation terms are all reached through the one
+ * state block, so there is a single pointer to chase instead of one per part.
  */
 struct BattleContext {
     // === PROVIDED BY ENGINE (read-only to effects) ===
-    state::Pokemon* attacker;
-    state::Pokemon* defender;
-    state::Field* field;
-    state::Side* attacker_side;  // Side of the attacker
-    state::Side* defender_side;  // Side of the defender
-    const domain::MoveData* move;
+    state::BattleState& state;     // The battle the move runs in
+    uint8_t attacker_battler;      // Battler index of the attacker (0 = player, 1 = enemy)
+    uint8_t defender_battler;      // Battler index of the defender
+    const domain::MoveData* move;  // Move data (nullptr for no move)
 
     // === EXECUTION STATE (modified by commands) ===
     bool move_failed;         // Set if move fails (miss, immunity, etc.)
@@ -44,6 +50,48 @@ struct BattleContext {
     // === OVERRIDES (set by effect before CalculateDamage) ===
     uint8_t override_power;  // For variable power moves (Flail, Eruption)
     uint8_t override_type;   // For type-changing moves (Weather Ball)
+
+    state::Pokemon& Attacker() const { return state.battlers[attacker_battler]; }
+    state::Pokemon& Defender() const { return state.battlers[defender_battler]; }
+    state::Side& AttackerSide() const { return state.sides[attacker_battler]; }
+    state::Side& DefenderSide() const { return state.sides[defender_battler]; }
 };
 
+/**
+ * @brief Bind a context to a battle state block
+ *
+ * @param state The battle state block
+ * @param attacker_battler Acting battler (0 = player, 1 = enemy); the opponent defends
+ * @param move Move data (nullptr for no move)
+ * @return Context over the block with execution state reset
+ */
+inline BattleContext BindContext(state::BattleState& state, uint8_t attacker_battler,
+                                 const domain::MoveData* move) {
+    return BattleContext{
+        state, attacker_battler, state::Opponent(attacker_battler), move,
+        false,  // move_failed
+        0,      // damage_dealt
+        0,      // recoil_dealt
+        0,      // drain_received
+        false,  // critical_hit
+        4,      // effectiveness: 1.0x (normal effectiveness)
+        0,      // hit_count
+        0,      // override_power
+        0,      // override_type
+    };
+}
+
+/**
+ * @brief Bind a context to a battle state block (move data looked up in the move database)
+ *
+ * @param state The battle state block
+ * @param attacker_battler Acting battler (0 = player, 1 = enemy); the opponent defends
+ * @param move Move id (Move::None for no move)
+ */
+inline BattleContext BindContext(state::BattleState& state, uint8_t attacker_battler,
+                                 domain::Move move) {
+    return BindContext(state, attacker_battler,
+                       (move == domain::Move::None) ? nullptr : &GetMoveData(move));
+}
+
 }  // namespace battle
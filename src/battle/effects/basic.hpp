@@ -11,11 +11,13 @@
 #include "../commands/drain.hpp"
 #include "../commands/faint.hpp"
 #include "../commands/recoil.hpp"
+#include "../commands/schedule.hpp"
 #include "../commands/stat_modify.hpp"
 #include "../commands/status.hpp"
 #include "../commands/weather.hpp"
+#include "../chance.hpp"
 #include "../context.hpp"
-#include "../random.hpp"
+#include "../evaluation.hpp"
 
 namespace battle {
 namespace effects {
@@ -463,11 +465,12 @@ inline void Effect_SpecialDefenseUp2(BattleContext& ctx) {
  * This is the first **protection mechanic**, introducing the concept of blocking
  * incoming attacks with a degrading success rate on consecutive uses.
  *
- * Success rate formula:
+ * Success rate formula (chance::PROTECT, one Random(100) draw):
  * - First use: 100% (2^0 = 1)
  * - Second consecutive use: 50% (2^1 = 2)
  * - Third consecutive use: 25% (2^2 = 4)
- * - Fourth consecutive use: 12.5% (2^3 = 8)
+ * - Fourth consecutive use: 12% (2^3 = 8)
+ * - Eighth and later consecutive uses: 0%
  *
  * Key mechanics:
  * - Self-targeting (attacker protects themselves, cannot miss)
@@ -486,23 +489,17 @@ inline void Effect_SpecialDefenseUp2(BattleContext& ctx) {
  * - gProtectStructs[battler].protected flag
  */
 inline void Effect_Protect(BattleContext& ctx) {
-    // Calculate success rate: 100 / (2^protect_count)
-    // protect_count=0 → 100%, protect_count=1 → 50%, protect_count=2 → 25%, etc.
-    uint8_t denominator = 1 << ctx.attacker->protect_count;  // 2^protect_count
-    uint8_t success_rate = 100 / denominator;
-
-    // RNG check: random(100) < success_rate
-    uint8_t roll = random::Random(100);
-
-    if (roll < success_rate) {
+    // Success rate: 100 / (2^protect_count), precomputed per count
+    if (chance::Occurs(chance::ProtectChance(ctx.Attacker().protect_count),
+                       random::Stream::Protect)) {
         // Success: Set protection and increment counter
-        ctx.attacker->is_protected = true;
-        ctx.attacker->protect_count++;
+        ctx.Attacker().is_protected = true;
+        ctx.Attacker().protect_count++;
         ctx.move_failed = false;
     } else {
         // Failure: Reset counter and mark move as failed
-        ctx.attacker->protect_count = 0;
-        ctx.attacker->is_protected = false;
+        ctx.Attacker().protect_count = 0;
+        ctx.Attacker().is_protected = false;
         ctx.move_failed = true;
     }
 }
@@ -534,11 +531,12 @@ inline void Effect_Protect(BattleContext& ctx) {
  * - Fly, Dig, Bounce (charge + semi-invulnerable)
  *
  * Key mechanics:
- * - Turn 1: No damage, sets charging state
+ * - Turn 1: No damage, sets charging state, schedules ChargeExpire for the end of Turn 2
  * - Turn 2: Full damage calculation (120 power)
  * - Accuracy checked on Turn 2 only
  * - If move misses, charging is still consumed
- * - Future: Sunny Day skips charging (not implemented yet)
+ * - Sun: no charging turn, attacks immediately
+ * - Rain, Sandstorm, Hail: power halved
  *
  * Example moves:
  * - Solar Beam (120 power, 100 accuracy, Grass type)
@@ -550,25 +548,36 @@ inline void Effect_Protect(BattleContext& ctx) {
  * - data/battle_scripts_1.s:1903-1918 (BattleScript_EffectSolarBeam)
  * - data/battle_scripts_1.s:785-803 (Charging turn logic)
  * - STATUS2_MULTIPLETURNS flag (bit 12)
+ * - src/pokemon.c:CalculateBaseDamage (Solar Beam halved in non-sun weather)
  */
 inline void Effect_SolarBeam(BattleContext& ctx) {
-    // Turn 1: Start charging
-    if (!ctx.attacker->is_charging) {
-        ctx.attacker->is_charging = true;
-        ctx.attacker->charging_move = domain::Move::SolarBeam;
+    domain::Weather weather = ctx.state.field.weather;
+
+    // Turn 1: Start charging (skipped entirely in sun)
+    if (!ctx.Attacker().is_charging && weather != domain::Weather::Sun) {
+        ctx.Attacker().is_charging = true;
+        ctx.Attacker().charging_move = domain::Move::SolarBeam;
         ctx.move_failed = false;  // Move succeeded in starting
+        // Drop the charge at end of next turn if it was never released
+        commands::ScheduleEffect(ctx.state.scheduler, 1, ctx.attacker_battler,
+                                 state::ScheduledEffect::ChargeExpire);
         // No damage dealt on charging turn
         return;
     }
 
     // Turn 2: Execute attack
-    ctx.attacker->is_charging = false;  // Clear charging flag
+    ctx.Attacker().is_charging = false;  // Clear charging flag
 
     // Standard damage sequence
     commands::AccuracyCheck(ctx);
     if (ctx.move_failed)
         return;
 
+    // Any weather other than sun weakens Solar Beam
+    if (weather != domain::Weather::None && weather != domain::Weather::Sun) {
+        ctx.override_power = ctx.move->power / 2;
+    }
+
     commands::CalculateDamage(ctx);
     commands::ApplyDamage(ctx);
     commands::CheckFaint(ctx);
@@ -620,20 +629,23 @@ inline void Effect_SolarBeam(BattleContext& ctx) {
  */
 inline void Effect_Fly(BattleContext& ctx) {
     // Turn 1: Fly up into the air (become semi-invulnerable)
-    if (!ctx.attacker->is_charging) {
-        ctx.attacker->is_charging = true;
-        ctx.attacker->charging_move = domain::Move::Fly;
-        ctx.attacker->is_semi_invulnerable = true;
-        ctx.attacker->semi_invulnerable_type = state::SemiInvulnerableType::OnAir;
+    if (!ctx.Attacker().is_charging) {
+        ctx.Attacker().is_charging = true;
+        ctx.Attacker().charging_move = domain::Move::Fly;
+        ctx.Attacker().is_semi_invulnerable = true;
+        ctx.Attacker().semi_invulnerable_type = state::SemiInvulnerableType::OnAir;
         ctx.move_failed = false;  // Move succeeded in starting
+        // Fall back down at end of next turn if the attack was never released
+        commands::ScheduleEffect(ctx.state.scheduler, 1, ctx.attacker_battler,
+                                 state::ScheduledEffect::ChargeExpire);
         // No damage dealt on fly-up turn
         return;
     }
 
     // Turn 2: Attack from the air (clear semi-invulnerable state)
-    ctx.attacker->is_charging = false;           // Clear charging flag
-    ctx.attacker->is_semi_invulnerable = false;  // Clear semi-invulnerable flag
-    ctx.attacker->semi_invulnerable_type = state::SemiInvulnerableType::None;
+    ctx.Attacker().is_charging = false;           // Clear charging flag
+    ctx.Attacker().is_semi_invulnerable = false;  // Clear semi-invulnerable flag
+    ctx.Attacker().semi_invulnerable_type = state::SemiInvulnerableType::None;
 
     // Standard damage sequence
     commands::AccuracyCheck(ctx);
@@ -684,27 +696,30 @@ inline void Effect_Fly(BattleContext& ctx) {
  */
 inline void Effect_Substitute(BattleContext& ctx) {
     // Check if already has substitute
-    if (ctx.attacker->has_substitute) {
+    if (ctx.Attacker().has_substitute) {
         ctx.move_failed = true;
         return;
     }
 
     // Calculate HP cost (25% of max HP, minimum 1)
-    uint16_t cost = ctx.attacker->max_hp / 4;
+    uint16_t cost = ctx.Attacker().max_hp / 4;
     if (cost == 0) {
         cost = 1;  // Minimum cost
     }
 
     // Check if can afford the cost (need STRICTLY GREATER than cost)
-    if (ctx.attacker->current_hp <= cost) {
+    if (ctx.Attacker().current_hp <= cost) {
         ctx.move_failed = true;
         return;
     }
 
     // Create substitute
-    ctx.attacker->current_hp -= cost;  // Deduct HP
-    ctx.attacker->has_substitute = true;
-    ctx.attacker->substitute_hp = cost;
+    int16_t material_before = evaluation::MaterialTerm(ctx.Attacker());
+    ctx.Attacker().current_hp -= cost;  // Deduct HP
+    evaluation::UpdateMaterial(&ctx.state.eval, ctx.attacker_battler, material_before,
+                               ctx.Attacker());
+    ctx.Attacker().has_substitute = true;
+    ctx.Attacker().substitute_hp = cost;
     ctx.move_failed = false;  // Success
 }
 
@@ -752,9 +767,11 @@ inline void Effect_Substitute(BattleContext& ctx) {
 inline void Effect_BatonPass(BattleContext& ctx) {
     // Transfer all stat stages from attacker to defender
     // In full implementation, defender would be the incoming Pokemon
+    int16_t stages_before = evaluation::StageTerm(ctx.Defender());
     for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
-        ctx.defender->stat_stages[i] = ctx.attacker->stat_stages[i];
+        ctx.Defender().stat_stages[i] = ctx.Attacker().stat_stages[i];
     }
+    evaluation::UpdateStages(&ctx.state.eval, ctx.defender_battler, stages_before, ctx.Defender());
 
     ctx.move_failed = false;  // Always succeeds
 }
@@ -809,18 +826,10 @@ inline void Effect_MultiHit(BattleContext& ctx) {
         return;
     }
 
-    // Determine hit count using pokeemerald's algorithm
-    // First roll: 0-3
-    uint8_t roll = random::Random(4);
-
-    uint8_t hit_count;
-    if (roll > 1) {
-        // 2 or 3 on first roll → second roll for 2-5
-        hit_count = random::Random(4) + 2;  // 2-5
-    } else {
-        // 0 or 1 on first roll → add 2 for 2-3
-        hit_count = roll + 2;  // 2-3
-    }
+    // Determine hit count: pokeemerald's two Random() % 4 rolls folded into one draw
+    // (2 or 3 hits: 3/8 each, 4 or 5 hits: 1/8 each)
+    uint8_t hit_count =
+        chance::MULTI_HIT_MIN + chance::Roll(chance::MULTI_HIT, random::Stream::MultiHit);
 
     ctx.hit_count = 0;          // Track actual hits landed
     uint16_t total_damage = 0;  // Accumulate damage across all hits
@@ -836,14 +845,14 @@ inline void Effect_MultiHit(BattleContext& ctx) {
         ctx.hit_count++;
 
         // Early exit if defender fainted
-        if (ctx.defender->current_hp == 0) {
-            ctx.defender->is_fainted = true;
+        if (ctx.Defender().current_hp == 0) {
+            ctx.Defender().is_fainted = true;
             break;
         }
 
         // Early exit if attacker fainted (shouldn't happen for Fury Attack, but safety check)
-        if (ctx.attacker->current_hp == 0) {
-            ctx.attacker->is_fainted = true;
+        if (ctx.Attacker().current_hp == 0) {
+            ctx.Attacker().is_fainted = true;
             break;
         }
     }
@@ -871,7 +880,7 @@ inline void Effect_MultiHit(BattleContext& ctx) {
  * - Replaces current weather (weather doesn't stack)
  * - Duration counter decrements each turn
  * - Weather ends when duration reaches 0
- * - Can fail if Sandstorm is already active (not implemented - allows refresh)
+ * - Fails if Sandstorm is already active (the duration is not refreshed)
  *
  * Type immunities (for damage):
  * - Rock type: Immune
@@ -888,13 +897,69 @@ inline void Effect_MultiHit(BattleContext& ctx) {
  * - src/battle_script_commands.c:Cmd_setweather
  */
 inline void Effect_Sandstorm(BattleContext& ctx) {
-    // Set sandstorm weather for 5 turns
+    // Set sandstorm weather for 5 turns (fails if already active)
     commands::SetWeather(ctx, domain::Weather::Sandstorm, 5);
 
-    // TODO: Check if sandstorm is already active
     // TODO: Display message: "A sandstorm kicked up!"
 }
 
+/**
+ * @brief Effect: RAIN_DANCE - Makes it rain for 5 turns
+ *
+ * Rain boosts Water-type damage by 50% and halves Fire-type damage
+ * (weather::DAMAGE_TABLE). It deals no end-of-turn damage.
+ *
+ * Example move:
+ * - Rain Dance (0 power, no accuracy check, Water type, 5 PP) - pokeemerald ID 240
+ *
+ * Based on pokeemerald:
+ * - data/battle_scripts_1.s:BattleScript_EffectRainDance
+ * - src/battle_script_commands.c:Cmd_setrain
+ */
+inline void Effect_RainDance(BattleContext& ctx) {
+    commands::SetWeather(ctx, domain::Weather::Rain, 5);  // Fails if already active
+
+    // TODO: Display message: "It started to rain!"
+}
+
+/**
+ * @brief Effect: SUNNY_DAY - Makes the sunlight harsh for 5 turns
+ *
+ * Sun boosts Fire-type damage by 50% and halves Water-type damage
+ * (weather::DAMAGE_TABLE), and lets Solar Beam skip its charging turn.
+ *
+ * Example move:
+ * - Sunny Day (0 power, no accuracy check, Fire type, 5 PP) - pokeemerald ID 241
+ *
+ * Based on pokeemerald:
+ * - data/battle_scripts_1.s:BattleScript_EffectSunnyDay
+ * - src/battle_script_commands.c:Cmd_setsunny
+ */
+inline void Effect_SunnyDay(BattleContext& ctx) {
+    commands::SetWeather(ctx, domain::Weather::Sun, 5);  // Fails if already active
+
+    // TODO: Display message: "The sunlight turned harsh!"
+}
+
+/**
+ * @brief Effect: HAIL - Summons hail for 5 turns
+ *
+ * Hail deals 1/16 max HP to non-Ice types at end of turn
+ * (weather::RESIDUAL_IMMUNE_TYPES).
+ *
+ * Example move:
+ * - Hail (0 power, no accuracy check, Ice type, 10 PP) - pokeemerald ID 258
+ *
+ * Based on pokeemerald:
+ * - data/battle_scripts_1.s:BattleScript_EffectHail
+ * - src/battle_script_commands.c:Cmd_sethail
+ */
+inline void Effect_Hail(BattleContext& ctx) {
+    commands::SetWeather(ctx, domain::Weather::Hail, 5);  // Fails if already active
+
+    // TODO: Display message: "It started to hail!"
+}
+
 /**
  * @brief Stealth Rock - Sets up entry hazard on opponent's side
  *
@@ -926,8 +991,12 @@ inline void Effect_Sandstorm(BattleContext& ctx) {
  */
 inline void Effect_StealthRock(BattleContext& ctx) {
     // Set stealth rock on defender's side
-    if (!ctx.defender_side->stealth_rock) {
-        ctx.defender_side->stealth_rock = true;
+    if (!ctx.DefenderSide().stealth_rock) {
+        int16_t hazards_before =
+            evaluation::HazardTerm(ctx.Defender(), ctx.DefenderSide(), ctx.state.field);
+        ctx.DefenderSide().stealth_rock = true;
+        evaluation::UpdateHazards(&ctx.state.eval, ctx.defender_battler, hazards_before,
+                                  ctx.Defender(), ctx.DefenderSide(), ctx.state.field);
         // TODO: Display message: "Pointed stones float in the air around [side]!"
     } else {
         // Already set - move fails
@@ -976,24 +1045,76 @@ inline void Effect_LeechSeed(BattleContext& ctx) {
     }
 
     // Fail if target is already seeded
-    if (ctx.defender->is_seeded) {
+    if (ctx.Defender().is_seeded) {
         ctx.move_failed = true;
         // TODO: Display message: "[Defender] is already seeded!"
         return;
     }
 
     // Fail if target is Grass type (immune)
-    if (ctx.defender->type1 == domain::Type::Grass || ctx.defender->type2 == domain::Type::Grass) {
+    if (ctx.Defender().type1 == domain::Type::Grass ||
+        ctx.Defender().type2 == domain::Type::Grass) {
         ctx.move_failed = true;
         // TODO: Display message: "It doesn't affect [Defender]..."
         return;
     }
 
     // Apply Leech Seed
-    ctx.defender->is_seeded = true;
-    ctx.defender->seeded_by = ctx.attacker;
+    ctx.Defender().is_seeded = true;
+    ctx.Defender().seeded_by = ctx.attacker_battler;
     // TODO: Display message: "[Defender] was seeded!"
 }
 
+/**
+ * @brief Effect: FUTURE_SIGHT - Delayed damage two turns later (e.g., Future Sight)
+ *
+ * Future Sight calculates its damage when used, then strikes the target at the end of
+ * the turn two turns later. The delayed hit is queued on the turn-indexed scheduler
+ * and resolved by the Engine's end-of-turn phase.
+ *
+ * Key mechanics:
+ * - Damage is fixed at use time (Gen III; later gens recalculate on hit): the plain
+ *   CalculateDamage formula (stat stages, held-item Attack boost, weather modifier
+ *   for the move's type). It applies no STAB or type effectiveness, which matches
+ *   the typeless delayed hit of Gen III
+ * - No AccuracyCheck on use: Gen III rolls accuracy when the hit lands
+ *   (BattleScript_MonTookFutureAttack), and Protect on the turn of use does not
+ *   stop the move from being set up
+ * - Fails if a Future Sight is already pending on the target
+ * - No damage is dealt on the turn it is used
+ *
+ * Example moves:
+ * - Future Sight (80 power, 90 accuracy, Psychic type, 15 PP) - pokeemerald Move 248
+ * - Doom Desire (120 power, 85 accuracy, Steel type, Gen III)
+ *
+ * Based on pokeemerald:
+ * - data/battle_scripts_1.s:BattleScript_EffectFutureSight
+ * - src/battle_script_commands.c:Cmd_trysetfutureattack (wFutureSightCounter = 3)
+ * - src/battle_util.c:DoFutureSightAttacks
+ */
+inline void Effect_FutureSight(BattleContext& ctx) {
+    // No AccuracyCheck - the hit's accuracy belongs to the turn it lands, not this one
+
+    // Fail if a delayed hit is already pending against the defender
+    if (commands::HasScheduledEffect(ctx.state.scheduler, ctx.defender_battler,
+                                     state::ScheduledEffect::FutureSight)) {
+        ctx.move_failed = true;
+        // TODO: Display message: "But it failed!"
+        return;
+    }
+
+    // Damage is calculated now and stored with the scheduled event
+    commands::CalculateDamage(ctx);
+    uint16_t stored_damage = ctx.damage_dealt;
+    ctx.damage_dealt = 0;  // Nothing is dealt this turn
+
+    if (!commands::ScheduleEffect(ctx.state.scheduler, 2, ctx.defender_battler,
+                                  state::ScheduledEffect::FutureSight, stored_damage)) {
+        ctx.move_failed = true;
+        return;
+    }
+    // TODO: Display message: "[Pokemon] foresaw an attack!"
+}
+
 }  // namespace effects
 }  // namespace battle
@@ -5,11 +5,19 @@
 
 #include "engine.hpp"
 
+#include <cassert>
 #include <cstddef>
 
+#include "chance.hpp"
 #include "commands/abilities.hpp"
+#include "commands/schedule.hpp"
 #include "context.hpp"
 #include "effects/basic.hpp"
+#include "items.hpp"
+#include "move_data.hpp"
+#include "random.hpp"
+#include "script/interpreter.hpp"
+#include "status_tables.hpp"
 
 namespace battle {
 
@@ -17,86 +25,6 @@ namespace battle {
 // PHASE 3: Move Database and Effect Dispatch Table
 // ============================================================================
 
-/**
- * @brief Move database - contains all implemented moves with their stats
- *
- * This replaces the hardcoded GetMoveData_Hardcoded function from Phase 2.
- * Indexed by Move enum value.
- */
-static const domain::MoveData MOVE_DATABASE[] = {
-    // Move::None
-    {domain::Move::None, domain::Type::Normal, 0, 0, 0, 0, 0},
-
-    // Move::Tackle
-    {domain::Move::Tackle, domain::Type::Normal, 40, 100, 35, 0, 0},
-
-    // Move::Ember
-    {domain::Move::Ember, domain::Type::Fire, 40, 100, 25, 10, 0},
-
-    // Move::ThunderWave
-    {domain::Move::ThunderWave, domain::Type::Electric, 0, 100, 20, 100, 0},
-
-    // Move::Growl
-    {domain::Move::Growl, domain::Type::Normal, 0, 100, 40, 0, 0},
-
-    // Move::TailWhip
-    {domain::Move::TailWhip, domain::Type::Normal, 0, 100, 30, 0, 0},
-
-    // Move::SwordsDance
-    {domain::Move::SwordsDance, domain::Type::Normal, 0, 0, 30, 0, 0},
-
-    // Move::DoubleEdge
-    {domain::Move::DoubleEdge, domain::Type::Normal, 120, 100, 15, 0, 0},
-
-    // Move::GigaDrain
-    {domain::Move::GigaDrain, domain::Type::Grass, 60, 100, 5, 0, 0},
-
-    // Move::IronDefense
-    {domain::Move::IronDefense, domain::Type::Normal, 0, 0, 15, 0, 0},
-
-    // Move::StringShot
-    {domain::Move::StringShot, domain::Type::Bug, 0, 95, 40, 0, 0},
-
-    // Move::Agility
-    {domain::Move::Agility, domain::Type::Psychic, 0, 0, 30, 0, 0},
-
-    // Move::TailGlow
-    {domain::Move::TailGlow, domain::Type::Bug, 0, 0, 20, 0, 0},
-
-    // Move::FakeTears
-    {domain::Move::FakeTears, domain::Type::Dark, 0, 100, 20, 0, 0},
-
-    // Move::Amnesia
-    {domain::Move::Amnesia, domain::Type::Psychic, 0, 0, 20, 0, 0},
-
-    // Move::FuryAttack
-    {domain::Move::FuryAttack, domain::Type::Normal, 15, 85, 20, 0, 0},
-
-    // Move::Protect
-    {domain::Move::Protect, domain::Type::Normal, 0, 0, 10, 0, 4},
-
-    // Move::SolarBeam
-    {domain::Move::SolarBeam, domain::Type::Grass, 120, 100, 10, 0, 0},
-
-    // Move::Fly
-    {domain::Move::Fly, domain::Type::Flying, 70, 95, 15, 0, 0},
-
-    // Move::Substitute
-    {domain::Move::Substitute, domain::Type::Normal, 0, 0, 10, 0, 0},
-
-    // Move::BatonPass
-    {domain::Move::BatonPass, domain::Type::Normal, 0, 0, 40, 0, 0},
-
-    // Move::Sandstorm
-    {domain::Move::Sandstorm, domain::Type::Rock, 0, 0, 10, 0, 0},
-
-    // Move::QuickAttack
-    {domain::Move::QuickAttack, domain::Type::Normal, 40, 100, 30, 0, 1},
-
-    // Move::StealthRock
-    {domain::Move::StealthRock, domain::Type::Rock, 0, 0, 20, 0, 0},
-};
-
 /**
  * @brief Effect function pointer type
  */
@@ -134,34 +62,17 @@ static const EffectFunction EFFECT_DISPATCH[] = {
     effects::Effect_Hit,                  // Move::QuickAttack
     effects::Effect_StealthRock,          // Move::StealthRock
     effects::Effect_LeechSeed,            // Move::LeechSeed
+    effects::Effect_FutureSight,          // Move::FutureSight
+    effects::Effect_RainDance,            // Move::RainDance
+    effects::Effect_SunnyDay,             // Move::SunnyDay
+    effects::Effect_Hail,                 // Move::Hail
 };
 
-/**
- * @brief Number of entries in move database
- */
-constexpr size_t MOVE_DATABASE_SIZE = sizeof(MOVE_DATABASE) / sizeof(MOVE_DATABASE[0]);
-
 /**
  * @brief Number of entries in effect dispatch table
  */
 constexpr size_t EFFECT_DISPATCH_SIZE = sizeof(EFFECT_DISPATCH) / sizeof(EFFECT_DISPATCH[0]);
 
-/**
- * @brief Get move data from database
- * @param move The move to look up
- * @return MoveData for the move
- */
-static const domain::MoveData& GetMoveData(domain::Move move) {
-    uint8_t index = static_cast<uint8_t>(move);
-
-    // Bounds check
-    if (index >= MOVE_DATABASE_SIZE) {
-        return MOVE_DATABASE[0];  // Return None if out of bounds
-    }
-
-    return MOVE_DATABASE[index];
-}
-
 /**
  * @brief Get effect function from dispatch table
  * @param move The move to look up
@@ -184,57 +95,50 @@ static EffectFunction GetEffectFunction(domain::Move move) {
 
 void BattleEngine::InitBattle(const state::Pokemon& player_pokemon,
                               const state::Pokemon& enemy_pokemon) {
-    player_ = player_pokemon;
-    enemy_ = enemy_pokemon;
+    state_.battlers[0] = player_pokemon;
+    state_.battlers[1] = enemy_pokemon;
 
     // Initialize field state (clear weather)
-    field_.weather = domain::Weather::None;
-    field_.weather_duration = 0;
+    state_.field.weather = domain::Weather::None;
+    state_.field.weather_duration = 0;
 
     // Initialize side state (clear hazards)
-    player_side_.stealth_rock = false;
-    enemy_side_.stealth_rock = false;
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        state_.sides[battler].stealth_rock = false;
+    }
+
+    // Initialize scheduler (no pending delayed effects, turn 0 = before first turn)
+    state_.scheduler.turn = 0;
+    state_.scheduler.count = 0;
+
+    // Build the running evaluation once; commands keep it up to date from here on
+    state_.eval = RecomputeEvaluation();
+    state_.item_hooks = items::BattleHooks(state_.battlers[0], state_.battlers[1]);
 
     // Trigger switch-in abilities for both Pokemon
-    // Player switches in first (affects enemy)
-    {
-        BattleContext ctx;
-        ctx.attacker = &player_;
-        ctx.defender = &enemy_;
-        ctx.field = &field_;
-        ctx.attacker_side = &player_side_;
-        ctx.defender_side = &enemy_side_;
-        ctx.move = nullptr;
-        ctx.move_failed = false;
+    // Player switches in first (affects enemy), then enemy (affects player)
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        BattleContext ctx = BindContext(state_, battler, domain::Move::None);
         commands::TriggerSwitchInAbilities(ctx);
     }
 
-    // Enemy switches in second (affects player)
-    {
-        BattleContext ctx;
-        ctx.attacker = &enemy_;
-        ctx.defender = &player_;
-        ctx.field = &field_;
-        ctx.attacker_side = &enemy_side_;
-        ctx.defender_side = &player_side_;
-        ctx.move = nullptr;
-        ctx.move_failed = false;
-        commands::TriggerSwitchInAbilities(ctx);
-    }
+    assert(evaluation::Equal(state_.eval, RecomputeEvaluation()));
 }
 
 /**
  * @brief Calculate effective speed for turn order
  * @param pokemon The Pokemon whose speed to calculate
- * @return Effective speed (base speed * stat stage multiplier * status modifier)
+ * @param item_hooks The battle's item hooks (items::HOOK_SPEED enables held item modifiers)
+ * @return Effective speed (base speed * stat stage multiplier * item and status modifiers)
  *
  * Based on pokeemerald's GetWhoStrikesFirst function.
  * Formula: speed * (2 + stage) / 2  if stage >= 0
  *          speed * 2 / (2 - stage)  if stage < 0
  *
- * Then apply status modifiers (paralysis divides by 4).
+ * Then apply held item modifiers (Macho Brace halves) and status modifiers
+ * (paralysis divides by 4). Quick Claw is a per-turn roll (DetermineTurnOrder).
  */
-static uint16_t CalculateEffectiveSpeed(const state::Pokemon& pokemon) {
+static uint16_t CalculateEffectiveSpeed(const state::Pokemon& pokemon, uint8_t item_hooks) {
     uint16_t speed = pokemon.speed;
     int8_t stage = pokemon.stat_stages[domain::STAT_SPEED];
 
@@ -245,6 +149,11 @@ static uint16_t CalculateEffectiveSpeed(const state::Pokemon& pokemon) {
         speed = (speed * 2) / (2 - stage);
     }
 
+    // Held item modifiers (Macho Brace: speed /= 2)
+    if (item_hooks & items::HOOK_SPEED) {
+        speed = items::ModifySpeed(pokemon, speed);
+    }
+
     // Apply paralysis speed reduction (75% reduction = divide by 4)
     // Based on pokeemerald: if (status1 & STATUS1_PARALYSIS) speed /= 4
     if (pokemon.status1 & domain::Status1::PARALYSIS) {
@@ -253,39 +162,39 @@ static uint16_t CalculateEffectiveSpeed(const state::Pokemon& pokemon) {
 
     // Future phases will add:
     // - Swift Swim/Chlorophyll (speed *= 2 in weather)
-    // - Quick Claw (speed = UINT16_MAX)
-    // - Macho Brace (speed /= 2)
 
     return speed;
 }
 
 /**
  * @brief Check if a Pokemon can act this turn (not prevented by status)
- * @param pokemon The Pokemon to check
+ * @param pokemon The Pokemon to check (its status1 advances: sleep countdown, thaw)
+ * @param battler The Pokemon's battler index
+ * @param eval Running evaluation terms (status term kept in step)
  * @return true if Pokemon can act, false if prevented by status
  *
- * Checks for status conditions that prevent action:
+ * One lookup in the status1 table (status::TABLE), at most one draw, one compare:
+ * - Sleep: counts down each turn; wakes up and acts when it reaches 0
+ * - Freeze: cannot move, 20% chance to thaw and act
  * - Paralysis: 25% chance to be fully paralyzed and unable to move
- * - Freeze: Cannot move (20% chance to thaw - not implemented yet)
- * - Sleep: Cannot move (counts down - not implemented yet)
  *
- * Based on pokeemerald's CheckMoveLimitations function.
+ * Based on pokeemerald's AtkCanceller_UnableToUseMove function.
  */
-static bool CanActThisTurn(const state::Pokemon& pokemon) {
-    // Check paralysis - 25% chance to be fully paralyzed
-    // Based on pokeemerald: if (gBattleMons[battler].status1 & STATUS1_PARALYSIS)
-    //                       if (Random() % 100 < 25) // fully paralyzed
-    if (pokemon.status1 & domain::Status1::PARALYSIS) {
-        if (random::Random(100) < 25) {
-            // TODO: Display message: "[Pokemon] is paralyzed! It can't move!"
-            return false;
-        }
+static bool CanActThisTurn(state::Pokemon& pokemon, uint8_t battler, evaluation::Terms* eval) {
+    const status::Entry& entry = status::Lookup(pokemon.status1);
+    uint16_t draw =
+        (entry.act_roll != 0) ? random::Random(entry.act_roll, random::Stream::StatusGate) : 0;
+    bool acts = draw >= entry.blocked_below;
+
+    uint8_t next = acts ? entry.status_if_acts : entry.status_if_blocked;
+    if (next != pokemon.status1) {
+        int16_t status_before = evaluation::StatusTerm(pokemon);
+        pokemon.status1 = next;
+        evaluation::UpdateStatus(eval, battler, status_before, pokemon);
     }
 
-    // TODO: Check freeze status (cannot move, 20% thaw chance)
-    // TODO: Check sleep status (cannot move, counts down each turn)
-
-    return true;  // Can act normally
+    // TODO: Display message: "[Pokemon] is fast asleep." / "is frozen solid!" / "is paralyzed!"
+    return acts;
 }
 
 /**
@@ -308,9 +217,9 @@ bool BattleEngine::DetermineTurnOrder(const BattleAction& player_action,
         return true;  // Default to player first
     }
 
-    // Get move priorities from move data
-    const domain::MoveData& player_move_data = GetMoveData(player_action.move);
-    const domain::MoveData& enemy_move_data = GetMoveData(enemy_action.move);
+    // Get move priorities from move data (of the moves a Choice lock allows)
+    const domain::MoveData& player_move_data = GetMoveData(SelectedMove(0, player_action));
+    const domain::MoveData& enemy_move_data = GetMoveData(SelectedMove(1, enemy_action));
     int8_t player_priority = player_move_data.priority;
     int8_t enemy_priority = enemy_move_data.priority;
 
@@ -322,8 +231,21 @@ bool BattleEngine::DetermineTurnOrder(const BattleAction& player_action,
     }
 
     // Same priority - compare speeds
-    uint16_t player_speed = CalculateEffectiveSpeed(player_);
-    uint16_t enemy_speed = CalculateEffectiveSpeed(enemy_);
+    const state::Pokemon& player = state_.battlers[0];
+    const state::Pokemon& enemy = state_.battlers[1];
+    uint16_t player_speed = CalculateEffectiveSpeed(player, state_.item_hooks);
+    uint16_t enemy_speed = CalculateEffectiveSpeed(enemy, state_.item_hooks);
+
+    // Quick Claw: one roll per turn shared by both holders (pokeemerald's gRandomTurnNumber)
+    if (state_.item_hooks & items::HOOK_SPEED) {
+        bool player_claw = player.item == domain::Item::QuickClaw;
+        bool enemy_claw = enemy.item == domain::Item::QuickClaw;
+        if ((player_claw || enemy_claw) &&
+            chance::Occurs(chance::QUICK_CLAW, random::Stream::QuickClaw)) {
+            player_speed = player_claw ? UINT16_MAX : player_speed;
+            enemy_speed = enemy_claw ? UINT16_MAX : enemy_speed;
+        }
+    }
 
     if (player_speed > enemy_speed) {
         return true;  // Player is faster
@@ -332,286 +254,545 @@ bool BattleEngine::DetermineTurnOrder(const BattleAction& player_action,
     }
 
     // Same speed - 50/50 random (based on pokeemerald: Random() & 1)
-    return (random::Random(2) == 0);
+    return chance::Occurs(chance::SPEED_TIE, random::Stream::SpeedTie);
 }
 
 void BattleEngine::ExecuteTurn(const BattleAction& player_action,
                                const BattleAction& enemy_action) {
-    // Phase 4: Determine turn order based on speed and priority
-    bool player_goes_first = DetermineTurnOrder(player_action, enemy_action);
-
-    if (player_goes_first) {
-        // Player attacks first
-        if (player_action.type == ActionType::MOVE) {
-            // Check if player can act (not prevented by paralysis/freeze/sleep)
-            if (CanActThisTurn(player_)) {
-                ExecuteMove(player_, enemy_, player_action.move);
-            }
-        }
+    bool player_goes_first = BeginTurn(player_action, enemy_action);
+    uint8_t first = player_goes_first ? 0 : 1;
+
+    // First mover acts
+    RunAction(first, player_goes_first ? player_action : enemy_action);
+
+    // Check if battle is over after the first move
+    if (IsBattleOver()) {
+        return;
+    }
+
+    // Second mover acts
+    RunAction(static_cast<uint8_t>(1 - first), player_goes_first ? enemy_action : player_action);
+
+    // End-of-turn processing (status damage, weather, etc.)
+    FinishTurn();
+}
 
-        // Check if battle is over after player's move
-        if (IsBattleOver()) {
-            return;
+/**
+ * @brief Number of battles StepMany advances through each phase together
+ *
+ * Small enough that a group's states stay in L1 across the four phases,
+ * large enough that prefetches for the next group have time to land.
+ */
+constexpr size_t STEP_GROUP_SIZE = 8;
+
+/**
+ * @brief Hint the cache to fetch an object (no-op where unsupported)
+ */
+static inline void PrefetchObject(const void* object, size_t size) {
+#if defined(__GNUC__)
+    const char* bytes = static_cast<const char*>(object);
+    for (size_t offset = 0; offset < size; offset += 64) {
+        __builtin_prefetch(bytes + offset, 1, 3);
+    }
+#else
+    (void)object;
+    (void)size;
+#endif
+}
+
+void BattleEngine::StepMany(BattleEngine* engines, const BattleAction* actions, size_t n) {
+    bool player_first[STEP_GROUP_SIZE];
+    bool active[STEP_GROUP_SIZE];
+
+    for (size_t base = 0; base < n; base += STEP_GROUP_SIZE) {
+        size_t count = (n - base < STEP_GROUP_SIZE) ? (n - base) : STEP_GROUP_SIZE;
+        BattleEngine* group = engines + base;
+        const BattleAction* group_actions = actions + 2 * base;
+
+        // Start pulling in the next group while this one runs
+        size_t next = base + STEP_GROUP_SIZE;
+        for (size_t i = next; i < n && i < next + STEP_GROUP_SIZE; i++) {
+            PrefetchObject(&engines[i], sizeof(BattleEngine));
         }
 
-        // Enemy attacks second
-        if (enemy_action.type == ActionType::MOVE) {
-            // Check if enemy can act
-            if (CanActThisTurn(enemy_)) {
-                ExecuteMove(enemy_, player_, enemy_action.move);
+        // Phase 1: turn order (and the move data both movers will need)
+        for (size_t i = 0; i < count; i++) {
+            const BattleAction& player_action = group_actions[2 * i];
+            const BattleAction& enemy_action = group_actions[2 * i + 1];
+            active[i] = !group[i].IsBattleOver();
+            if (active[i]) {
+                PrefetchObject(&GetMoveData(player_action.move), sizeof(domain::MoveData));
+                PrefetchObject(&GetMoveData(enemy_action.move), sizeof(domain::MoveData));
+                player_first[i] = group[i].BeginTurn(player_action, enemy_action);
             }
         }
-    } else {
-        // Enemy attacks first
-        if (enemy_action.type == ActionType::MOVE) {
-            // Check if enemy can act
-            if (CanActThisTurn(enemy_)) {
-                ExecuteMove(enemy_, player_, enemy_action.move);
+
+        // Phase 2: first movers
+        for (size_t i = 0; i < count; i++) {
+            if (active[i]) {
+                uint8_t battler = player_first[i] ? 0 : 1;
+                group[i].RunAction(battler, group_actions[2 * i + battler]);
             }
         }
 
-        // Check if battle is over after enemy's move
-        if (IsBattleOver()) {
-            return;
+        // Phase 3: second movers (skipped where the first move ended the battle)
+        for (size_t i = 0; i < count; i++) {
+            if (active[i] && !group[i].IsBattleOver()) {
+                uint8_t battler = player_first[i] ? 1 : 0;
+                group[i].RunAction(battler, group_actions[2 * i + battler]);
+            } else {
+                active[i] = false;
+            }
         }
 
-        // Player attacks second
-        if (player_action.type == ActionType::MOVE) {
-            // Check if player can act
-            if (CanActThisTurn(player_)) {
-                ExecuteMove(player_, enemy_, player_action.move);
+        // Phase 4: end of turn
+        for (size_t i = 0; i < count; i++) {
+            if (active[i]) {
+                group[i].FinishTurn();
             }
         }
     }
+}
+
+bool BattleEngine::BeginTurn(const BattleAction& player_action, const BattleAction& enemy_action) {
+    random::SetDrawOwner(this);
+
+    // Advance the turn counter (scheduled effects are keyed by turn number)
+    state_.scheduler.turn++;
+    if (sink_ != nullptr) {
+        Emit(EventType::TurnStart, 0, state_.scheduler.turn, 0);
+    }
+
+    // Phase 4: Determine turn order based on speed and priority
+    return DetermineTurnOrder(player_action, enemy_action);
+}
+
+void BattleEngine::RunAction(uint8_t battler, const BattleAction& action) {
+    random::SetDrawOwner(this);
+
+    if (action.type != ActionType::MOVE) {
+        return;
+    }
+
+    // Check if the Pokemon can act (not prevented by paralysis/freeze/sleep)
+    state::Pokemon& pokemon = state_.battlers[battler];
+    uint8_t status_before = pokemon.status1;
+    bool acts = CanActThisTurn(pokemon, battler, &state_.eval);
+    if (sink_ != nullptr && pokemon.status1 != status_before) {
+        Emit(EventType::StatusChanged, battler, pokemon.status1, status_before);
+    }
+    if (acts) {
+        domain::Move move = SelectedMove(battler, action);
+        if (state_.item_hooks & items::HOOK_MOVE_LOCK) {
+            items::LockChoice(pokemon, move);
+        }
+        ExecuteMove(battler, move);
+    }
+}
+
+domain::Move BattleEngine::SelectedMove(uint8_t battler, const BattleAction& action) const {
+    if (state_.item_hooks & items::HOOK_MOVE_LOCK) {
+        return items::LockedMove(state_.battlers[battler], action.move);
+    }
+    return action.move;
+}
+
+void BattleEngine::FinishTurn() {
+    random::SetDrawOwner(this);
 
-    // End-of-turn processing (status damage, weather, etc.)
     // Only process if battle isn't already over
-    if (!IsBattleOver()) {
+    if (IsBattleOver()) {
+        return;
+    }
+
+    if (sink_ == nullptr) {
         EndOfTurn();
+        return;
     }
+
+    Emit(EventType::EndOfTurn, 0, state_.scheduler.turn, 0);
+    state::Pokemon before[state::NUM_BATTLERS] = {state_.battlers[0], state_.battlers[1]};
+    domain::Weather weather_before = state_.field.weather;
+    EndOfTurn();
+    EmitChanges(before, weather_before);
 }
 
 bool BattleEngine::IsBattleOver() const {
-    return player_.is_fainted || enemy_.is_fainted;
+    return state_.battlers[0].is_fainted || state_.battlers[1].is_fainted;
 }
 
-void BattleEngine::ExecuteMove(state::Pokemon& attacker, state::Pokemon& defender,
-                               domain::Move move) {
-    // Set up battle context
-    BattleContext ctx;
-    ctx.attacker = &attacker;
-    ctx.defender = &defender;
-    ctx.field = &field_;
-
-    // Determine which side is which (attacker's side vs defender's side)
-    if (&attacker == &player_) {
-        ctx.attacker_side = &player_side_;
-        ctx.defender_side = &enemy_side_;
-    } else {
-        ctx.attacker_side = &enemy_side_;
-        ctx.defender_side = &player_side_;
-    }
-
-    // Get move data from database (Phase 3: table lookup)
-    const domain::MoveData& move_data = GetMoveData(move);
-    ctx.move = &move_data;
-
-    // Initialize execution state
-    ctx.move_failed = false;
-    ctx.damage_dealt = 0;
-    ctx.recoil_dealt = 0;
-    ctx.drain_received = 0;
-    ctx.critical_hit = false;
-    ctx.effectiveness = 4;  // 1.0x (normal effectiveness)
-    ctx.hit_count = 0;
-    ctx.override_power = 0;
-    ctx.override_type = 0;
-
-    // Phase 3: Generalized dispatch via function pointer table
+void BattleEngine::ExecuteMove(uint8_t attacker_battler, domain::Move move) {
+    // Snapshot the battlers only when someone is listening to the event stream
+    state::Pokemon before[state::NUM_BATTLERS];
+    domain::Weather weather_before = state_.field.weather;
+    if (sink_ != nullptr) {
+        before[0] = state_.battlers[0];
+        before[1] = state_.battlers[1];
+    }
+
+    // Bind the context to the state block (Phase 3: move data by table lookup)
+    BattleContext ctx = BindContext(state_, attacker_battler, move);
+
+    // Phase 3: Generalized dispatch via function pointer table; a loaded script
+    // replaces the move's native effect
     EffectFunction effect_fn = GetEffectFunction(move);
+    uint8_t index = static_cast<uint8_t>(move);
+    const uint8_t* script =
+        scripts_ != nullptr && index < domain::NUM_MOVES ? scripts_->scripts[index] : nullptr;
 
-    if (effect_fn != nullptr) {
+    if (script != nullptr) {
+        script::RunScript(script, ctx);
+    } else if (effect_fn != nullptr) {
         effect_fn(ctx);
     } else {
         // Move not implemented - fail silently
         ctx.move_failed = true;
     }
+
+    if (sink_ != nullptr) {
+        EventType used = ctx.move_failed ? EventType::MoveFailed : EventType::MoveUsed;
+        Emit(used, attacker_battler, static_cast<uint16_t>(move), 0);
+        EmitChanges(before, weather_before);
+    }
+
+    // Debug builds: the running evaluation must match a from-scratch recompute
+    assert(evaluation::Equal(state_.eval, RecomputeEvaluation()));
 }
 
 void BattleEngine::EndOfTurn() {
-    // Process status damage for player
-    if (player_.status1 & domain::Status1::BURN) {
-        // Burn damage: 1/8 max HP per turn
-        // Based on pokeemerald: damage = pokemon->maxHP / 8
-        // If max HP < 8, damage is 0 (integer division rounds down)
-        uint16_t burn_damage = player_.max_hp / 8;
-
-        // Apply damage only if > 0, clamping at 0
-        if (burn_damage > 0) {
-            if (burn_damage >= player_.current_hp) {
-                player_.current_hp = 0;
-                player_.is_fainted = true;
-            } else {
-                player_.current_hp -= burn_damage;
-            }
+    // Process status damage (player first, then enemy)
+    // Burn, poison: 1/8 max HP; toxic: counter/16 max HP, counter grows each turn
+    // Based on pokeemerald: damage = pokemon->maxHP / 8 (toxic: / 16 * counter)
+    // If max HP < divisor, damage is 0 (integer division rounds down)
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        state::Pokemon& pokemon = state_.battlers[battler];
+        const status::Entry& entry = status::Lookup(pokemon.status1);
+        if (entry.residual_divisor == 0 || pokemon.is_fainted) {
+            continue;
+        }
+        uint16_t damage = pokemon.max_hp / entry.residual_divisor;
+        if (entry.toxic_step != 0) {
+            uint8_t counter = pokemon.toxic_counter + entry.toxic_step;
+            pokemon.toxic_counter =
+                counter > status::MAX_TOXIC_COUNTER ? status::MAX_TOXIC_COUNTER : counter;
+            damage *= pokemon.toxic_counter;
         }
+        ApplyResidualDamage(battler, damage);
 
-        // TODO: Display message: "[Pokemon] was hurt by its burn!"
+        // TODO: Display message: "[Pokemon] was hurt by its burn!" / "hurt by poison!"
     }
 
-    // Process status damage for enemy
-    if (enemy_.status1 & domain::Status1::BURN) {
-        // Burn damage: 1/8 max HP per turn
-        // If max HP < 8, damage is 0 (integer division rounds down)
-        uint16_t burn_damage = enemy_.max_hp / 8;
+    // Leech Seed drain (1/8 max HP, heals seeder)
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        ApplyLeechSeed(battler);
+    }
 
-        // Apply damage only if > 0, clamping at 0
-        if (burn_damage > 0) {
-            if (burn_damage >= enemy_.current_hp) {
-                enemy_.current_hp = 0;
-                enemy_.is_fainted = true;
-            } else {
-                enemy_.current_hp -= burn_damage;
-            }
+    // Weather damage (Sandstorm, Hail: 1/16 max HP)
+    // Immunity is a per-weather type mask (Rock/Ground/Steel for Sandstorm, Ice for Hail)
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        const state::Pokemon& pokemon = state_.battlers[battler];
+        if (!pokemon.is_fainted) {
+            ApplyResidualDamage(battler, weather::ResidualDamage(state_.field.weather, pokemon));
+            // TODO: Display message: "[Pokemon] is buffeted by the sandstorm!" / "pelted by hail!"
         }
+    }
 
-        // TODO: Display message: "[Pokemon] was hurt by its burn!"
+    // Held item effects (Leftovers: 1/16 max HP)
+    // Based on pokeemerald: ItemBattleEffects(ITEMEFFECT_NORMAL) HOLD_EFFECT_LEFTOVERS
+    if (state_.item_hooks & items::HOOK_END_OF_TURN) {
+        for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+            ApplyResidualHeal(battler, items::EndOfTurnHeal(state_.battlers[battler]));
+        }
     }
 
-    // TODO: Add poison damage (1/8 max HP)
-    // TODO: Add toxic damage (increasing: turn/16 * max HP)
+    // Decrement weather duration
+    if (state_.field.weather_duration > 0) {
+        state_.field.weather_duration--;
 
-    // Leech Seed drain (1/8 max HP, heals seeder)
-    // Process player
-    if (player_.is_seeded && player_.seeded_by != nullptr && !player_.seeded_by->is_fainted &&
-        !player_.is_fainted) {
-        // Calculate drain amount: 1/8 of seeded Pokemon's max HP (minimum 1)
-        uint16_t drain_amount = player_.max_hp / 8;
-        if (drain_amount == 0) {
-            drain_amount = 1;
+        // Clear weather when duration reaches 0
+        if (state_.field.weather_duration == 0) {
+            int16_t before[state::NUM_BATTLERS];
+            for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+                before[battler] = evaluation::HazardTerm(state_.battlers[battler],
+                                                         state_.sides[battler], state_.field);
+            }
+            state_.field.weather = domain::Weather::None;
+            for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+                evaluation::UpdateHazards(&state_.eval, battler, before[battler],
+                                          state_.battlers[battler], state_.sides[battler],
+                                          state_.field);
+            }
+            // TODO: Display message: "The sandstorm subsided." / "The rain stopped." etc.
         }
+    }
 
-        // Clamp drain to not exceed current HP
-        if (drain_amount > player_.current_hp) {
-            drain_amount = player_.current_hp;
-        }
+    // Delayed effects (Future Sight, two-turn charge expiry)
+    // Only the events due this turn are touched
+    state::ScheduledEvent event;
+    while (commands::PopDueEffect(state_.scheduler, event)) {
+        ResolveScheduledEffect(event);
+    }
 
-        // Damage seeded Pokemon
-        player_.current_hp -= drain_amount;
-        if (player_.current_hp == 0) {
-            player_.is_fainted = true;
-        }
+    // TODO: Decrement screen counters (Light Screen, Reflect)
 
-        // Heal seeder by the same amount (capped at max HP)
-        if (player_.seeded_by->current_hp + drain_amount > player_.seeded_by->max_hp) {
-            player_.seeded_by->current_hp = player_.seeded_by->max_hp;
-        } else {
-            player_.seeded_by->current_hp += drain_amount;
-        }
+    // Debug builds: the running evaluation must match a from-scratch recompute
+    assert(evaluation::Equal(state_.eval, RecomputeEvaluation()));
+}
+
+void BattleEngine::ApplyResidualDamage(uint8_t battler, uint16_t damage) {
+    state::Pokemon& pokemon = state_.battlers[battler];
 
-        // TODO: Display message: "[Player] was seeded by Leech Seed!"
-        // TODO: Display message: "[Seeder]'s health was restored!" (or animation)
+    // Apply damage only if > 0, clamping at 0
+    if (damage == 0) {
+        return;
     }
 
-    // Process enemy
-    if (enemy_.is_seeded && enemy_.seeded_by != nullptr && !enemy_.seeded_by->is_fainted &&
-        !enemy_.is_fainted) {
-        // Calculate drain amount: 1/8 of seeded Pokemon's max HP (minimum 1)
-        uint16_t drain_amount = enemy_.max_hp / 8;
-        if (drain_amount == 0) {
-            drain_amount = 1;
-        }
+    int16_t material_before = evaluation::MaterialTerm(pokemon);
+    if (damage >= pokemon.current_hp) {
+        pokemon.current_hp = 0;
+        pokemon.is_fainted = true;
+    } else {
+        pokemon.current_hp -= damage;
+    }
+    evaluation::UpdateMaterial(&state_.eval, battler, material_before, pokemon);
+}
 
-        // Clamp drain to not exceed current HP
-        if (drain_amount > enemy_.current_hp) {
-            drain_amount = enemy_.current_hp;
-        }
+void BattleEngine::ApplyResidualHeal(uint8_t battler, uint16_t heal) {
+    state::Pokemon& pokemon = state_.battlers[battler];
+    if (heal == 0 || pokemon.is_fainted) {
+        return;
+    }
 
-        // Damage seeded Pokemon
-        enemy_.current_hp -= drain_amount;
-        if (enemy_.current_hp == 0) {
-            enemy_.is_fainted = true;
-        }
+    // Clamp to max HP (cannot overheal)
+    int16_t material_before = evaluation::MaterialTerm(pokemon);
+    if (pokemon.current_hp + heal > pokemon.max_hp) {
+        pokemon.current_hp = pokemon.max_hp;
+    } else {
+        pokemon.current_hp += heal;
+    }
+    evaluation::UpdateMaterial(&state_.eval, battler, material_before, pokemon);
+}
+
+void BattleEngine::ApplyLeechSeed(uint8_t battler) {
+    state::Pokemon& seeded = state_.battlers[battler];
+    uint8_t seeder_battler = seeded.seeded_by;
+    state::Pokemon& seeder = state_.battlers[seeder_battler];
+
+    if (!seeded.is_seeded || seeder.is_fainted || seeded.is_fainted) {
+        return;
+    }
+
+    int16_t seeded_before = evaluation::MaterialTerm(seeded);
+    int16_t seeder_before = evaluation::MaterialTerm(seeder);
+
+    // Calculate drain amount: 1/8 of seeded Pokemon's max HP (minimum 1)
+    uint16_t drain_amount = seeded.max_hp / 8;
+    if (drain_amount == 0) {
+        drain_amount = 1;
+    }
+
+    // Clamp drain to not exceed current HP
+    if (drain_amount > seeded.current_hp) {
+        drain_amount = seeded.current_hp;
+    }
+
+    // Damage seeded Pokemon
+    seeded.current_hp -= drain_amount;
+    if (seeded.current_hp == 0) {
+        seeded.is_fainted = true;
+    }
+
+    // Heal seeder by the same amount (capped at max HP)
+    if (seeder.current_hp + drain_amount > seeder.max_hp) {
+        seeder.current_hp = seeder.max_hp;
+    } else {
+        seeder.current_hp += drain_amount;
+    }
+
+    evaluation::UpdateMaterial(&state_.eval, battler, seeded_before, seeded);
+    evaluation::UpdateMaterial(&state_.eval, seeder_battler, seeder_before, seeder);
+
+    // TODO: Display message: "[Pokemon] was seeded by Leech Seed!"
+    // TODO: Display message: "[Seeder]'s health was restored!" (or animation)
+}
 
-        // Heal seeder by the same amount (capped at max HP)
-        if (enemy_.seeded_by->current_hp + drain_amount > enemy_.seeded_by->max_hp) {
-            enemy_.seeded_by->current_hp = enemy_.seeded_by->max_hp;
-        } else {
-            enemy_.seeded_by->current_hp += drain_amount;
+void BattleEngine::Emit(EventType type, uint8_t battler, uint16_t value, uint16_t extra) {
+    BattleEvent event;
+    event.turn = state_.scheduler.turn;
+    event.type = type;
+    event.battler = battler;
+    event.value = value;
+    event.extra = extra;
+    sink_(sink_user_, event);
+}
+
+void BattleEngine::EmitChanges(const state::Pokemon (&before)[state::NUM_BATTLERS],
+                               domain::Weather weather_before) {
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        const state::Pokemon& old_mon = before[battler];
+        const state::Pokemon& mon = state_.battlers[battler];
+        if (mon.current_hp != old_mon.current_hp) {
+            Emit(EventType::HpChanged, battler, mon.current_hp, old_mon.current_hp);
+        }
+        if (mon.status1 != old_mon.status1) {
+            Emit(EventType::StatusChanged, battler, mon.status1, old_mon.status1);
         }
+        if (mon.is_fainted && !old_mon.is_fainted) {
+            Emit(EventType::Fainted, battler, 0, 0);
+        }
+    }
+    if (state_.field.weather != weather_before) {
+        Emit(EventType::WeatherChanged, 0, static_cast<uint16_t>(state_.field.weather),
+             static_cast<uint16_t>(weather_before));
+    }
+}
+
+evaluation::Terms BattleEngine::RecomputeEvaluation() const {
+    const state::BattleState& s = state_;
+    return evaluation::Compute(s.battlers[0], s.battlers[1], s.field, s.sides[0], s.sides[1]);
+}
 
-        // TODO: Display message: "[Enemy] was seeded by Leech Seed!"
-        // TODO: Display message: "[Seeder]'s health was restored!" (or animation)
+size_t BattleEngine::EncodeState(uint8_t* out) const {
+    uint8_t* cursor = out;
+    cursor = state::EncodePokemon(cursor, state_.battlers[0]);
+    cursor = state::EncodePokemon(cursor, state_.battlers[1]);
+    cursor = state::EncodeField(cursor, state_.field);
+    cursor = state::EncodeSide(cursor, state_.sides[0]);
+    cursor = state::EncodeSide(cursor, state_.sides[1]);
+    cursor = state::EncodeScheduler(cursor, state_.scheduler);
+    return static_cast<size_t>(cursor - out);
+}
+
+/**
+ * @brief Check that a status1 byte is one status (sleep turns or a single flag)
+ */
+static bool ValidStatus(uint8_t status1, uint8_t toxic_counter) {
+    if (toxic_counter > status::MAX_TOXIC_COUNTER) {
+        return false;
     }
+    uint8_t flags = status1 & static_cast<uint8_t>(~domain::Status1::SLEEP);
+    if (flags == 0) {
+        return true;  // None or sleep turns 1-7
+    }
+    return (status1 & domain::Status1::SLEEP) == 0 && (flags & (flags - 1)) == 0;
+}
 
-    // Weather damage (Sandstorm, Hail: 1/16 max HP)
-    // Only applies if weather is active
-    if (field_.weather == domain::Weather::Sandstorm) {
-        // Sandstorm damages non-Rock/Ground/Steel types
-        // Process player
-        if (!player_.is_fainted) {
-            bool is_immune =
-                (player_.type1 == domain::Type::Rock || player_.type2 == domain::Type::Rock ||
-                 player_.type1 == domain::Type::Ground || player_.type2 == domain::Type::Ground ||
-                 player_.type1 == domain::Type::Steel || player_.type2 == domain::Type::Steel);
-
-            if (!is_immune) {
-                uint16_t weather_damage = player_.max_hp / 16;
-
-                // Apply damage only if > 0, clamping at 0
-                if (weather_damage > 0) {
-                    if (weather_damage >= player_.current_hp) {
-                        player_.current_hp = 0;
-                        player_.is_fainted = true;
-                    } else {
-                        player_.current_hp -= weather_damage;
-                    }
-                }
-
-                // TODO: Display message: "[Pokemon] is buffeted by the sandstorm!"
-            }
+static bool ValidMove(domain::Move move) {
+    return static_cast<uint8_t>(move) < domain::NUM_MOVES;
+}
+
+/**
+ * @brief Check that every enum and index a decoded Pokemon holds is in range
+ *
+ * These values index move, weather, item and type tables, so a corrupted byte
+ * must be rejected before the state is used.
+ */
+static bool ValidDecodedPokemon(const state::Pokemon& p) {
+    bool valid_type2 = static_cast<uint8_t>(p.type2) < domain::NUM_TYPES ||
+                       p.type2 == domain::Type::None;
+    if (static_cast<uint8_t>(p.type1) >= domain::NUM_TYPES || !valid_type2 ||
+        !ValidStatus(p.status1, p.toxic_counter) || !ValidMove(p.charging_move) ||
+        !ValidMove(p.choiced_move) || static_cast<uint8_t>(p.item) >= domain::NUM_ITEMS ||
+        p.semi_invulnerable_type > state::SemiInvulnerableType::Underwater ||
+        p.seeded_by >= state::NUM_BATTLERS) {
+        return false;
+    }
+    for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
+        if (p.stat_stages[i] < -6 || p.stat_stages[i] > 6) {
+            return false;
         }
+    }
+    return true;
+}
 
-        // Process enemy
-        if (!enemy_.is_fainted) {
-            bool is_immune =
-                (enemy_.type1 == domain::Type::Rock || enemy_.type2 == domain::Type::Rock ||
-                 enemy_.type1 == domain::Type::Ground || enemy_.type2 == domain::Type::Ground ||
-                 enemy_.type1 == domain::Type::Steel || enemy_.type2 == domain::Type::Steel);
-
-            if (!is_immune) {
-                uint16_t weather_damage = enemy_.max_hp / 16;
-
-                // Apply damage only if > 0, clamping at 0
-                if (weather_damage > 0) {
-                    if (weather_damage >= enemy_.current_hp) {
-                        enemy_.current_hp = 0;
-                        enemy_.is_fainted = true;
-                    } else {
-                        enemy_.current_hp -= weather_damage;
-                    }
-                }
-
-                // TODO: Display message: "[Pokemon] is buffeted by the sandstorm!"
-            }
+bool BattleEngine::DecodeState(const uint8_t* data, size_t size) {
+    size_t header_end = state::ENCODED_FIXED_SIZE + state::ENCODED_SCHEDULER_HEADER_SIZE;
+    if (size < header_end) {
+        return false;
+    }
+    uint8_t event_count = data[header_end - 1];
+    if (event_count > state::MAX_SCHEDULED_EVENTS ||
+        size != header_end + event_count * state::ENCODED_EVENT_SIZE) {
+        return false;
+    }
+
+    state::BattleState decoded = {};
+    const uint8_t* cursor = data;
+    cursor = state::DecodePokemon(cursor, &decoded.battlers[0]);
+    cursor = state::DecodePokemon(cursor, &decoded.battlers[1]);
+    cursor = state::DecodeField(cursor, &decoded.field);
+    cursor = state::DecodeSide(cursor, &decoded.sides[0]);
+    cursor = state::DecodeSide(cursor, &decoded.sides[1]);
+    state::DecodeScheduler(cursor, &decoded.scheduler);
+
+    if (!ValidDecodedPokemon(decoded.battlers[0]) || !ValidDecodedPokemon(decoded.battlers[1]) ||
+        static_cast<uint8_t>(decoded.field.weather) >= domain::NUM_WEATHERS) {
+        return false;
+    }
+    for (uint8_t i = 0; i < decoded.scheduler.count; i++) {
+        const state::ScheduledEvent& event = decoded.scheduler.events[i];
+        if (event.battler >= state::NUM_BATTLERS || event.effect == state::ScheduledEffect::None ||
+            event.effect > state::ScheduledEffect::FutureSight) {
+            return false;
         }
     }
 
-    // TODO: Hail weather damage (same pattern, checks for Ice type immunity)
+    decoded.eval = evaluation::Compute(decoded.battlers[0], decoded.battlers[1], decoded.field,
+                                       decoded.sides[0], decoded.sides[1]);
+    decoded.item_hooks = items::BattleHooks(decoded.battlers[0], decoded.battlers[1]);
+    state_ = decoded;
+    return true;
+}
 
-    // Decrement weather duration
-    if (field_.weather_duration > 0) {
-        field_.weather_duration--;
+uint64_t BattleEngine::HashState() const {
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = EncodeState(buffer);
+    return state::HashEncoded(buffer, size);
+}
 
-        // Clear weather when duration reaches 0
-        if (field_.weather_duration == 0) {
-            field_.weather = domain::Weather::None;
-            // TODO: Display message: "The sandstorm subsided."
+bool BattleEngine::PackKey(state::StateKey* key) const {
+    return state::PackKey(state_, key);
+}
+
+void BattleEngine::UnpackKey(const state::StateKey& key) {
+    state::UnpackKey(key, &state_);
+    for (uint8_t battler = 0; battler < state::NUM_BATTLERS; battler++) {
+        if (state_.battlers[battler].is_charging) {
+            commands::ScheduleEffect(state_.scheduler, 1, battler,
+                                     state::ScheduledEffect::ChargeExpire);
         }
     }
+    state_.eval = RecomputeEvaluation();
+}
 
-    // TODO: Decrement screen counters (Light Screen, Reflect)
-    // TODO: Check for Future Sight delayed damage
+void BattleEngine::ResolveScheduledEffect(const state::ScheduledEvent& event) {
+    state::Pokemon& target = state_.battlers[event.battler];
+
+    switch (event.effect) {
+        case state::ScheduledEffect::ChargeExpire:
+            // The release turn was skipped (e.g., fully paralyzed): the charge is lost
+            // Based on pokeemerald: CancelMultiTurnMoves when the move can't be used
+            if (target.is_charging) {
+                target.is_charging = false;
+                target.charging_move = domain::Move::None;
+                target.is_semi_invulnerable = false;
+                target.semi_invulnerable_type = state::SemiInvulnerableType::None;
+            }
+            break;
+
+        case state::ScheduledEffect::FutureSight:
+            // Damage was fixed when the move was used (Gen III)
+            // Based on pokeemerald: DoFutureSightAttacks
+            // TODO: Roll the hit's accuracy here once AccuracyCheck rolls (Protect does not apply)
+            if (!target.is_fainted) {
+                ApplyResidualDamage(event.battler, event.value);
+                // TODO: Display message: "[Pokemon] took the Future Sight attack!"
+            }
+            break;
+
+        case state::ScheduledEffect::None:
+            break;
+    }
 }
 
 }  // namespace battle
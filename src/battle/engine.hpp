@@ -17,12 +17,16 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "../domain/move.hpp"
-#include "state/field.hpp"
-#include "state/pokemon.hpp"
-#include "state/side.hpp"
+#include "evaluation.hpp"
+#include "events.hpp"
+#include "script/loader.hpp"
+#include "state/battle_state.hpp"
+#include "state/encoding.hpp"
+#include "state/state_key.hpp"
 
 namespace battle {
 
@@ -52,6 +56,22 @@ struct BattleAction {
     domain::Move move;  // Phase 2: Explicit move (TODO: lookup from move_slot)
 };
 
+/**
+ * @brief Maximum size of an encoded Engine state (see BattleEngine::EncodeState)
+ */
+constexpr size_t MAX_ENCODED_STATE_SIZE = 2 * state::ENCODED_POKEMON_SIZE +
+                                          state::ENCODED_FIELD_SIZE + 2 * state::ENCODED_SIDE_SIZE +
+                                          state::MAX_ENCODED_SCHEDULER_SIZE;
+
+/**
+ * @brief Version of the battle mechanics
+ *
+ * Bump whenever an effect, command or turn step changes what a battle does
+ * (damage, order, chance draws, failure rules). Rules written as code are not
+ * visible to a data hash, so caches of derived results key on this number.
+ */
+constexpr uint32_t ENGINE_MECHANICS_VERSION = 1;
+
 /**
  * @brief Battle Engine - orchestrates turn execution
  *
@@ -79,6 +99,22 @@ class BattleEngine {
      */
     void ExecuteTurn(const BattleAction& player_action, const BattleAction& enemy_action);
 
+    /**
+     * @brief Execute one turn on each of many independent battles
+     * @param engines Array of n battles
+     * @param actions Array of 2n actions: actions[2i] = player, actions[2i + 1] = enemy of battle i
+     * @param n Number of battles
+     *
+     * Battles are advanced in small groups, one turn phase at a time across the group
+     * (turn order, first movers, second movers, end of turn), while the next group's
+     * states are prefetched. This hides memory latency when stepping many cold states.
+     * Battles that are already over are skipped.
+     *
+     * Each battle sees the same phases as ExecuteTurn, but RNG draws are interleaved
+     * across the group, so results match sequential stepping in distribution only.
+     */
+    static void StepMany(BattleEngine* engines, const BattleAction* actions, size_t n);
+
     /**
      * @brief Check if battle is over
      * @return true if either Pokemon has fainted
@@ -88,12 +124,117 @@ class BattleEngine {
     /**
      * @brief Get the player's active Pokemon (for testing)
      */
-    const state::Pokemon& GetPlayer() const { return player_; }
+    const state::Pokemon& GetPlayer() const { return state_.battlers[0]; }
 
     /**
      * @brief Get the enemy's active Pokemon (for testing)
      */
-    const state::Pokemon& GetEnemy() const { return enemy_; }
+    const state::Pokemon& GetEnemy() const { return state_.battlers[1]; }
+
+    /**
+     * @brief Get the whole battle state block
+     */
+    const state::BattleState& GetState() const { return state_; }
+
+    /**
+     * @brief Replace the whole battle state block (e.g. from a snapshot or a saved repro)
+     *
+     * The block is taken as-is, including its running evaluation terms and item hook mask.
+     */
+    void LoadState(const state::BattleState& state) { state_ = state; }
+
+    /**
+     * @brief Get the running evaluation terms
+     *
+     * Kept up to date by the commands that mutate state, so this is a read.
+     */
+    const evaluation::Terms& GetEvaluation() const { return state_.eval; }
+
+    /**
+     * @brief Static evaluation of the current state (positive = good for player)
+     */
+    int16_t Evaluate() const { return evaluation::Score(state_.eval); }
+
+    /**
+     * @brief Recompute the evaluation terms from scratch
+     *
+     * Used to verify the running terms (debug builds assert they match after every move
+     * and end-of-turn phase).
+     */
+    evaluation::Terms RecomputeEvaluation() const;
+
+    /**
+     * @brief Write the canonical encoding of the battle state
+     * @param out Buffer of at least MAX_ENCODED_STATE_SIZE bytes
+     * @return Number of bytes written
+     *
+     * Equal encodings mean equal battle states (the evaluation terms are derived
+     * data and are not encoded). Used to merge transpositions.
+     */
+    size_t EncodeState(uint8_t* out) const;
+
+    /**
+     * @brief Replace the battle state with one written by EncodeState
+     * @param data Encoded state
+     * @param size Its length in bytes
+     * @return false (state unchanged) if the bytes are not a complete encoding or hold
+     *         an out-of-range value (battler index, weather, status, move, item, type,
+     *         stat stage or scheduled effect)
+     *
+     * The running evaluation terms are not encoded; they are recomputed.
+     */
+    bool DecodeState(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Hash of the canonical state encoding
+     */
+    uint64_t HashState() const;
+
+    /**
+     * @brief Pack the battle state into a 16-byte key (see state/state_key.hpp)
+     * @param key Receives the key
+     * @return false if the state has no keyed form (use EncodeState instead)
+     *
+     * Keys only compare equal within one matchup: the fixed Pokemon data is not keyed.
+     */
+    bool PackKey(state::StateKey* key) const;
+
+    /**
+     * @brief Replace the dynamic battle state with one written by PackKey
+     * @param key Key packed from a state of the same matchup as the current one
+     *
+     * The fixed Pokemon data and the turn counter are kept. The charging battlers'
+     * ChargeExpire events are rescheduled in battler order and the evaluation terms
+     * are recomputed.
+     */
+    void UnpackKey(const state::StateKey& key);
+
+    /**
+     * @brief Register a sink for the battle event stream
+     * @param sink Callback invoked for every event (nullptr = stream off)
+     * @param user Opaque pointer passed back to the sink
+     *
+     * The sink is configuration, not battle state: it is not encoded or hashed.
+     */
+    void SetEventSink(EventSink sink, void* user) {
+        sink_ = sink;
+        sink_user_ = user;
+    }
+
+    /**
+     * @brief Run moves from a script table instead of their native effects
+     * @param table Scripts from LoadScriptTable (nullptr = native effects only)
+     *
+     * Moves with a script run it through the interpreter; the others keep their
+     * Effect_*. The table is configuration, not battle state: it is not encoded or
+     * hashed, and must outlive its use by the engine.
+     */
+    void SetScriptTable(const script::ScriptTable* table) { scripts_ = table; }
+
+    /**
+     * @brief The installed script table (nullptr = native effects only)
+     */
+    const script::ScriptTable* GetScriptTable() const { return scripts_; }
 
    private:
     /**
@@ -109,15 +250,35 @@ class BattleEngine {
      */
     bool DetermineTurnOrder(const BattleAction& player_action, const BattleAction& enemy_action);
 
+    /**
+     * @brief Start a turn: advance the turn counter and determine turn order
+     * @return true if the player moves first
+     */
+    bool BeginTurn(const BattleAction& player_action, const BattleAction& enemy_action);
+
+    /**
+     * @brief Run one battler's action (status may prevent it)
+     * @param battler Acting battler (0 = player, 1 = enemy)
+     * @param action The battler's action
+     */
+    void RunAction(uint8_t battler, const BattleAction& action);
+
+    /**
+     * @brief Move a battler's action uses (a Choice item lock overrides the chosen move)
+     */
+    domain::Move SelectedMove(uint8_t battler, const BattleAction& action) const;
+
+    /**
+     * @brief Finish a turn: end-of-turn effects unless the battle is over
+     */
+    void FinishTurn();
+
     /**
      * @brief Execute a single move
-     * @param attacker The attacking Pokemon
-     * @param defender The defending Pokemon
+     * @param attacker_battler The attacking battler (0 = player, 1 = enemy); the opponent defends
      * @param move The move being used
-     *
-     * Phase 1: Only handles Move::Tackle (Effect_Hit)
      */
-    void ExecuteMove(state::Pokemon& attacker, state::Pokemon& defender, domain::Move move);
+    void ExecuteMove(uint8_t attacker_battler, domain::Move move);
 
     /**
      * @brief Process end-of-turn effects
@@ -125,6 +286,7 @@ class BattleEngine {
      * Handles effects that trigger at the end of each turn:
      * - Status damage (Burn: 1/8 max HP, Poison: 1/8 max HP, Toxic: increasing)
      * - Weather damage (Sandstorm, Hail: 1/16 max HP)
+     * - Held item healing (Leftovers: 1/16 max HP)
      * - Leech Seed drain
      * - Future Sight delayed damage
      * - Weather/screen duration counters
@@ -132,17 +294,60 @@ class BattleEngine {
      * Based on pokeemerald's BattleTurnIncrementTurnCounter and status damage handlers
      *
      * Current implementation:
-     * - Burn damage (1/8 max HP per turn)
-     * - TODO: Poison, Toxic, weather damage, etc.
+     * - Status damage from the status1 table (Burn, Poison: 1/8; Toxic: counter/16)
+     * - Scheduled effects that are due this turn (Future Sight, charge expiry)
+     * - Weather damage, held item healing, Leech Seed
      */
     void EndOfTurn();
 
-    // Battle state
-    state::Pokemon player_;
-    state::Pokemon enemy_;
-    state::Field field_;
-    state::Side player_side_;
-    state::Side enemy_side_;
+    /**
+     * @brief Resolve one scheduled effect that has come due
+     * @param event The due event popped from the scheduler
+     */
+    void ResolveScheduledEffect(const state::ScheduledEvent& event);
+
+    /**
+     * @brief Apply end-of-turn damage to a battler (clamps at 0, sets faint flag)
+     * @param battler Battler index (0 = player, 1 = enemy)
+     * @param damage Damage to apply (0 = no effect)
+     */
+    void ApplyResidualDamage(uint8_t battler, uint16_t damage);
+
+    /**
+     * @brief Apply end-of-turn healing to a battler (clamps at max HP, skips fainted)
+     * @param battler Battler index (0 = player, 1 = enemy)
+     * @param heal HP to restore (0 = no effect)
+     */
+    void ApplyResidualHeal(uint8_t battler, uint16_t heal);
+
+    /**
+     * @brief Apply Leech Seed drain from a seeded battler to its seeder
+     * @param battler Battler index of the seeded Pokemon (0 = player, 1 = enemy)
+     */
+    void ApplyLeechSeed(uint8_t battler);
+
+    /**
+     * @brief Send one event to the sink (caller checks that a sink is set)
+     */
+    void Emit(EventType type, uint8_t battler, uint16_t value, uint16_t extra);
+
+    /**
+     * @brief Emit events for everything that changed since a snapshot of the battlers
+     * @param before Battlers as they were before the step
+     * @param weather_before Weather before the step
+     */
+    void EmitChanges(const state::Pokemon (&before)[state::NUM_BATTLERS],
+                     domain::Weather weather_before);
+
+    // Battle state (one contiguous, pointer-free block)
+    state::BattleState state_;
+
+    // Event stream (outside the state block: not part of the battle)
+    EventSink sink_ = nullptr;
+    void* sink_user_ = nullptr;
+
+    // Move scripts overriding native effects (configuration, like the sink)
+    const script::ScriptTable* scripts_ = nullptr;
 };
 
 }  // namespace battle
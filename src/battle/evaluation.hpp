@@ -0,0 +1,206 @@
+/**
+ * @file battle/evaluation.hpp
+ * @brief Incrementally maintained static evaluation terms
+ *
+ * The evaluation is split into a few additive terms, each stored as
+ * (player contribution - enemy contribution):
+ * - Material: HP fraction of each active Pokemon (in 1/64ths of max HP)
+ * - Stages: sum of stat stages
+ * - Status: primary status penalty
+ * - Hazards: residual pressure from entry hazards and weather chip (in 1/64ths of max HP)
+ *
+ * Commands that mutate state update the terms as they go, so reading the
+ * evaluation at a search leaf is a read instead of a recompute.
+ * Compute() rebuilds the terms from scratch; debug builds check that both agree.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../domain/species.hpp"
+#include "../domain/stats.hpp"
+#include "../domain/status.hpp"
+#include "../domain/weather.hpp"
+#include "state/field.hpp"
+#include "state/pokemon.hpp"
+#include "state/side.hpp"
+#include "type_chart.hpp"
+#include "weather_tables.hpp"
+
+namespace battle {
+namespace evaluation {
+
+/**
+ * @brief Evaluation terms (each is player minus enemy)
+ *
+ * Plain data so it is copied along with the battle state on snapshot/restore.
+ */
+struct Terms {
+    int16_t material;  // HP fraction difference (1/64ths)
+    int16_t stages;    // Stat stage sum difference
+    int16_t status;    // Status penalty difference (higher = worse for player)
+    int16_t hazards;   // Residual pressure difference (higher = worse for player)
+};
+
+/**
+ * @brief Weight applied to the stage term when combining into a score
+ */
+constexpr int16_t STAGE_WEIGHT = 2;
+
+// ============================================================================
+// Per-Pokemon term functions
+// ============================================================================
+
+/**
+ * @brief Material term: current HP as a fraction of max HP (0-64)
+ */
+inline int16_t MaterialTerm(const state::Pokemon& p) {
+    if (p.max_hp == 0) {
+        return 0;
+    }
+    return static_cast<int16_t>((static_cast<uint32_t>(p.current_hp) * 64) / p.max_hp);
+}
+
+/**
+ * @brief Stage term: sum of all battle stat stages (HP slot is always 0)
+ */
+inline int16_t StageTerm(const state::Pokemon& p) {
+    int16_t sum = 0;
+    for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
+        sum += p.stat_stages[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Status term: penalty for the primary status condition
+ *
+ * Roughly ordered by how much each status limits the Pokemon.
+ */
+inline int16_t StatusTerm(const state::Pokemon& p) {
+    if (p.status1 == domain::Status1::NONE) {
+        return 0;
+    }
+    if (p.status1 & domain::Status1::FREEZE) {
+        return 16;
+    }
+    if (p.status1 & domain::Status1::SLEEP) {
+        return 12;
+    }
+    if (p.status1 & domain::Status1::TOXIC) {
+        return 10;
+    }
+    if (p.status1 & (domain::Status1::BURN | domain::Status1::PARALYSIS)) {
+        return 8;
+    }
+    return 6;  // Regular poison
+}
+
+/**
+ * @brief Hazard term: residual chip pressure on a Pokemon (1/64ths of max HP)
+ *
+ * - Stealth Rock on its side: (effectiveness / 32) of max HP on switch-in
+ * - Sandstorm, Hail: 1/16 of max HP per turn for non-immune types
+ */
+inline int16_t HazardTerm(const state::Pokemon& p, const state::Side& side,
+                          const state::Field& field) {
+    int16_t pressure = 0;
+    if (side.stealth_rock) {
+        pressure += types::GetTypeEffectiveness(domain::Type::Rock, p.type1, p.type2) * 2;
+    }
+    if (weather::TakesResidualDamage(field.weather, p)) {
+        pressure += 4;
+    }
+    return pressure;
+}
+
+// ============================================================================
+// Full recompute and scoring
+// ============================================================================
+
+/**
+ * @brief Compute all terms from scratch
+ */
+inline Terms Compute(const state::Pokemon& player, const state::Pokemon& enemy,
+                     const state::Field& field, const state::Side& player_side,
+                     const state::Side& enemy_side) {
+    Terms terms;
+    terms.material = MaterialTerm(player) - MaterialTerm(enemy);
+    terms.stages = StageTerm(player) - StageTerm(enemy);
+    terms.status = StatusTerm(player) - StatusTerm(enemy);
+    terms.hazards = HazardTerm(player, player_side, field) - HazardTerm(enemy, enemy_side, field);
+    return terms;
+}
+
+/**
+ * @brief Combine terms into a single score (positive = good for player)
+ */
+inline int16_t Score(const Terms& terms) {
+    return terms.material + STAGE_WEIGHT * terms.stages - terms.status - terms.hazards;
+}
+
+/**
+ * @brief Check two sets of terms for equality
+ */
+inline bool Equal(const Terms& a, const Terms& b) {
+    return a.material == b.material && a.stages == b.stages && a.status == b.status &&
+           a.hazards == b.hazards;
+}
+
+// ============================================================================
+// Incremental updates
+// ============================================================================
+
+/**
+ * @brief Sign of a battler's contribution (player adds, enemy subtracts)
+ */
+inline int16_t Sign(uint8_t battler) {
+    return battler == 0 ? 1 : -1;
+}
+
+/**
+ * @brief Update the material term after a Pokemon's HP changed
+ *
+ * @param terms Accumulator (nullptr when no accumulator is attached)
+ * @param battler Battler whose HP changed (0 = player, 1 = enemy)
+ * @param before MaterialTerm() of the Pokemon before the change
+ * @param p The Pokemon after the change
+ */
+inline void UpdateMaterial(Terms* terms, uint8_t battler, int16_t before,
+                           const state::Pokemon& p) {
+    if (terms != nullptr) {
+        terms->material += Sign(battler) * (MaterialTerm(p) - before);
+    }
+}
+
+/**
+ * @brief Update the stage term after a Pokemon's stat stages changed
+ */
+inline void UpdateStages(Terms* terms, uint8_t battler, int16_t before, const state::Pokemon& p) {
+    if (terms != nullptr) {
+        terms->stages += Sign(battler) * (StageTerm(p) - before);
+    }
+}
+
+/**
+ * @brief Update the status term after a Pokemon's status1 changed
+ */
+inline void UpdateStatus(Terms* terms, uint8_t battler, int16_t before, const state::Pokemon& p) {
+    if (terms != nullptr) {
+        terms->status += Sign(battler) * (StatusTerm(p) - before);
+    }
+}
+
+/**
+ * @brief Update the hazard term after a side's hazards or the weather changed
+ */
+inline void UpdateHazards(Terms* terms, uint8_t battler, int16_t before, const state::Pokemon& p,
+                          const state::Side& side, const state::Field& field) {
+    if (terms != nullptr) {
+        terms->hazards += Sign(battler) * (HazardTerm(p, side, field) - before);
+    }
+}
+
+}  // namespace evaluation
+}  // namespace battle
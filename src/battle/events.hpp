@@ -0,0 +1,54 @@
+/**
+ * @file battle/events.hpp
+ * @brief Battle event stream
+ *
+ * The Engine can report what happened during a turn as a stream of small,
+ * fixed-size events (the same things the TODO "Display message" comments
+ * describe). Events are emitted through an optional sink callback, so the
+ * stream costs one pointer check per emission point when nobody listens.
+ *
+ * Events are derived by diffing battler state around each move and around the
+ * end-of-turn phase, so commands do not need to know about the stream.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace battle {
+
+/**
+ * @brief Kind of battle event
+ */
+enum class EventType : uint8_t {
+    TurnStart = 0,  // value = turn number
+    MoveUsed,       // battler used a move; value = move id
+    MoveFailed,     // battler's move failed; value = move id
+    HpChanged,      // value = new HP, extra = old HP
+    StatusChanged,  // value = new status1, extra = old status1
+    Fainted,        // battler fainted
+    WeatherChanged, // value = new weather, extra = old weather
+    EndOfTurn,      // End-of-turn effects follow (residual damage, weather, delayed effects)
+};
+
+/**
+ * @brief One battle event (8 bytes, plain data)
+ */
+struct BattleEvent {
+    uint16_t turn;     // Turn the event happened on
+    EventType type;    // What happened
+    uint8_t battler;   // Battler it happened to (0 = player, 1 = enemy)
+    uint16_t value;    // Type-specific payload (see EventType)
+    uint16_t extra;    // Type-specific payload (see EventType)
+};
+
+static_assert(sizeof(BattleEvent) == 8, "BattleEvent must stay 8 bytes");
+
+/**
+ * @brief Event sink callback
+ * @param user Opaque pointer registered with the sink
+ * @param event The event (valid only for the duration of the call)
+ */
+using EventSink = void (*)(void* user, const BattleEvent& event);
+
+}  // namespace battle
@@ -0,0 +1,112 @@
+/**
+ * @file battle/items.hpp
+ * @brief Held item effects, registered per battle event
+ *
+ * Each item has a mask of the events it hooks (HOOKS table). A battle keeps
+ * the union of its battlers' masks (BattleState::item_hooks), so the damage,
+ * speed, drain and end-of-turn paths test one bit and skip item processing
+ * entirely when no held item cares about that event.
+ *
+ * Based on pokeemerald:
+ * - src/battle_main.c:GetWhoStrikesFirst (Quick Claw, Macho Brace)
+ * - src/battle_util.c:CalculateBaseDamage (Choice Band)
+ * - src/battle_util.c:ItemBattleEffects (Leftovers)
+ * - src/battle_main.c:HandleAction_UseMove (Choice Band move lock)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../domain/item.hpp"
+#include "../domain/move.hpp"
+#include "state/pokemon.hpp"
+
+namespace battle {
+namespace items {
+
+// Battle events an item can hook (bit flags)
+constexpr uint8_t HOOK_SPEED = (1 << 0);        // Turn order speed (Quick Claw, Macho Brace)
+constexpr uint8_t HOOK_DAMAGE = (1 << 1);       // Attacker's damage (Choice Band)
+constexpr uint8_t HOOK_DRAIN = (1 << 2);        // Drain healing (Big Root)
+constexpr uint8_t HOOK_END_OF_TURN = (1 << 3);  // End-of-turn effects (Leftovers)
+constexpr uint8_t HOOK_MOVE_LOCK = (1 << 4);    // Move selection (Choice Band)
+
+/**
+ * @brief Events hooked by each item, indexed by Item
+ */
+inline constexpr uint8_t HOOKS[domain::NUM_ITEMS] = {
+    0,                             // None
+    HOOK_END_OF_TURN,              // Leftovers
+    HOOK_DAMAGE | HOOK_MOVE_LOCK,  // ChoiceBand
+    HOOK_SPEED,                    // QuickClaw
+    HOOK_SPEED,                    // MachoBrace
+    HOOK_DRAIN,                    // BigRoot
+};
+
+/**
+ * @brief Events hooked by an item
+ */
+inline uint8_t Hooks(domain::Item item) {
+    uint8_t index = static_cast<uint8_t>(item);
+    return index < domain::NUM_ITEMS ? HOOKS[index] : 0;
+}
+
+/**
+ * @brief Events hooked by any held item in a battle (singles)
+ */
+inline uint8_t BattleHooks(const state::Pokemon& player, const state::Pokemon& enemy) {
+    return Hooks(player.item) | Hooks(enemy.item);
+}
+
+/**
+ * @brief Turn order speed after Macho Brace (halved)
+ */
+inline uint16_t ModifySpeed(const state::Pokemon& p, uint16_t speed) {
+    return p.item == domain::Item::MachoBrace ? speed / 2 : speed;
+}
+
+/**
+ * @brief Attack used for damage after Choice Band (1.5x)
+ */
+inline int ModifyAttack(const state::Pokemon& p, int attack) {
+    return p.item == domain::Item::ChoiceBand ? (150 * attack) / 100 : attack;
+}
+
+/**
+ * @brief Drain healing after Big Root (1.3x)
+ */
+inline uint16_t ModifyDrain(const state::Pokemon& p, uint16_t drain) {
+    return p.item == domain::Item::BigRoot ? static_cast<uint16_t>((drain * 130) / 100) : drain;
+}
+
+/**
+ * @brief End-of-turn healing from the held item (Leftovers: 1/16 max HP, minimum 1)
+ * @return HP to restore (0 if no item effect, fainted or already at full HP)
+ */
+inline uint16_t EndOfTurnHeal(const state::Pokemon& p) {
+    if (p.item != domain::Item::Leftovers || p.is_fainted || p.current_hp >= p.max_hp) {
+        return 0;
+    }
+    uint16_t heal = p.max_hp / 16;
+    return heal == 0 ? 1 : heal;
+}
+
+/**
+ * @brief Move a battler actually uses (a Choice lock overrides the chosen move)
+ */
+inline domain::Move LockedMove(const state::Pokemon& p, domain::Move chosen) {
+    return p.choiced_move != domain::Move::None ? p.choiced_move : chosen;
+}
+
+/**
+ * @brief Record the move that locks a Choice item holder (first move used)
+ */
+inline void LockChoice(state::Pokemon& p, domain::Move used) {
+    if (p.item == domain::Item::ChoiceBand && p.choiced_move == domain::Move::None) {
+        p.choiced_move = used;
+    }
+}
+
+}  // namespace items
+}  // namespace battle
@@ -0,0 +1,123 @@
+/**
+ * @file battle/move_data.cpp
+ * @brief Move database
+ */
+
+#include "move_data.hpp"
+
+#include <stddef.h>
+
+namespace battle {
+
+/**
+ * @brief Move database - contains all implemented moves with their stats
+ *
+ * This replaces the hardcoded GetMoveData_Hardcoded function from Phase 2.
+ * Indexed by Move enum value.
+ */
+static const domain::MoveData MOVE_DATABASE[] = {
+    // Move::None
+    {domain::Move::None, domain::Type::Normal, 0, 0, 0, 0, 0},
+
+    // Move::Tackle
+    {domain::Move::Tackle, domain::Type::Normal, 40, 100, 35, 0, 0},
+
+    // Move::Ember
+    {domain::Move::Ember, domain::Type::Fire, 40, 100, 25, 10, 0},
+
+    // Move::ThunderWave
+    {domain::Move::ThunderWave, domain::Type::Electric, 0, 100, 20, 100, 0},
+
+    // Move::Growl
+    {domain::Move::Growl, domain::Type::Normal, 0, 100, 40, 0, 0},
+
+    // Move::TailWhip
+    {domain::Move::TailWhip, domain::Type::Normal, 0, 100, 30, 0, 0},
+
+    // Move::SwordsDance
+    {domain::Move::SwordsDance, domain::Type::Normal, 0, 0, 30, 0, 0},
+
+    // Move::DoubleEdge
+    {domain::Move::DoubleEdge, domain::Type::Normal, 120, 100, 15, 0, 0},
+
+    // Move::GigaDrain
+    {domain::Move::GigaDrain, domain::Type::Grass, 60, 100, 5, 0, 0},
+
+    // Move::IronDefense
+    {domain::Move::IronDefense, domain::Type::Normal, 0, 0, 15, 0, 0},
+
+    // Move::StringShot
+    {domain::Move::StringShot, domain::Type::Bug, 0, 95, 40, 0, 0},
+
+    // Move::Agility
+    {domain::Move::Agility, domain::Type::Psychic, 0, 0, 30, 0, 0},
+
+    // Move::TailGlow
+    {domain::Move::TailGlow, domain::Type::Bug, 0, 0, 20, 0, 0},
+
+    // Move::FakeTears
+    {domain::Move::FakeTears, domain::Type::Dark, 0, 100, 20, 0, 0},
+
+    // Move::Amnesia
+    {domain::Move::Amnesia, domain::Type::Psychic, 0, 0, 20, 0, 0},
+
+    // Move::FuryAttack
+    {domain::Move::FuryAttack, domain::Type::Normal, 15, 85, 20, 0, 0},
+
+    // Move::Protect
+    {domain::Move::Protect, domain::Type::Normal, 0, 0, 10, 0, 4},
+
+    // Move::SolarBeam
+    {domain::Move::SolarBeam, domain::Type::Grass, 120, 100, 10, 0, 0},
+
+    // Move::Fly
+    {domain::Move::Fly, domain::Type::Flying, 70, 95, 15, 0, 0},
+
+    // Move::Substitute
+    {domain::Move::Substitute, domain::Type::Normal, 0, 0, 10, 0, 0},
+
+    // Move::BatonPass
+    {domain::Move::BatonPass, domain::Type::Normal, 0, 0, 40, 0, 0},
+
+    // Move::Sandstorm
+    {domain::Move::Sandstorm, domain::Type::Rock, 0, 0, 10, 0, 0},
+
+    // Move::QuickAttack
+    {domain::Move::QuickAttack, domain::Type::Normal, 40, 100, 30, 0, 1},
+
+    // Move::StealthRock
+    {domain::Move::StealthRock, domain::Type::Rock, 0, 0, 20, 0, 0},
+
+    // Move::LeechSeed
+    {domain::Move::LeechSeed, domain::Type::Grass, 0, 90, 10, 0, 0},
+
+    // Move::FutureSight
+    {domain::Move::FutureSight, domain::Type::Psychic, 80, 90, 15, 0, 0},
+
+    // Move::RainDance
+    {domain::Move::RainDance, domain::Type::Water, 0, 0, 5, 0, 0},
+
+    // Move::SunnyDay
+    {domain::Move::SunnyDay, domain::Type::Fire, 0, 0, 5, 0, 0},
+
+    // Move::Hail
+    {domain::Move::Hail, domain::Type::Ice, 0, 0, 10, 0, 0},
+};
+
+/**
+ * @brief Number of entries in move database
+ */
+constexpr size_t MOVE_DATABASE_SIZE = sizeof(MOVE_DATABASE) / sizeof(MOVE_DATABASE[0]);
+
+const domain::MoveData& GetMoveData(domain::Move move) {
+    uint8_t index = static_cast<uint8_t>(move);
+
+    // Bounds check
+    if (index >= MOVE_DATABASE_SIZE) {
+        return MOVE_DATABASE[0];  // Return None if out of bounds
+    }
+
+    return MOVE_DATABASE[index];
+}
+
+}  // namespace battle
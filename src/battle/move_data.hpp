@@ -0,0 +1,24 @@
+/**
+ * @file battle/move_data.hpp
+ * @brief Move database lookup
+ *
+ * Moves are referred to by id (domain::Move); their static data lives in one
+ * table so battle state and contexts never need to carry move pointers around.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../domain/move.hpp"
+
+namespace battle {
+
+/**
+ * @brief Get move data from database
+ * @param move The move to look up
+ * @return MoveData for the move (Move::None entry if out of range)
+ */
+const domain::MoveData& GetMoveData(domain::Move move);
+
+}  // namespace battle
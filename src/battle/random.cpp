@@ -21,34 +21,69 @@
     static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count())
 #endif
 
+// Generator state is per thread on the host (batch runners step battles on several
+// threads); the calculator is single-threaded
+#ifdef _EZ80
+#define RANDOM_THREAD_LOCAL
+#else
+#define RANDOM_THREAD_LOCAL thread_local
+#endif
+
 namespace battle {
 namespace random {
 
-// PCG32 state (64-bit state + 64-bit increment)
-// Reference defaults from PCG32_INITIALIZER
-static uint64_t g_state = 0x853c49e6748fea9bULL;
-static uint64_t g_inc = 0xda3e39cb94b95bdbULL;
+/**
+ * @brief One PCG32 stream (64-bit state + 64-bit increment)
+ */
+struct Generator {
+    uint64_t state;
+    uint64_t inc;  // Odd; selects the stream
+};
+
+// Reference defaults from PCG32_INITIALIZER (every stream until Initialize is called)
+static RANDOM_THREAD_LOCAL Generator g_streams[NUM_STREAMS] = {
+    {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL}, {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL},
+    {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL}, {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL},
+    {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL}, {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL},
+    {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL}, {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL},
+    {0x853c49e6748fea9bULL, 0xda3e39cb94b95bdbULL},
+};
+static_assert(sizeof(g_streams) / sizeof(g_streams[0]) == NUM_STREAMS,
+              "One default generator per stream");
+
+// Stream of the draw being served (read by the recording source)
+static RANDOM_THREAD_LOCAL Stream g_draw_stream = Stream::General;
+
+// Battle making the current draws (read by the tapping source)
+static RANDOM_THREAD_LOCAL const void* g_draw_owner = nullptr;
+
+// Injected draw source (draw == nullptr = PCG32)
+static RANDOM_THREAD_LOCAL Source g_source = {nullptr, nullptr};
+
+// Shared script behind forced-draw mode
+static RANDOM_THREAD_LOCAL Script g_forced_script;
 
 /**
- * @brief PCG32 algorithm (internal)
- * @return Random uint32_t
- *
- * PCG XSH RR 64/32 variant:
- * - 64-bit LCG state
- * - XOR shift + rotate output transformation
- * - Period: 2^64
+ * @brief Advance one stream (internal)
  */
-static uint32_t PCG32_Next() {
-    uint64_t oldstate = g_state;
-    // LCG step: state = state * multiplier + increment
-    g_state = oldstate * 6364136223846793005ULL + g_inc;
+static uint32_t PCG32_Next(Generator& generator) {
+    return Pcg32Step(generator.state, generator.inc);
+}
 
-    // Output permutation (XSH RR):
-    // - XOR high and low bits, shift right
-    // - Rotate by top bits for final mixing
-    uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-    uint32_t rot = oldstate >> 59u;
-    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+/**
+ * @brief Reduce a raw output to [0, bound) without dividing (internal)
+ *
+ * Power-of-two bounds (speed tie, full paralysis, multi-hit) keep the low bits;
+ * the others (Random(100) percent rolls) take the high half of raw * bound,
+ * Lemire's multiply-shift. Bias ≈ (2^32 mod bound) / 2^32, as with a modulo:
+ * Random(100) = 96/4294967296 ≈ 0.0000022%, orders of magnitude below EZ80
+ * hardware measurement error.
+ */
+static inline uint16_t Bounded(uint32_t raw, uint16_t bound) {
+    if ((bound & (bound - 1)) == 0) {
+        return static_cast<uint16_t>(raw & (bound - 1));
+    }
+    return static_cast<uint16_t>((static_cast<uint64_t>(raw) * bound) >> 32);
 }
 
 void Initialize(uint32_t seed) {
@@ -57,24 +92,164 @@ void Initialize(uint32_t seed) {
         seed = GET_ENTROPY_SEED();
     }
 
-    // Seeding algorithm from pcg32_srandom_r()
+    // Seeding algorithm from pcg32_srandom_r(seed, seq)
     // Uses two-step initialization for proper state mixing
-    g_state = 0U;
-    g_inc = ((uint64_t)seed << 1u) | 1u;  // Ensure increment is odd
-    PCG32_Next();                         // First iteration
-    g_state += seed;                      // Mix in seed
-    PCG32_Next();                         // Second iteration for avalanche
+    // Stream s uses sequence seed + s * golden ratio (s = 0: the single-stream sequence)
+    for (uint8_t s = 0; s < NUM_STREAMS; s++) {
+        Generator& generator = g_streams[s];
+        uint64_t sequence = seed + s * 0x9e3779b97f4a7c15ULL;
+        generator.state = 0U;
+        generator.inc = (sequence << 1u) | 1u;  // Ensure increment is odd
+        PCG32_Next(generator);                  // First iteration
+        generator.state += seed;                // Mix in seed
+        PCG32_Next(generator);                  // Second iteration for avalanche
+    }
 }
 
-uint16_t Random(uint16_t max) {
+uint16_t Random(uint16_t max, Stream stream) {
     if (max == 0)
         return 0;
 
-    // Simple modulo (could be replaced with bounded rand for perfect uniformity)
-    // Bias ≈ (2^32 mod bound) / 2^32   : Random(100) = 96/4294967296 ≈ 0.0000022%
-    //                                  : Random(2^N) = 0
-    // --> should be orders of magnitidue smaller than EZ80 hardware measurement error
-    return PCG32_Next() % max;
+    if (g_source.draw != nullptr) {
+        g_draw_stream = stream;
+        return g_source.draw(g_source.context, max);
+    }
+
+    return Bounded(PCG32_Next(g_streams[static_cast<uint8_t>(stream)]), max);
+}
+
+void SetSource(const Source& source) {
+    g_source = source;
+}
+
+void ResetSource() {
+    g_source.draw = nullptr;
+    g_source.context = nullptr;
+}
+
+/**
+ * @brief Record a draw in a script (shared by the scripted and recording sources)
+ */
+static void RecordDraw(Script& script, uint16_t bound, uint16_t value) {
+    if (script.draws < MAX_RECORDED_DRAWS) {
+        script.records[script.draws].bound = bound;
+        script.records[script.draws].value = value;
+    }
+    if (script.draws < 255) {
+        script.draws++;
+    }
+}
+
+/**
+ * @brief Scripted draw (Source callback)
+ */
+static uint16_t ScriptDraw(void* context, uint16_t bound) {
+    Script& script = *static_cast<Script*>(context);
+    uint16_t value = (script.draws < script.count) ? script.values[script.draws] % bound : 0;
+    RecordDraw(script, bound, value);
+    return value;
+}
+
+/**
+ * @brief Recorded PCG32 draw (Source callback)
+ */
+static uint16_t RecordingDraw(void* context, uint16_t bound) {
+    uint16_t value = Bounded(PCG32_Next(g_streams[static_cast<uint8_t>(g_draw_stream)]), bound);
+    RecordDraw(*static_cast<Script*>(context), bound, value);
+    return value;
+}
+
+void BeginRecording(Script& script) {
+    script.values = nullptr;
+    script.count = 0;
+    script.draws = 0;
+    SetSource(Source{RecordingDraw, &script});
+}
+
+// Tap behind the tapping source
+static RANDOM_THREAD_LOCAL Tap g_tap = {nullptr, nullptr};
+
+/**
+ * @brief Tapped PCG32 draw (Source callback)
+ */
+static uint16_t TapDraw(void*, uint16_t bound) {
+    uint16_t value = Bounded(PCG32_Next(g_streams[static_cast<uint8_t>(g_draw_stream)]), bound);
+    g_tap.observe(g_tap.context, g_draw_owner, bound, value);
+    return value;
+}
+
+void BeginTap(const Tap& tap) {
+    g_tap = tap;
+    SetSource(Source{TapDraw, nullptr});
+}
+
+void SetDrawOwner(const void* owner) {
+    g_draw_owner = owner;
+}
+
+void BeginScript(Script& script, const uint16_t* values, uint8_t count) {
+    script.values = values;
+    script.count = count;
+    script.draws = 0;
+    SetSource(Source{ScriptDraw, &script});
+}
+
+uint8_t EndScript(Script& script) {
+    ResetSource();
+    return script.draws;
+}
+
+void BeginEnumeration(Enumerator& enumerator) {
+    BeginScript(enumerator.script, enumerator.prefix, 0);
+}
+
+bool NextOutcome(Enumerator& enumerator) {
+    Script& script = enumerator.script;
+    uint8_t draws = EndScript(script);
+    if (draws > MAX_RECORDED_DRAWS) {
+        return false;
+    }
+
+    // Advance the odometer: bump the deepest draw that has values left
+    int deepest = static_cast<int>(draws) - 1;
+    while (deepest >= 0 && script.records[deepest].value + 1 >= script.records[deepest].bound) {
+        deepest--;
+    }
+    if (deepest < 0) {
+        return false;
+    }
+    for (int i = 0; i < deepest; i++) {
+        enumerator.prefix[i] = script.records[i].value;
+    }
+    enumerator.prefix[deepest] = script.records[deepest].value + 1;
+
+    BeginScript(script, enumerator.prefix, static_cast<uint8_t>(deepest + 1));
+    return true;
+}
+
+uint32_t OutcomeSpace(const Enumerator& enumerator) {
+    uint32_t space = 1;
+    uint8_t draws = enumerator.script.draws;
+    if (draws > MAX_RECORDED_DRAWS) {
+        draws = MAX_RECORDED_DRAWS;
+    }
+    for (uint8_t i = 0; i < draws; i++) {
+        space *= enumerator.script.records[i].bound;
+    }
+    return space;
+}
+
+void BeginForcedDraws(const uint16_t* forced, uint8_t forced_count) {
+    BeginScript(g_forced_script, forced, forced_count);
+}
+
+uint8_t EndForcedDraws(DrawRecord* records) {
+    uint8_t draws = EndScript(g_forced_script);
+    uint8_t recorded = (draws < MAX_RECORDED_DRAWS) ? draws : MAX_RECORDED_DRAWS;
+    for (uint8_t i = 0; i < recorded; i++) {
+        records[i] = g_forced_script.records[i];
+    }
+    return draws;
 }
 
 }  // namespace random
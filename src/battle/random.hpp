@@ -16,10 +16,70 @@
 namespace battle {
 namespace random {
 
+/**
+ * @brief Independent PCG32 substreams, one per random call site
+ *
+ * Each call site draws from its own stream, so adding, removing or reordering
+ * draws in one mechanic leaves every other mechanic's draws unchanged. Two engine
+ * versions run from the same seed then see the same luck wherever their
+ * mechanics agree, which keeps paired comparisons between them correlated.
+ *
+ * New call sites get a new stream (appended before NUM_STREAMS); reusing an
+ * existing one couples the two mechanics again.
+ */
+enum class Stream : uint8_t {
+    General,          // Random(max) without a stream (tests, tools)
+    Accuracy,         // Accuracy roll (reserved: AccuracyCheck does not roll yet)
+    StatusGate,       // Sleep/freeze/paralysis action gate (status::TABLE)
+    BurnChance,       // Secondary burn proc (TryApplyBurn)
+    ParalysisChance,  // Paralysis proc (TryApplyParalysis)
+    MultiHit,         // Multi-hit count
+    Protect,          // Protect success
+    QuickClaw,        // Quick Claw activation
+    SpeedTie,         // Speed tie
+    NUM_STREAMS,
+};
+
+constexpr uint8_t NUM_STREAMS = static_cast<uint8_t>(Stream::NUM_STREAMS);
+
+/**
+ * @brief PCG32 LCG multiplier
+ */
+constexpr uint64_t PCG32_MULTIPLIER = 6364136223846793005ULL;
+
+/**
+ * @brief PCG32 algorithm: advance a generator and return its next output
+ * @param state 64-bit LCG state (advanced)
+ * @param inc Odd increment (selects the stream)
+ * @return Random uint32_t
+ *
+ * PCG XSH RR 64/32 variant:
+ * - 64-bit LCG state
+ * - XOR shift + rotate output transformation
+ * - Period: 2^64
+ *
+ * Exposed so batched generators (host kernels) can match the engine bit for bit.
+ */
+inline uint32_t Pcg32Step(uint64_t& state, uint64_t inc) {
+    uint64_t oldstate = state;
+    // LCG step: state = state * multiplier + increment
+    state = oldstate * PCG32_MULTIPLIER + inc;
+
+    // Output permutation (XSH RR):
+    // - XOR high and low bits, shift right
+    // - Rotate by top bits for final mixing
+    uint32_t xorshifted = static_cast<uint32_t>(((oldstate >> 18u) ^ oldstate) >> 27u);
+    uint32_t rot = static_cast<uint32_t>(oldstate >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
 /**
  * @brief Initialize RNG with seed
  * @param seed Random seed (0 = use rtc_Time() for hardware entropy)
  *
+ * Seeds every stream: Stream::General gets the classic single-stream sequence for
+ * the seed, each other stream its own PCG32 increment.
+ *
  * For deterministic testing: Initialize(0x12345678)
  * For normal gameplay: Initialize() uses RTC automatically
  */
@@ -28,13 +88,191 @@ void Initialize(uint32_t seed = 0);
 /**
  * @brief Generate a random number in range [0, max)
  * @param max Upper bound (exclusive)
+ * @param stream Substream to draw from (engine call sites always name theirs)
  * @return Random number from 0 to max-1
  *
  * Examples:
  * - Random(100) returns 0-99 (for percentage rolls)
  * - Random(16) returns 0-15 (for 1/16 chance)
  */
-uint16_t Random(uint16_t max);
+uint16_t Random(uint16_t max, Stream stream = Stream::General);
+
+// ============================================================================
+// Injectable draw sources
+// ============================================================================
+
+/**
+ * @brief Source of bounded draws that replaces PCG32 while installed
+ *
+ * draw(context, bound) must return a value in [0, bound). Bound 0 never reaches
+ * a source (Random(0) returns 0 without drawing). Sources see every stream's draws
+ * in call order.
+ */
+struct Source {
+    uint16_t (*draw)(void* context, uint16_t bound);
+    void* context;
+};
+
+/**
+ * @brief Install a draw source (draw == nullptr restores the production PCG32)
+ */
+void SetSource(const Source& source);
+
+/**
+ * @brief Restore the production PCG32 source
+ */
+void ResetSource();
+
+/**
+ * @brief Maximum number of draws recorded by the scripted and enumerating sources
+ */
+constexpr uint8_t MAX_RECORDED_DRAWS = 32;
+
+/**
+ * @brief One recorded draw: the bound passed to Random() and the value returned
+ */
+struct DrawRecord {
+    uint16_t bound;
+    uint16_t value;
+};
+
+/**
+ * @brief Scripted source: returns a fixed sequence of values, then 0, recording every draw
+ */
+struct Script {
+    const uint16_t* values;                  // Values for the first count draws
+    uint8_t count;                           // Number of scripted values
+    uint8_t draws;                           // Draws made so far (saturates at 255)
+    DrawRecord records[MAX_RECORDED_DRAWS];  // First MAX_RECORDED_DRAWS draws
+};
+
+/**
+ * @brief Install a scripted source
+ * @param script Script state (must outlive the run)
+ * @param values Values to return (reduced modulo the bound of their draw)
+ * @param count Number of values
+ */
+void BeginScript(Script& script, const uint16_t* values, uint8_t count);
+
+/**
+ * @brief Install a recording source: draws come from PCG32 as usual and are recorded
+ * @param script Receives the draws (values/count are unused)
+ *
+ * Each draw advances its own PCG32 stream exactly as it would without recording,
+ * so a recorded run can be replayed elsewhere with BeginScript(records' values).
+ */
+void BeginRecording(Script& script);
+
+/**
+ * @brief Receives every draw of a tapped run
+ *
+ * observe(context, owner, bound, value): owner is the battle that made the draw
+ * (SetDrawOwner), bound and value as passed to and returned by Random().
+ */
+struct Tap {
+    void (*observe)(void* context, const void* owner, uint16_t bound, uint16_t value);
+    void* context;
+};
+
+/**
+ * @brief Install a tapping source: draws come from PCG32 as usual and are passed to the tap
+ *
+ * Like BeginRecording, but unbounded and attributed per battle, so the draws of
+ * battles stepped interleaved (BattleEngine::StepMany) can be told apart.
+ * ResetSource uninstalls it.
+ */
+void BeginTap(const Tap& tap);
+
+/**
+ * @brief Name the battle making the draws that follow
+ *
+ * The engine names itself at the start of each turn phase. Only a tap reads it;
+ * it is not part of any stream's state.
+ */
+void SetDrawOwner(const void* owner);
+
+/**
+ * @brief Uninstall a scripted or recording source (restores PCG32)
+ * @return Number of draws made (may exceed MAX_RECORDED_DRAWS; extra draws are not recorded)
+ */
+uint8_t EndScript(Script& script);
+
+/**
+ * @brief Exhaustive enumerator: visits every combination of draw values exactly once
+ *
+ * Walks the draws like an odometer. Each outcome runs with a forced prefix
+ * (later draws return 0); afterwards the deepest draw that has values left is
+ * bumped and the run repeats. Draws after a bumped one are rediscovered, since
+ * which draws happen can depend on earlier values.
+ *
+ * Usage:
+ *   Enumerator outcomes;
+ *   BeginEnumeration(outcomes);
+ *   do {
+ *       ... run the mechanic once ...
+ *       weight = TOTAL / OutcomeSpace(outcomes);
+ *   } while (NextOutcome(outcomes));
+ */
+struct Enumerator {
+    uint16_t prefix[MAX_RECORDED_DRAWS];  // Forced values for the current outcome
+    Script script;                        // Current outcome's source and records
+};
+
+/**
+ * @brief Install an enumerating source positioned at the first outcome (all draws 0)
+ */
+void BeginEnumeration(Enumerator& enumerator);
+
+/**
+ * @brief Finish the current outcome and move to the next one
+ * @return true if another outcome is installed; false once every outcome has been
+ *         visited or the current outcome was truncated (PCG32 is restored)
+ */
+bool NextOutcome(Enumerator& enumerator);
+
+/**
+ * @brief Number of draws made by the current outcome
+ */
+inline uint8_t OutcomeDraws(const Enumerator& enumerator) {
+    return enumerator.script.draws;
+}
+
+/**
+ * @brief True if the current outcome made too many draws to enumerate
+ */
+inline bool OutcomeTruncated(const Enumerator& enumerator) {
+    return enumerator.script.draws > MAX_RECORDED_DRAWS;
+}
+
+/**
+ * @brief Number of equally likely outcomes the current one stands for
+ *
+ * The product of the bounds of its draws: the outcome has probability
+ * 1 / OutcomeSpace. Only meaningful when the outcome is not truncated and the
+ * product fits in 32 bits.
+ */
+uint32_t OutcomeSpace(const Enumerator& enumerator);
+
+// ============================================================================
+// Forced-draw mode (a process-wide scripted source)
+// ============================================================================
+
+/**
+ * @brief Enter forced-draw mode
+ * @param forced Values to return for the first forced_count draws
+ * @param forced_count Number of forced values
+ *
+ * Installs a shared Script: Random(max) does not advance PCG32. The i-th draw
+ * returns forced[i] for i < forced_count and 0 after that, and every draw is recorded.
+ */
+void BeginForcedDraws(const uint16_t* forced, uint8_t forced_count);
+
+/**
+ * @brief Leave forced-draw mode and collect the recorded draws
+ * @param records Receives up to MAX_RECORDED_DRAWS records
+ * @return Number of draws made (may exceed MAX_RECORDED_DRAWS; extra draws are not recorded)
+ */
+uint8_t EndForcedDraws(DrawRecord* records);
 
 }  // namespace random
 }  // namespace battle
@@ -0,0 +1,296 @@
+/**
+ * @file battle/script/interpreter.cpp
+ * @brief Battle script bytecode interpreter implementation
+ */
+
+#include "interpreter.hpp"
+
+#include "../commands/accuracy.hpp"
+#include "../commands/damage.hpp"
+#include "../commands/drain.hpp"
+#include "../commands/faint.hpp"
+#include "../commands/recoil.hpp"
+#include "../commands/stat_modify.hpp"
+#include "../commands/status.hpp"
+#include "../commands/weather.hpp"
+#include "opcodes.hpp"
+
+namespace battle {
+namespace script {
+
+// ============================================================================
+// Shared instruction bodies
+// ============================================================================
+
+/**
+ * @brief Resolve a chance operand (0 = use the move's effect_chance)
+ */
+static inline uint8_t ChanceOperand(const BattleContext& ctx, uint8_t operand) {
+    return (operand == 0) ? ctx.move->effect_chance : operand;
+}
+
+static inline void DoHit(BattleContext& ctx) {
+    commands::AccuracyCheck(ctx);
+    commands::CalculateDamage(ctx);
+    commands::ApplyDamage(ctx);
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+/**
+ * @brief Check an instruction's operand values (the commands index tables with them)
+ */
+static bool ValidOperands(Op op, const uint8_t* operands) {
+    switch (op) {
+        case Op::TryBurn:
+        case Op::TryParalysis:
+            return operands[0] <= 100;  // Percent chance (0 = move's effect_chance)
+        case Op::ModifyStat:
+        case Op::ModifyStatSelf: {
+            // Battle stats only (HP has no stage); change within one full stage range
+            int8_t change = static_cast<int8_t>(operands[1]);
+            return operands[0] >= domain::STAT_ATK && operands[0] < domain::NUM_BATTLE_STATS &&
+                   change != 0 && change >= -MAX_STAGE_CHANGE && change <= MAX_STAGE_CHANGE;
+        }
+        case Op::Recoil:
+        case Op::Drain:
+            return operands[0] >= 1 && operands[0] <= 100;
+        case Op::SetWeather:
+            // Clearing the weather is Weather::None for 0 turns; any other weather lasts
+            return operands[0] < domain::NUM_WEATHERS &&
+                   operands[1] <= MAX_WEATHER_DURATION &&
+                   (operands[0] == static_cast<uint8_t>(domain::Weather::None)) ==
+                       (operands[1] == 0);
+        default:
+            return true;
+    }
+}
+
+bool ValidateScript(const uint8_t* script, size_t length) {
+    if (script == nullptr || length == 0 || length > MAX_SCRIPT_LENGTH) {
+        return false;
+    }
+
+    // Pass 1: mark instruction boundaries up to the first End
+    bool boundary[MAX_SCRIPT_LENGTH] = {};
+    size_t end = 0;
+    bool found_end = false;
+    for (size_t pc = 0; pc < length;) {
+        uint8_t op = script[pc];
+        if (op >= static_cast<uint8_t>(Op::Count)) {
+            return false;
+        }
+        boundary[pc] = true;
+        if (op == static_cast<uint8_t>(Op::End)) {
+            end = pc;
+            found_end = true;
+            break;
+        }
+        pc += 1 + OPERAND_COUNT[op];
+        if (pc > length) {
+            return false;  // Operands run past the buffer
+        }
+    }
+    if (!found_end) {
+        return false;
+    }
+
+    // Pass 2: operand values are in range, and jumps go forward (so scripts always
+    // terminate) onto an instruction
+    for (size_t pc = 0; pc < end; pc += 1 + OPERAND_COUNT[script[pc]]) {
+        if (!ValidOperands(static_cast<Op>(script[pc]), script + pc + 1)) {
+            return false;
+        }
+        if (script[pc] == static_cast<uint8_t>(Op::JumpIfFailed)) {
+            uint8_t target = script[pc + 1];
+            if (target <= pc || target > end || !boundary[target]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Switch dispatch
+// ============================================================================
+
+void RunScriptSwitch(const uint8_t* script, BattleContext& ctx) {
+    const uint8_t* pc = script;
+    while (true) {
+        switch (static_cast<Op>(*pc++)) {
+            case Op::AccuracyCheck:
+                commands::AccuracyCheck(ctx);
+                break;
+            case Op::CalculateDamage:
+                commands::CalculateDamage(ctx);
+                break;
+            case Op::ApplyDamage:
+                commands::ApplyDamage(ctx);
+                break;
+            case Op::CheckFaint:
+                commands::CheckFaint(ctx);
+                break;
+            case Op::CheckFaintAttacker:
+                commands::CheckFaint(ctx, true);
+                break;
+            case Op::TryBurn:
+                commands::TryApplyBurn(ctx, ChanceOperand(ctx, pc[0]));
+                pc += 1;
+                break;
+            case Op::TryParalysis:
+                commands::TryApplyParalysis(ctx, ChanceOperand(ctx, pc[0]));
+                pc += 1;
+                break;
+            case Op::ModifyStat:
+                commands::ModifyStatStage(ctx, static_cast<domain::Stat>(pc[0]),
+                                          static_cast<int8_t>(pc[1]));
+                pc += 2;
+                break;
+            case Op::ModifyStatSelf:
+                commands::ModifyStatStage(ctx, static_cast<domain::Stat>(pc[0]),
+                                          static_cast<int8_t>(pc[1]), true);
+                pc += 2;
+                break;
+            case Op::Recoil:
+                commands::ApplyRecoil(ctx, pc[0]);
+                pc += 1;
+                break;
+            case Op::Drain:
+                commands::ApplyDrain(ctx, pc[0]);
+                pc += 1;
+                break;
+            case Op::SetWeather:
+                commands::SetWeather(ctx, static_cast<domain::Weather>(pc[0]), pc[1]);
+                pc += 2;
+                break;
+            case Op::JumpIfFailed:
+                pc = ctx.move_failed ? script + pc[0] : pc + 1;
+                break;
+            case Op::Hit:
+                DoHit(ctx);
+                break;
+            case Op::HitAndFaint:
+                DoHit(ctx);
+                commands::CheckFaint(ctx);
+                break;
+            case Op::End:
+            case Op::Count:
+            default:
+                return;
+        }
+    }
+}
+
+// ============================================================================
+// Direct-threaded dispatch
+// ============================================================================
+
+#if BATTLE_SCRIPT_THREADED
+
+void RunScriptThreaded(const uint8_t* script, BattleContext& ctx) {
+    // Handler addresses, indexed by Op (order must match the enum)
+    static const void* const HANDLERS[] = {
+        &&op_end,               // End
+        &&op_accuracy_check,    // AccuracyCheck
+        &&op_calculate_damage,  // CalculateDamage
+        &&op_apply_damage,      // ApplyDamage
+        &&op_check_faint,       // CheckFaint
+        &&op_check_faint_att,   // CheckFaintAttacker
+        &&op_try_burn,          // TryBurn
+        &&op_try_paralysis,     // TryParalysis
+        &&op_modify_stat,       // ModifyStat
+        &&op_modify_stat_self,  // ModifyStatSelf
+        &&op_recoil,            // Recoil
+        &&op_drain,             // Drain
+        &&op_set_weather,       // SetWeather
+        &&op_jump_if_failed,    // JumpIfFailed
+        &&op_hit,               // Hit
+        &&op_hit_and_faint,     // HitAndFaint
+    };
+    static_assert(sizeof(HANDLERS) / sizeof(HANDLERS[0]) == static_cast<uint8_t>(Op::Count),
+                  "HANDLERS must have one entry per opcode");
+
+    const uint8_t* pc = script;
+
+#define DISPATCH() goto* HANDLERS[*pc++]
+
+    DISPATCH();
+
+op_accuracy_check:
+    commands::AccuracyCheck(ctx);
+    DISPATCH();
+op_calculate_damage:
+    commands::CalculateDamage(ctx);
+    DISPATCH();
+op_apply_damage:
+    commands::ApplyDamage(ctx);
+    DISPATCH();
+op_check_faint:
+    commands::CheckFaint(ctx);
+    DISPATCH();
+op_check_faint_att:
+    commands::CheckFaint(ctx, true);
+    DISPATCH();
+op_try_burn:
+    commands::TryApplyBurn(ctx, ChanceOperand(ctx, pc[0]));
+    pc += 1;
+    DISPATCH();
+op_try_paralysis:
+    commands::TryApplyParalysis(ctx, ChanceOperand(ctx, pc[0]));
+    pc += 1;
+    DISPATCH();
+op_modify_stat:
+    commands::ModifyStatStage(ctx, static_cast<domain::Stat>(pc[0]), static_cast<int8_t>(pc[1]));
+    pc += 2;
+    DISPATCH();
+op_modify_stat_self:
+    commands::ModifyStatStage(ctx, static_cast<domain::Stat>(pc[0]), static_cast<int8_t>(pc[1]),
+                              true);
+    pc += 2;
+    DISPATCH();
+op_recoil:
+    commands::ApplyRecoil(ctx, pc[0]);
+    pc += 1;
+    DISPATCH();
+op_drain:
+    commands::ApplyDrain(ctx, pc[0]);
+    pc += 1;
+    DISPATCH();
+op_set_weather:
+    commands::SetWeather(ctx, static_cast<domain::Weather>(pc[0]), pc[1]);
+    pc += 2;
+    DISPATCH();
+op_jump_if_failed:
+    pc = ctx.move_failed ? script + pc[0] : pc + 1;
+    DISPATCH();
+op_hit:
+    DoHit(ctx);
+    DISPATCH();
+op_hit_and_faint:
+    DoHit(ctx);
+    commands::CheckFaint(ctx);
+    DISPATCH();
+
+#undef DISPATCH
+
+op_end:
+    return;
+}
+
+void RunScript(const uint8_t* script, BattleContext& ctx) {
+    RunScriptThreaded(script, ctx);
+}
+
+#else
+
+void RunScript(const uint8_t* script, BattleContext& ctx) {
+    RunScriptSwitch(script, ctx);
+}
+
+#endif
+
+}  // namespace script
+}  // namespace battle
@@ -0,0 +1,80 @@
+/**
+ * @file battle/script/interpreter.hpp
+ * @brief Battle script bytecode interpreter
+ *
+ * Runs a bytecode script (see opcodes.hpp) against a BattleContext, as an
+ * alternative to a compiled Effect_* function. Scripts can come from data, so
+ * moves can be added without a rebuild.
+ *
+ * Two dispatch loops are provided:
+ * - Direct-threaded (computed goto): each handler jumps straight to the next one,
+ *   giving the branch predictor one indirect jump per handler. Needs the GNU
+ *   labels-as-values extension (GCC, Clang).
+ * - Switch: portable fallback, always compiled.
+ *
+ * Define BATTLE_SCRIPT_NO_THREADED to force the switch loop.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../context.hpp"
+
+#if defined(__GNUC__) && !defined(BATTLE_SCRIPT_NO_THREADED)
+#define BATTLE_SCRIPT_THREADED 1
+#else
+#define BATTLE_SCRIPT_THREADED 0
+#endif
+
+namespace battle {
+namespace script {
+
+/**
+ * @brief Maximum script length in bytes (jump targets are one byte)
+ */
+constexpr size_t MAX_SCRIPT_LENGTH = 256;
+
+/**
+ * @brief Largest stage change a ModifyStat / ModifyStatSelf operand may carry
+ */
+constexpr int8_t MAX_STAGE_CHANGE = 6;
+
+/**
+ * @brief Longest weather a SetWeather operand may set (turns)
+ */
+constexpr uint8_t MAX_WEATHER_DURATION = 7;
+
+/**
+ * @brief Check that a script is well formed
+ * @param script Script bytes
+ * @param length Number of bytes available
+ * @return true if every opcode is known, its operands fit and are in range (stats,
+ *         stage changes, percentages, weathers), every jump lands on an
+ *         instruction boundary, and an Op::End is reached before the end of the buffer
+ *
+ * Scripts loaded from data must pass this before being run: the interpreters do
+ * not bounds-check.
+ */
+bool ValidateScript(const uint8_t* script, size_t length);
+
+/**
+ * @brief Run a script using the fastest available dispatch loop
+ */
+void RunScript(const uint8_t* script, BattleContext& ctx);
+
+/**
+ * @brief Run a script using the portable switch dispatch loop
+ */
+void RunScriptSwitch(const uint8_t* script, BattleContext& ctx);
+
+#if BATTLE_SCRIPT_THREADED
+/**
+ * @brief Run a script using the direct-threaded dispatch loop
+ */
+void RunScriptThreaded(const uint8_t* script, BattleContext& ctx);
+#endif
+
+}  // namespace script
+}  // namespace battle
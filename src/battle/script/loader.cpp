@@ -0,0 +1,67 @@
+/**
+ * @file battle/script/loader.cpp
+ * @brief Per-move script table loaded from a data blob
+ */
+
+#include "loader.hpp"
+
+#include "interpreter.hpp"
+
+namespace battle {
+namespace script {
+
+static const uint8_t SCRIPT_BLOB_MAGIC[4] = {'B', 'S', 'C', 'R'};
+
+bool LoadScriptTable(const uint8_t* blob, size_t size, ScriptTable* table) {
+    if (blob == nullptr || table == nullptr || size < SCRIPT_BLOB_HEADER_SIZE) {
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(SCRIPT_BLOB_MAGIC); i++) {
+        if (blob[i] != SCRIPT_BLOB_MAGIC[i]) {
+            return false;
+        }
+    }
+    if (blob[4] != SCRIPT_BLOB_VERSION) {
+        return false;
+    }
+
+    // Build into a scratch table so a bad blob leaves the caller's table alone
+    ScriptTable loaded;
+    for (uint8_t m = 0; m < domain::NUM_MOVES; m++) {
+        loaded.scripts[m] = nullptr;
+    }
+    size_t offset = SCRIPT_BLOB_HEADER_SIZE;
+    for (uint8_t entry = 0; entry < blob[5]; entry++) {
+        if (size - offset < 2) {
+            return false;
+        }
+        uint8_t move = blob[offset];
+        uint8_t length = blob[offset + 1];
+        const uint8_t* script = blob + offset + 2;
+        offset += 2;
+        if (move == 0 || move >= domain::NUM_MOVES || loaded.scripts[move] != nullptr ||
+            size - offset < length || !ValidateScript(script, length)) {
+            return false;
+        }
+        loaded.scripts[move] = script;
+        offset += length;
+    }
+    if (offset != size) {
+        return false;
+    }
+
+    loaded.checksum = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        loaded.checksum ^= blob[i];
+        loaded.checksum *= 0x100000001b3ULL;
+    }
+    if (loaded.checksum == 0) {
+        loaded.checksum = 1;  // 0 stands for native effects
+    }
+
+    *table = loaded;
+    return true;
+}
+
+}  // namespace script
+}  // namespace battle
@@ -0,0 +1,56 @@
+/**
+ * @file battle/script/loader.hpp
+ * @brief Per-move script table loaded from a data blob
+ *
+ * A script blob assigns bytecode scripts to moves, so a move's effect can be
+ * replaced from data (BattleEngine::SetScriptTable). Layout:
+ *   0-3   magic "BSCR"
+ *   4     format version (SCRIPT_BLOB_VERSION)
+ *   5     entry count
+ *   then per entry: move id, script length, script bytes
+ *
+ * The whole blob is validated before anything is installed; the table points
+ * into the blob, so the blob must outlive it.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../../domain/move.hpp"
+
+namespace battle {
+namespace script {
+
+/**
+ * @brief Bump when the blob layout or the opcode set changes
+ */
+constexpr uint8_t SCRIPT_BLOB_VERSION = 1;
+
+/**
+ * @brief Bytes before the first entry (magic, version, count)
+ */
+constexpr size_t SCRIPT_BLOB_HEADER_SIZE = 6;
+
+/**
+ * @brief Script of each move (nullptr = the move's native Effect_* runs)
+ */
+struct ScriptTable {
+    const uint8_t* scripts[domain::NUM_MOVES];
+    uint64_t checksum;  // FNV-1a hash of the whole blob (never 0; tells configurations apart)
+};
+
+/**
+ * @brief Validate a script blob and point a table at its scripts
+ * @param blob Blob bytes (must outlive the table)
+ * @param size Blob size in bytes
+ * @param table Receives the scripts; moves without an entry get nullptr
+ * @return false if the header is wrong, a move id is None, unknown or repeated, a script
+ *         fails ValidateScript within its own length, or the entries do not end
+ *         exactly at the end of the blob (the table is then left unchanged)
+ */
+bool LoadScriptTable(const uint8_t* blob, size_t size, ScriptTable* table);
+
+}  // namespace script
+}  // namespace battle
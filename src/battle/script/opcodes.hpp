@@ -0,0 +1,81 @@
+/**
+ * @file battle/script/opcodes.hpp
+ * @brief Battle script bytecode opcodes
+ *
+ * A battle script is a byte string: one opcode byte followed by its operand bytes,
+ * terminated by Op::End. Each opcode maps onto one command from battle/commands/,
+ * in the spirit of pokeemerald's battle script commands (data/battle_scripts_1.s).
+ *
+ * Superinstructions fuse the most common command sequences so the interpreter
+ * dispatches once instead of three or four times for a plain damaging hit.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace battle {
+namespace script {
+
+/**
+ * @brief Script opcodes
+ *
+ * Operands are listed after each opcode; all are single bytes.
+ */
+enum class Op : uint8_t {
+    End = 0,             // Stop executing
+    AccuracyCheck,       // commands::AccuracyCheck
+    CalculateDamage,     // commands::CalculateDamage
+    ApplyDamage,         // commands::ApplyDamage
+    CheckFaint,          // commands::CheckFaint (defender)
+    CheckFaintAttacker,  // commands::CheckFaint (attacker)
+    TryBurn,             // <chance>: commands::TryApplyBurn (0 = move's effect_chance)
+    TryParalysis,        // <chance>: commands::TryApplyParalysis (0 = move's effect_chance)
+    ModifyStat,          // <stat> <change (int8)>: commands::ModifyStatStage on the defender
+    ModifyStatSelf,      // <stat> <change (int8)>: commands::ModifyStatStage on the attacker
+    Recoil,              // <percent>: commands::ApplyRecoil
+    Drain,               // <percent>: commands::ApplyDrain
+    SetWeather,          // <weather> <duration>: commands::SetWeather
+    JumpIfFailed,        // <target>: jump to byte offset <target> if ctx.move_failed
+
+    // Superinstructions
+    Hit,          // AccuracyCheck, CalculateDamage, ApplyDamage
+    HitAndFaint,  // AccuracyCheck, CalculateDamage, ApplyDamage, CheckFaint
+
+    Count  // Number of opcodes (not an instruction)
+};
+
+/**
+ * @brief Number of operand bytes following each opcode (indexed by Op)
+ */
+static const uint8_t OPERAND_COUNT[] = {
+    0,  // End
+    0,  // AccuracyCheck
+    0,  // CalculateDamage
+    0,  // ApplyDamage
+    0,  // CheckFaint
+    0,  // CheckFaintAttacker
+    1,  // TryBurn
+    1,  // TryParalysis
+    2,  // ModifyStat
+    2,  // ModifyStatSelf
+    1,  // Recoil
+    1,  // Drain
+    2,  // SetWeather
+    1,  // JumpIfFailed
+    0,  // Hit
+    0,  // HitAndFaint
+};
+
+/**
+ * @brief Opcode as a script byte (for writing scripts as byte arrays)
+ */
+constexpr uint8_t Code(Op op) {
+    return static_cast<uint8_t>(op);
+}
+
+static_assert(sizeof(OPERAND_COUNT) == static_cast<uint8_t>(Op::Count),
+              "OPERAND_COUNT must have one entry per opcode");
+
+}  // namespace script
+}  // namespace battle
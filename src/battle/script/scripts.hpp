@@ -0,0 +1,153 @@
+/**
+ * @file battle/script/scripts.hpp
+ * @brief Bytecode equivalents of the native move effects
+ *
+ * Each script runs the same command sequence as the Effect_* function it is
+ * named after, so the two can be swapped (and cross-checked) freely.
+ * Effects that need engine-side state (Protect, two-turn moves, Substitute,
+ * Baton Pass, Leech Seed, Future Sight, multi-hit) stay native for now.
+ *
+ * Based on pokeemerald: data/battle_scripts_1.s
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../../domain/stats.hpp"
+#include "../../domain/weather.hpp"
+#include "opcodes.hpp"
+
+namespace battle {
+namespace script {
+
+/**
+ * @brief Encode a signed stage change as an operand byte
+ */
+constexpr uint8_t Stage(int8_t change) {
+    return static_cast<uint8_t>(change);
+}
+
+// Effect_Hit (Tackle)
+inline constexpr uint8_t SCRIPT_HIT[] = {
+    Code(Op::HitAndFaint),
+    Code(Op::End),
+};
+
+// Effect_BurnHit (Ember): burn chance comes from the move's effect_chance
+inline constexpr uint8_t SCRIPT_BURN_HIT[] = {
+    Code(Op::Hit),
+    Code(Op::TryBurn), 0,
+    Code(Op::CheckFaint),
+    Code(Op::End),
+};
+
+// Effect_Paralyze (Thunder Wave)
+inline constexpr uint8_t SCRIPT_PARALYZE[] = {
+    Code(Op::AccuracyCheck),
+    Code(Op::TryParalysis), 100,
+    Code(Op::End),
+};
+
+// Effect_AttackDown (Growl)
+inline constexpr uint8_t SCRIPT_ATTACK_DOWN[] = {
+    Code(Op::AccuracyCheck),
+    Code(Op::ModifyStat), domain::STAT_ATK, Stage(-1),
+    Code(Op::End),
+};
+
+// Effect_DefenseDown (Tail Whip)
+inline constexpr uint8_t SCRIPT_DEFENSE_DOWN[] = {
+    Code(Op::AccuracyCheck),
+    Code(Op::ModifyStat), domain::STAT_DEF, Stage(-1),
+    Code(Op::End),
+};
+
+// Effect_SpeedDown (String Shot)
+inline constexpr uint8_t SCRIPT_SPEED_DOWN[] = {
+    Code(Op::AccuracyCheck),
+    Code(Op::ModifyStat), domain::STAT_SPEED, Stage(-1),
+    Code(Op::End),
+};
+
+// Effect_SpecialDefenseDown2 (Fake Tears)
+inline constexpr uint8_t SCRIPT_SPECIAL_DEFENSE_DOWN_2[] = {
+    Code(Op::AccuracyCheck),
+    Code(Op::ModifyStat), domain::STAT_SPDEF, Stage(-2),
+    Code(Op::End),
+};
+
+// Effect_AttackUp2 (Swords Dance)
+inline constexpr uint8_t SCRIPT_ATTACK_UP_2[] = {
+    Code(Op::ModifyStatSelf), domain::STAT_ATK, Stage(+2),
+    Code(Op::End),
+};
+
+// Effect_DefenseUp2 (Iron Defense)
+inline constexpr uint8_t SCRIPT_DEFENSE_UP_2[] = {
+    Code(Op::ModifyStatSelf), domain::STAT_DEF, Stage(+2),
+    Code(Op::End),
+};
+
+// Effect_SpeedUp2 (Agility)
+inline constexpr uint8_t SCRIPT_SPEED_UP_2[] = {
+    Code(Op::ModifyStatSelf), domain::STAT_SPEED, Stage(+2),
+    Code(Op::End),
+};
+
+// Effect_SpecialAttackUp2 (Tail Glow)
+inline constexpr uint8_t SCRIPT_SPECIAL_ATTACK_UP_2[] = {
+    Code(Op::ModifyStatSelf), domain::STAT_SPATK, Stage(+2),
+    Code(Op::End),
+};
+
+// Effect_SpecialDefenseUp2 (Amnesia)
+inline constexpr uint8_t SCRIPT_SPECIAL_DEFENSE_UP_2[] = {
+    Code(Op::ModifyStatSelf), domain::STAT_SPDEF, Stage(+2),
+    Code(Op::End),
+};
+
+// Effect_RecoilHit (Double-Edge)
+inline constexpr uint8_t SCRIPT_RECOIL_HIT[] = {
+    Code(Op::Hit),
+    Code(Op::Recoil), 33,
+    Code(Op::CheckFaint),
+    Code(Op::CheckFaintAttacker),
+    Code(Op::End),
+};
+
+// Effect_DrainHit (Giga Drain)
+inline constexpr uint8_t SCRIPT_DRAIN_HIT[] = {
+    Code(Op::Hit),
+    Code(Op::Drain), 50,
+    Code(Op::CheckFaint),
+    Code(Op::CheckFaintAttacker),
+    Code(Op::End),
+};
+
+// Effect_Sandstorm (Sandstorm)
+inline constexpr uint8_t SCRIPT_SANDSTORM[] = {
+    Code(Op::SetWeather), static_cast<uint8_t>(domain::Weather::Sandstorm), 5,
+    Code(Op::End),
+};
+
+// Effect_RainDance (Rain Dance)
+inline constexpr uint8_t SCRIPT_RAIN_DANCE[] = {
+    Code(Op::SetWeather), static_cast<uint8_t>(domain::Weather::Rain), 5,
+    Code(Op::End),
+};
+
+// Effect_SunnyDay (Sunny Day)
+inline constexpr uint8_t SCRIPT_SUNNY_DAY[] = {
+    Code(Op::SetWeather), static_cast<uint8_t>(domain::Weather::Sun), 5,
+    Code(Op::End),
+};
+
+// Effect_Hail (Hail)
+inline constexpr uint8_t SCRIPT_HAIL[] = {
+    Code(Op::SetWeather), static_cast<uint8_t>(domain::Weather::Hail), 5,
+    Code(Op::End),
+};
+
+}  // namespace script
+}  // namespace battle
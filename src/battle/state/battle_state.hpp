@@ -0,0 +1,54 @@
+/**
+ * @file battle/state/battle_state.hpp
+ * @brief Contiguous battle state block
+ *
+ * Everything a battle needs lives in one plain-data block, addressed by battler
+ * index (0 = player, 1 = enemy) instead of by pointer:
+ * - Active Pokemon per battler
+ * - Side state per battler
+ * - Field state, delayed-effect scheduler and running evaluation terms
+ * - Mask of the battle events any held item hooks
+ *
+ * The block holds no pointers, so it can be copied, moved, stored in arrays or
+ * memcpy'd into another layout without fixing anything up.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../evaluation.hpp"
+#include "field.hpp"
+#include "pokemon.hpp"
+#include "scheduler.hpp"
+#include "side.hpp"
+
+namespace battle {
+namespace state {
+
+/**
+ * @brief Number of battlers in a singles battle
+ */
+constexpr uint8_t NUM_BATTLERS = 2;
+
+/**
+ * @brief Battler index of the opposing battler (singles)
+ */
+constexpr uint8_t Opponent(uint8_t battler) {
+    return battler ^ 1;
+}
+
+/**
+ * @brief Whole battle state in one contiguous block
+ */
+struct BattleState {
+    Pokemon battlers[NUM_BATTLERS];  // Active Pokemon (0 = player, 1 = enemy)
+    Side sides[NUM_BATTLERS];        // Per-side state (indexed like battlers)
+    Field field;                     // Global field state
+    Scheduler scheduler;             // Delayed effects
+    evaluation::Terms eval;          // Running evaluation terms (derived, kept in step)
+    uint8_t item_hooks;              // Union of the held items' hooks (derived, items::HOOK_*)
+};
+
+}  // namespace state
+}  // namespace battle
@@ -0,0 +1,239 @@
+/**
+ * @file battle/state/encoding.hpp
+ * @brief Canonical byte encoding of battle state
+ *
+ * Writes the state structs field by field into a byte buffer. Two states encode
+ * to the same bytes exactly when they behave the same, so the encoding can be
+ * hashed and compared to detect transpositions (identical states reached through
+ * different move/chance sequences).
+ *
+ * Struct padding is never encoded. The Decode* functions read the same layout
+ * back (for storing states compactly and restoring them later).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "field.hpp"
+#include "pokemon.hpp"
+#include "scheduler.hpp"
+#include "side.hpp"
+
+namespace battle {
+namespace state {
+
+/**
+ * @brief Encoded size of one Pokemon
+ */
+constexpr size_t ENCODED_POKEMON_SIZE = 18 + domain::NUM_BATTLE_STATS + 12;
+
+/**
+ * @brief Encoded size of the field
+ */
+constexpr size_t ENCODED_FIELD_SIZE = 2;
+
+/**
+ * @brief Encoded size of one side
+ */
+constexpr size_t ENCODED_SIDE_SIZE = 1;
+
+/**
+ * @brief Maximum encoded size of the scheduler
+ */
+constexpr size_t MAX_ENCODED_SCHEDULER_SIZE = 3 + MAX_SCHEDULED_EVENTS * 6;
+
+/**
+ * @brief Encoded size of everything before the scheduler (both Pokemon, field, both sides)
+ */
+constexpr size_t ENCODED_FIXED_SIZE = 2 * ENCODED_POKEMON_SIZE + ENCODED_FIELD_SIZE +
+                                      2 * ENCODED_SIDE_SIZE;
+
+/**
+ * @brief Encode a 16-bit value (little-endian)
+ */
+inline uint8_t* EncodeU16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value & 0xFF);
+    out[1] = static_cast<uint8_t>(value >> 8);
+    return out + 2;
+}
+
+/**
+ * @brief Encode a Pokemon
+ * @return Pointer one past the last byte written
+ */
+inline uint8_t* EncodePokemon(uint8_t* out, const Pokemon& p) {
+    *out++ = static_cast<uint8_t>(p.species);
+    *out++ = static_cast<uint8_t>(p.ability);
+    *out++ = static_cast<uint8_t>(p.type1);
+    *out++ = static_cast<uint8_t>(p.type2);
+    *out++ = p.level;
+    *out++ = p.attack;
+    *out++ = p.defense;
+    *out++ = p.sp_attack;
+    *out++ = p.sp_defense;
+    *out++ = p.speed;
+    out = EncodeU16(out, p.max_hp);
+    out = EncodeU16(out, p.current_hp);
+    *out++ = p.is_fainted;
+    *out++ = p.status1;
+    *out++ = p.toxic_counter;
+    *out++ = p.protect_count;
+    for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
+        *out++ = static_cast<uint8_t>(p.stat_stages[i]);
+    }
+    *out++ = p.is_protected;
+    *out++ = p.is_charging;
+    *out++ = static_cast<uint8_t>(p.charging_move);
+    *out++ = p.is_semi_invulnerable;
+    *out++ = static_cast<uint8_t>(p.semi_invulnerable_type);
+    *out++ = p.has_substitute;
+    out = EncodeU16(out, p.substitute_hp);
+    *out++ = p.is_seeded;
+    *out++ = p.seeded_by;
+    *out++ = static_cast<uint8_t>(p.item);
+    *out++ = static_cast<uint8_t>(p.choiced_move);
+    return out;
+}
+
+/**
+ * @brief Encode the field
+ */
+inline uint8_t* EncodeField(uint8_t* out, const Field& field) {
+    *out++ = static_cast<uint8_t>(field.weather);
+    *out++ = field.weather_duration;
+    return out;
+}
+
+/**
+ * @brief Encode one side
+ */
+inline uint8_t* EncodeSide(uint8_t* out, const Side& side) {
+    *out++ = side.stealth_rock;
+    return out;
+}
+
+/**
+ * @brief Encode the scheduler (only the pending events, in resolution order)
+ */
+inline uint8_t* EncodeScheduler(uint8_t* out, const Scheduler& scheduler) {
+    out = EncodeU16(out, scheduler.turn);
+    *out++ = scheduler.count;
+    for (uint8_t i = 0; i < scheduler.count; i++) {
+        const ScheduledEvent& event = scheduler.events[i];
+        out = EncodeU16(out, event.due_turn);
+        *out++ = event.battler;
+        *out++ = static_cast<uint8_t>(event.effect);
+        out = EncodeU16(out, event.value);
+    }
+    return out;
+}
+
+/**
+ * @brief Fixed-size part of an encoded scheduler (turn and event count)
+ */
+constexpr size_t ENCODED_SCHEDULER_HEADER_SIZE = 3;
+
+/**
+ * @brief Encoded size of one scheduled event
+ */
+constexpr size_t ENCODED_EVENT_SIZE = 6;
+
+/**
+ * @brief Decode a 16-bit value (little-endian)
+ */
+inline const uint8_t* DecodeU16(const uint8_t* in, uint16_t* value) {
+    *value = static_cast<uint16_t>(in[0] | (in[1] << 8));
+    return in + 2;
+}
+
+/**
+ * @brief Decode a Pokemon written by EncodePokemon
+ * @return Pointer one past the last byte read
+ */
+inline const uint8_t* DecodePokemon(const uint8_t* in, Pokemon* p) {
+    p->species = static_cast<domain::Species>(*in++);
+    p->ability = static_cast<domain::Ability>(*in++);
+    p->type1 = static_cast<domain::Type>(*in++);
+    p->type2 = static_cast<domain::Type>(*in++);
+    p->level = *in++;
+    p->attack = *in++;
+    p->defense = *in++;
+    p->sp_attack = *in++;
+    p->sp_defense = *in++;
+    p->speed = *in++;
+    in = DecodeU16(in, &p->max_hp);
+    in = DecodeU16(in, &p->current_hp);
+    p->is_fainted = *in++ != 0;
+    p->status1 = *in++;
+    p->toxic_counter = *in++;
+    p->protect_count = *in++;
+    for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
+        p->stat_stages[i] = static_cast<int8_t>(*in++);
+    }
+    p->is_protected = *in++ != 0;
+    p->is_charging = *in++ != 0;
+    p->charging_move = static_cast<domain::Move>(*in++);
+    p->is_semi_invulnerable = *in++ != 0;
+    p->semi_invulnerable_type = static_cast<SemiInvulnerableType>(*in++);
+    p->has_substitute = *in++ != 0;
+    in = DecodeU16(in, &p->substitute_hp);
+    p->is_seeded = *in++ != 0;
+    p->seeded_by = *in++;
+    p->item = static_cast<domain::Item>(*in++);
+    p->choiced_move = static_cast<domain::Move>(*in++);
+    return in;
+}
+
+/**
+ * @brief Decode the field
+ */
+inline const uint8_t* DecodeField(const uint8_t* in, Field* field) {
+    field->weather = static_cast<domain::Weather>(*in++);
+    field->weather_duration = *in++;
+    return in;
+}
+
+/**
+ * @brief Decode one side
+ */
+inline const uint8_t* DecodeSide(const uint8_t* in, Side* side) {
+    side->stealth_rock = *in++ != 0;
+    return in;
+}
+
+/**
+ * @brief Decode the scheduler
+ * @return Pointer one past the last byte read, or nullptr if the event count is invalid
+ */
+inline const uint8_t* DecodeScheduler(const uint8_t* in, Scheduler* scheduler) {
+    in = DecodeU16(in, &scheduler->turn);
+    scheduler->count = *in++;
+    if (scheduler->count > MAX_SCHEDULED_EVENTS) {
+        return nullptr;
+    }
+    for (uint8_t i = 0; i < scheduler->count; i++) {
+        ScheduledEvent& event = scheduler->events[i];
+        in = DecodeU16(in, &event.due_turn);
+        event.battler = *in++;
+        event.effect = static_cast<ScheduledEffect>(*in++);
+        in = DecodeU16(in, &event.value);
+    }
+    return in;
+}
+
+/**
+ * @brief FNV-1a hash of an encoded state
+ */
+inline uint64_t HashEncoded(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+}  // namespace state
+}  // namespace battle
@@ -11,6 +11,7 @@
 #include <stdint.h>
 
 #include "../../domain/ability.hpp"
+#include "../../domain/item.hpp"
 #include "../../domain/move.hpp"
 #include "../../domain/species.hpp"
 #include "../../domain/stats.hpp"
@@ -57,7 +58,8 @@ struct Pokemon {
     bool is_fainted;
 
     // Status conditions
-    uint8_t status1;  // Primary status: Sleep, Poison, Burn, Freeze, Paralysis
+    uint8_t status1;        // Primary status: Sleep, Poison, Burn, Freeze, Paralysis
+    uint8_t toxic_counter;  // Turns of toxic damage taken (damage = counter/16 max HP)
 
     // Stat stages (-6 to +6, with 0 being neutral)
     // Stages apply multipliers to stats during damage calculation
@@ -81,8 +83,12 @@ struct Pokemon {
     uint16_t substitute_hp;  // Substitute's current HP (0 when no substitute)
 
     // Leech Seed state
-    bool is_seeded;      // Volatile flag: this Pokemon is seeded by Leech Seed
-    Pokemon* seeded_by;  // Pointer to the Pokemon that seeded this one (receives drained HP)
+    bool is_seeded;     // Volatile flag: this Pokemon is seeded by Leech Seed
+    uint8_t seeded_by;  // Battler index of the seeder (receives drained HP)
+
+    // Held item state
+    domain::Item item;          // Held item (Item::None = nothing held)
+    domain::Move choiced_move;  // Move locked in by a Choice item (Move::None = not locked)
 
     // TODO: Add volatile status (status2) later
 };
@@ -0,0 +1,61 @@
+/**
+ * @file battle/state/scheduler.hpp
+ * @brief Turn-indexed scheduler for delayed effects
+ *
+ * This holds effects that resolve on a later turn than the one they were created on:
+ * - Future Sight / Doom Desire delayed damage
+ * - Two-turn move charge expiry (charge is dropped if the release turn is skipped)
+ * - Screen / Safeguard / Mist counters [not implemented]
+ *
+ * The scheduler is plain data (no pointers), so copying the battle state copies it too.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace battle {
+namespace state {
+
+/**
+ * @brief Kind of delayed effect held by the scheduler
+ */
+enum class ScheduledEffect : uint8_t {
+    None = 0,
+    ChargeExpire,  // Drop a two-turn move's charge if it was not released this turn
+    FutureSight,   // Deal stored damage to the battler (Future Sight)
+};
+
+/**
+ * @brief One scheduled effect record
+ */
+struct ScheduledEvent {
+    uint16_t due_turn;       // Turn at whose end the effect resolves
+    uint8_t battler;         // Battler the effect applies to (0 = player, 1 = enemy)
+    ScheduledEffect effect;  // What to do when due
+    uint16_t value;          // Effect payload (e.g., Future Sight damage)
+};
+
+/**
+ * @brief Maximum number of pending scheduled effects
+ *
+ * Singles has at most one Future Sight and one charging move per battler,
+ * so 8 leaves room for screens and other timed effects.
+ */
+constexpr uint8_t MAX_SCHEDULED_EVENTS = 8;
+
+/**
+ * @brief Fixed-capacity delayed-effect scheduler
+ *
+ * Events are kept sorted by due turn in DESCENDING order, so the events that are due
+ * soonest sit at the end of the array. Popping a due event is then just count--,
+ * and the end-of-turn phase only touches the events that are actually due.
+ */
+struct Scheduler {
+    uint16_t turn;   // Current turn number (incremented by the Engine at the start of each turn)
+    uint8_t count;   // Number of pending events
+    ScheduledEvent events[MAX_SCHEDULED_EVENTS];
+};
+
+}  // namespace state
+}  // namespace battle
@@ -0,0 +1,309 @@
+/**
+ * @file battle/state/state_key.hpp
+ * @brief 16-byte packed key of the battle state that matters for future play
+ *
+ * Exact-match caches (transposition tables, tablebases, memo caches) store this
+ * key next to their entries and compare it on a hit, instead of trusting a
+ * 64-bit hash, without storing a whole BattleEngine.
+ *
+ * The key holds only what changes during a battle; the matchup (species, types,
+ * stats, max HP, abilities, items) is fixed per battle and not included, so keys
+ * are only comparable within one matchup. Per battler (60 bits):
+ *
+ *   bits  field
+ *   10    current HP (max HP must fit in 10 bits)
+ *   20    Attack, Defense, Speed, Sp. Atk, Sp. Def stages (stage + 6, 4 bits each)
+ *    5    status: 0 none, 1-7 sleep turns, 8 poison, 9 burn, 10 freeze,
+ *         11 paralysis, 12 + counter toxic (counter 0-15)
+ *    3    protect_count
+ *    1    is_protected
+ *    1    is_charging
+ *    5    charging_move
+ *    1    has_substitute
+ *    8    substitute HP
+ *    1    is_seeded
+ *    5    choiced_move
+ *
+ * Word b holds battler b in bits 0-59, its side's Stealth Rock in bit 60 and 3
+ * bits of field state in bits 61-63 (word 0: weather, word 1: weather duration).
+ *
+ * Everything else is derived or must be in its canonical form, otherwise
+ * PackKey refuses the state (callers fall back to the full encoding):
+ * - is_fainted is current HP == 0; seeded_by is the opponent while seeded, else 0
+ * - Semi-invulnerability follows a charging Fly (OnAir)
+ * - Accuracy and evasion stages are 0 (no move changes them yet)
+ * - The only pending scheduled effects are the ChargeExpire events of charging
+ *   battlers, due next turn (no Future Sight in flight)
+ * - The turn counter is not part of the key (no mechanic reads it directly)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../../domain/status.hpp"
+#include "battle_state.hpp"
+
+namespace battle {
+namespace state {
+
+/**
+ * @brief Packed key (two 64-bit words, compared and hashed as a unit)
+ */
+struct StateKey {
+    uint64_t words[2];
+};
+
+static_assert(sizeof(StateKey) <= 16, "State keys fit in 16 bytes");
+static_assert(domain::NUM_MOVES <= 32, "Move ids fit in 5 bits");
+
+inline bool operator==(const StateKey& a, const StateKey& b) {
+    return a.words[0] == b.words[0] && a.words[1] == b.words[1];
+}
+
+inline bool operator!=(const StateKey& a, const StateKey& b) {
+    return !(a == b);
+}
+
+/**
+ * @brief 64-bit hash of a key (for bucketing; equality is still checked on the key)
+ */
+inline uint64_t HashKey(const StateKey& key) {
+    uint64_t hash = key.words[0] * 0x9e3779b97f4a7c15ULL ^ key.words[1];
+    hash ^= hash >> 29;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    return hash ^ (hash >> 32);
+}
+
+/**
+ * @brief Bit widths of the per-battler fields
+ */
+constexpr uint8_t KEY_HP_BITS = 10;
+constexpr uint8_t KEY_STAGE_BITS = 4;
+constexpr uint8_t KEY_STATUS_BITS = 5;
+constexpr uint8_t KEY_PROTECT_BITS = 3;
+constexpr uint8_t KEY_MOVE_BITS = 5;
+constexpr uint8_t KEY_SUBSTITUTE_BITS = 8;
+constexpr uint8_t KEY_BATTLER_BITS = 60;
+constexpr uint8_t KEY_FIELD_BITS = 3;
+
+/**
+ * @brief Stats whose stages are keyed (the others must be 0)
+ */
+constexpr domain::Stat KEY_STAGED_STATS[] = {domain::STAT_ATK, domain::STAT_DEF,
+                                             domain::STAT_SPEED, domain::STAT_SPATK,
+                                             domain::STAT_SPDEF};
+
+/**
+ * @brief Status field values
+ */
+constexpr uint8_t KEY_STATUS_POISON = 8;
+constexpr uint8_t KEY_STATUS_BURN = 9;
+constexpr uint8_t KEY_STATUS_FREEZE = 10;
+constexpr uint8_t KEY_STATUS_PARALYSIS = 11;
+constexpr uint8_t KEY_STATUS_TOXIC = 12;  // Plus the toxic counter
+
+/**
+ * @brief Sequential bit writer/reader over one key word (internal)
+ */
+struct KeyBits {
+    uint64_t word;
+    uint8_t shift;
+
+    void Put(uint64_t value, uint8_t width) {
+        word |= value << shift;
+        shift += width;
+    }
+
+    uint64_t Take(uint8_t width) {
+        uint64_t value = (word >> shift) & ((1ULL << width) - 1);
+        shift += width;
+        return value;
+    }
+};
+
+/**
+ * @brief Status field of a Pokemon
+ * @return false if status1 and toxic_counter are not a single keyed status
+ */
+inline bool KeyStatus(const Pokemon& p, uint8_t* code) {
+    uint8_t status = p.status1;
+    if (status != domain::Status1::TOXIC && p.toxic_counter != 0) {
+        return false;
+    }
+    if (status == domain::Status1::NONE || (status & ~domain::Status1::SLEEP) == 0) {
+        *code = status;  // None or sleep turns 1-7
+    } else if (status == domain::Status1::POISON) {
+        *code = KEY_STATUS_POISON;
+    } else if (status == domain::Status1::BURN) {
+        *code = KEY_STATUS_BURN;
+    } else if (status == domain::Status1::FREEZE) {
+        *code = KEY_STATUS_FREEZE;
+    } else if (status == domain::Status1::PARALYSIS) {
+        *code = KEY_STATUS_PARALYSIS;
+    } else if (status == domain::Status1::TOXIC && p.toxic_counter <= 15) {
+        *code = KEY_STATUS_TOXIC + p.toxic_counter;
+    } else {
+        return false;  // Several status bits at once
+    }
+    return true;
+}
+
+/**
+ * @brief Pack one battler's dynamic state
+ * @return false if it has no canonical keyed form
+ */
+inline bool PackBattler(const Pokemon& p, uint8_t battler, KeyBits* bits) {
+    uint8_t status;
+    bool flying = p.is_charging && p.charging_move == domain::Move::Fly;
+    SemiInvulnerableType semi = flying ? SemiInvulnerableType::OnAir : SemiInvulnerableType::None;
+    uint8_t seeded_by = p.is_seeded ? Opponent(battler) : 0;
+    if (p.max_hp >= (1u << KEY_HP_BITS) || p.is_fainted != (p.current_hp == 0) ||
+        !KeyStatus(p, &status) || p.protect_count >= (1u << KEY_PROTECT_BITS) ||
+        static_cast<uint8_t>(p.charging_move) >= (1u << KEY_MOVE_BITS) ||
+        static_cast<uint8_t>(p.choiced_move) >= (1u << KEY_MOVE_BITS) ||
+        p.is_semi_invulnerable != flying || p.semi_invulnerable_type != semi ||
+        p.substitute_hp >= (1u << KEY_SUBSTITUTE_BITS) || p.seeded_by != seeded_by ||
+        p.stat_stages[domain::STAT_HP] != 0 || p.stat_stages[domain::STAT_ACC] != 0 ||
+        p.stat_stages[domain::STAT_EVASION] != 0) {
+        return false;
+    }
+
+    bits->Put(p.current_hp, KEY_HP_BITS);
+    for (domain::Stat stat : KEY_STAGED_STATS) {
+        int8_t stage = p.stat_stages[stat];
+        if (stage < -6 || stage > 6) {
+            return false;
+        }
+        bits->Put(static_cast<uint64_t>(stage + 6), KEY_STAGE_BITS);
+    }
+    bits->Put(status, KEY_STATUS_BITS);
+    bits->Put(p.protect_count, KEY_PROTECT_BITS);
+    bits->Put(p.is_protected, 1);
+    bits->Put(p.is_charging, 1);
+    bits->Put(static_cast<uint8_t>(p.charging_move), KEY_MOVE_BITS);
+    bits->Put(p.has_substitute, 1);
+    bits->Put(p.substitute_hp, KEY_SUBSTITUTE_BITS);
+    bits->Put(p.is_seeded, 1);
+    bits->Put(static_cast<uint8_t>(p.choiced_move), KEY_MOVE_BITS);
+    return true;
+}
+
+/**
+ * @brief Restore one battler's dynamic state (fixed fields are left as they are)
+ */
+inline void UnpackBattler(KeyBits* bits, uint8_t battler, Pokemon* p) {
+    p->current_hp = static_cast<uint16_t>(bits->Take(KEY_HP_BITS));
+    p->is_fainted = p->current_hp == 0;
+    for (int i = 0; i < domain::NUM_BATTLE_STATS; i++) {
+        p->stat_stages[i] = 0;
+    }
+    for (domain::Stat stat : KEY_STAGED_STATS) {
+        int stage = static_cast<int>(bits->Take(KEY_STAGE_BITS)) - 6;
+        p->stat_stages[stat] = static_cast<int8_t>(stage);
+    }
+
+    uint8_t status = static_cast<uint8_t>(bits->Take(KEY_STATUS_BITS));
+    p->toxic_counter = 0;
+    if (status < KEY_STATUS_POISON) {
+        p->status1 = status;
+    } else if (status == KEY_STATUS_POISON) {
+        p->status1 = domain::Status1::POISON;
+    } else if (status == KEY_STATUS_BURN) {
+        p->status1 = domain::Status1::BURN;
+    } else if (status == KEY_STATUS_FREEZE) {
+        p->status1 = domain::Status1::FREEZE;
+    } else if (status == KEY_STATUS_PARALYSIS) {
+        p->status1 = domain::Status1::PARALYSIS;
+    } else {
+        p->status1 = domain::Status1::TOXIC;
+        p->toxic_counter = status - KEY_STATUS_TOXIC;
+    }
+
+    p->protect_count = static_cast<uint8_t>(bits->Take(KEY_PROTECT_BITS));
+    p->is_protected = bits->Take(1) != 0;
+    p->is_charging = bits->Take(1) != 0;
+    p->charging_move = static_cast<domain::Move>(bits->Take(KEY_MOVE_BITS));
+    p->has_substitute = bits->Take(1) != 0;
+    p->substitute_hp = static_cast<uint16_t>(bits->Take(KEY_SUBSTITUTE_BITS));
+    p->is_seeded = bits->Take(1) != 0;
+    p->seeded_by = p->is_seeded ? Opponent(battler) : 0;
+    p->choiced_move = static_cast<domain::Move>(bits->Take(KEY_MOVE_BITS));
+
+    bool flying = p->is_charging && p->charging_move == domain::Move::Fly;
+    p->is_semi_invulnerable = flying;
+    p->semi_invulnerable_type = flying ? SemiInvulnerableType::OnAir : SemiInvulnerableType::None;
+}
+
+/**
+ * @brief Pack the state that matters for future play
+ * @param state Battle state at a turn boundary
+ * @param key Receives the key
+ * @return false (key unspecified) if the state has no canonical keyed form
+ */
+inline bool PackKey(const BattleState& state, StateKey* key) {
+    // Pending effects must be exactly the charging battlers' ChargeExpire events
+    uint8_t charging = 0;
+    for (uint8_t battler = 0; battler < NUM_BATTLERS; battler++) {
+        charging += state.battlers[battler].is_charging ? 1 : 0;
+    }
+    if (state.scheduler.count != charging) {
+        return false;
+    }
+    for (uint8_t i = 0; i < state.scheduler.count; i++) {
+        const ScheduledEvent& event = state.scheduler.events[i];
+        if (event.effect != ScheduledEffect::ChargeExpire || event.value != 0 ||
+            event.due_turn != static_cast<uint16_t>(state.scheduler.turn + 1) ||
+            event.battler >= NUM_BATTLERS || !state.battlers[event.battler].is_charging) {
+            return false;
+        }
+    }
+    if (charging == NUM_BATTLERS &&
+        state.scheduler.events[0].battler == state.scheduler.events[1].battler) {
+        return false;
+    }
+
+    uint8_t weather = static_cast<uint8_t>(state.field.weather);
+    if (weather >= (1u << KEY_FIELD_BITS) ||
+        state.field.weather_duration >= (1u << KEY_FIELD_BITS)) {
+        return false;
+    }
+    const uint8_t field[NUM_BATTLERS] = {weather, state.field.weather_duration};
+
+    for (uint8_t battler = 0; battler < NUM_BATTLERS; battler++) {
+        KeyBits bits = {0, 0};
+        if (!PackBattler(state.battlers[battler], battler, &bits)) {
+            return false;
+        }
+        bits.Put(state.sides[battler].stealth_rock, 1);
+        bits.Put(field[battler], KEY_FIELD_BITS);
+        key->words[battler] = bits.word;
+    }
+    return true;
+}
+
+/**
+ * @brief Restore the keyed state onto a state of the same matchup
+ * @param key Key written by PackKey
+ * @param state State whose fixed fields (species, stats, items, ...) are kept
+ *
+ * The scheduler is left empty (its turn is kept): the caller re-adds the
+ * charging battlers' ChargeExpire events. Evaluation terms are not updated.
+ */
+inline void UnpackKey(const StateKey& key, BattleState* state) {
+    for (uint8_t battler = 0; battler < NUM_BATTLERS; battler++) {
+        KeyBits bits = {key.words[battler], 0};
+        UnpackBattler(&bits, battler, &state->battlers[battler]);
+        state->sides[battler].stealth_rock = bits.Take(1) != 0;
+        uint8_t field = static_cast<uint8_t>(bits.Take(KEY_FIELD_BITS));
+        if (battler == 0) {
+            state->field.weather = static_cast<domain::Weather>(field);
+        } else {
+            state->field.weather_duration = field;
+        }
+    }
+    state->scheduler.count = 0;
+}
+
+}  // namespace state
+}  // namespace battle
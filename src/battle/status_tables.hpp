@@ -0,0 +1,106 @@
+/**
+ * @file battle/status_tables.hpp
+ * @brief Primary status mechanics as one table indexed by the status1 byte
+ *
+ * status1 packs the sleep turn counter into bits 0-2 and every other primary
+ * status into a single bit, so all 256 values can be precomputed. Each entry
+ * gives:
+ * - The action gate: one Random(act_roll) draw (no draw when act_roll is 0)
+ *   and the threshold below which the Pokemon cannot act
+ * - The status1 transition after acting or being blocked (sleep countdown,
+ *   thawing out)
+ * - The end-of-turn residual damage fraction, and whether it scales with the
+ *   toxic counter
+ *
+ * The turn loop's status gate is then one lookup, at most one draw and one
+ * compare, whatever the status.
+ *
+ * Based on pokeemerald:
+ * - src/battle_util.c:AtkCanceller_UnableToUseMove (sleep, freeze, paralysis)
+ * - src/battle_util.c:DoBattlerEndTurnEffects (poison, toxic, burn)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../domain/status.hpp"
+#include "chance.hpp"
+
+namespace battle {
+namespace status {
+
+/**
+ * @brief Highest toxic counter (damage stops growing at 15/16 max HP)
+ */
+constexpr uint8_t MAX_TOXIC_COUNTER = 15;
+
+/**
+ * @brief Precomputed mechanics of one status1 value
+ */
+struct Entry {
+    uint8_t act_roll;           // Draw Random(act_roll) before acting (0 = no draw; draw is 0)
+    uint8_t blocked_below;      // Cannot act if the draw is below this
+    uint8_t status_if_acts;     // status1 after acting
+    uint8_t status_if_blocked;  // status1 after being blocked
+    uint8_t residual_divisor;   // End-of-turn damage: max HP / divisor (0 = none)
+    uint8_t toxic_step;         // Toxic counter increment per turn (damage *= counter)
+};
+
+/**
+ * @brief Mechanics for every status1 byte
+ */
+struct Table {
+    Entry entries[256];
+};
+
+constexpr Entry BuildEntry(uint8_t status1) {
+    Entry entry{0, 0, status1, status1, 0, 0};
+    uint8_t sleep_turns = status1 & domain::Status1::SLEEP;
+
+    if (sleep_turns != 0) {
+        // Sleep: the counter ticks down before each move; at zero the Pokemon
+        // wakes up and acts the same turn (Gen III)
+        entry.blocked_below = (sleep_turns > 1) ? 1 : 0;
+        entry.status_if_acts = status1 & ~domain::Status1::SLEEP;
+        entry.status_if_blocked = static_cast<uint8_t>(status1 - 1);
+    } else if (status1 & domain::Status1::FREEZE) {
+        // Freeze: stays frozen 4 in 5 turns, otherwise thaws and acts
+        entry.act_roll = static_cast<uint8_t>(chance::STAYS_FROZEN.denominator);
+        entry.blocked_below = static_cast<uint8_t>(chance::STAYS_FROZEN.threshold[0]);
+        entry.status_if_acts = status1 & ~domain::Status1::FREEZE;
+    } else if (status1 & domain::Status1::PARALYSIS) {
+        // Paralysis: fully paralyzed 1 in 4 turns
+        entry.act_roll = static_cast<uint8_t>(chance::FULL_PARALYSIS.denominator);
+        entry.blocked_below = static_cast<uint8_t>(chance::FULL_PARALYSIS.threshold[0]);
+    }
+
+    // Residual damage; like burn, fractions round down (max HP < divisor takes none)
+    if (status1 & domain::Status1::TOXIC) {
+        entry.residual_divisor = 16;
+        entry.toxic_step = 1;
+    } else if (status1 & (domain::Status1::POISON | domain::Status1::BURN)) {
+        entry.residual_divisor = 8;
+    }
+    return entry;
+}
+
+constexpr Table BuildTable() {
+    Table table{};
+    for (int status1 = 0; status1 < 256; status1++) {
+        table.entries[status1] = BuildEntry(static_cast<uint8_t>(status1));
+    }
+    return table;
+}
+
+inline constexpr Table TABLE = BuildTable();
+
+/**
+ * @brief Mechanics of a status1 value
+ */
+inline const Entry& Lookup(uint8_t status1) {
+    return TABLE.entries[status1];
+}
+
+}  // namespace status
+}  // namespace battle
@@ -0,0 +1,132 @@
+/**
+ * @file battle/weather_tables.hpp
+ * @brief Precomputed weather modifier tables
+ *
+ * Weather effects are table lookups instead of per-weather compare chains:
+ * - Damage modifier by (weather, move type), in tenths (Rain/Sun: 1.5x and 0.5x)
+ * - End-of-turn residual damage divisor by weather (Sandstorm, Hail: 1/16)
+ * - Residual immunity by weather as a mask of types (Rock/Ground/Steel, Ice)
+ *
+ * A Pokemon's types become a bit mask, so the immunity check is one AND
+ * whatever the weather.
+ *
+ * Based on pokeemerald:
+ * - src/battle_util.c:CalculateBaseDamage (weather damage modifiers)
+ * - src/battle_util.c:DoFieldEndTurnEffects (sandstorm/hail damage)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../domain/species.hpp"
+#include "../domain/weather.hpp"
+#include "state/pokemon.hpp"
+
+namespace battle {
+namespace weather {
+
+/**
+ * @brief Damage modifier meaning 1x (modifiers are in tenths)
+ */
+constexpr uint8_t MODIFIER_NEUTRAL = 10;
+
+/**
+ * @brief Damage modifier table: tenths[weather][move type]
+ */
+struct DamageTable {
+    uint8_t tenths[domain::NUM_WEATHERS][domain::NUM_TYPES];
+};
+
+constexpr DamageTable BuildDamageTable() {
+    DamageTable table{};
+    for (uint8_t w = 0; w < domain::NUM_WEATHERS; w++) {
+        for (uint8_t t = 0; t < domain::NUM_TYPES; t++) {
+            table.tenths[w][t] = MODIFIER_NEUTRAL;
+        }
+    }
+
+    constexpr uint8_t rain = static_cast<uint8_t>(domain::Weather::Rain);
+    constexpr uint8_t sun = static_cast<uint8_t>(domain::Weather::Sun);
+    constexpr uint8_t water = static_cast<uint8_t>(domain::Type::Water);
+    constexpr uint8_t fire = static_cast<uint8_t>(domain::Type::Fire);
+
+    // Rain: Water 1.5x, Fire 0.5x
+    table.tenths[rain][water] = 15;
+    table.tenths[rain][fire] = 5;
+
+    // Sun: Fire 1.5x, Water 0.5x
+    table.tenths[sun][fire] = 15;
+    table.tenths[sun][water] = 5;
+    return table;
+}
+
+inline constexpr DamageTable DAMAGE_TABLE = BuildDamageTable();
+
+/**
+ * @brief Bit for a type in a type mask (Type::None has no bit)
+ */
+constexpr uint32_t TypeBit(domain::Type type) {
+    return type == domain::Type::None ? 0u : (1u << static_cast<uint8_t>(type));
+}
+
+/**
+ * @brief End-of-turn residual divisor by weather (0 = no residual damage)
+ */
+inline constexpr uint8_t RESIDUAL_DIVISOR[domain::NUM_WEATHERS] = {
+    0,   // None
+    16,  // Sandstorm
+    0,   // Rain
+    0,   // Sun
+    16,  // Hail
+};
+
+/**
+ * @brief Types immune to a weather's residual damage
+ */
+inline constexpr uint32_t RESIDUAL_IMMUNE_TYPES[domain::NUM_WEATHERS] = {
+    0,  // None
+    TypeBit(domain::Type::Rock) | TypeBit(domain::Type::Ground) | TypeBit(domain::Type::Steel),
+    0,  // Rain
+    0,  // Sun
+    TypeBit(domain::Type::Ice),
+};
+
+/**
+ * @brief Damage modifier in tenths for a move type under a weather
+ */
+inline uint8_t DamageModifier(domain::Weather weather, domain::Type move_type) {
+    uint8_t type = static_cast<uint8_t>(move_type);
+    if (type >= domain::NUM_TYPES) {
+        return MODIFIER_NEUTRAL;
+    }
+    return DAMAGE_TABLE.tenths[static_cast<uint8_t>(weather)][type];
+}
+
+/**
+ * @brief Type mask of a Pokemon (both type slots)
+ */
+inline uint32_t TypeMask(const state::Pokemon& p) {
+    return TypeBit(p.type1) | TypeBit(p.type2);
+}
+
+/**
+ * @brief Check if a Pokemon takes end-of-turn damage from the weather
+ */
+inline bool TakesResidualDamage(domain::Weather weather, const state::Pokemon& p) {
+    uint8_t w = static_cast<uint8_t>(weather);
+    return RESIDUAL_DIVISOR[w] != 0 && (RESIDUAL_IMMUNE_TYPES[w] & TypeMask(p)) == 0;
+}
+
+/**
+ * @brief End-of-turn weather damage for a Pokemon (0 if unaffected)
+ */
+inline uint16_t ResidualDamage(domain::Weather weather, const state::Pokemon& p) {
+    if (!TakesResidualDamage(weather, p)) {
+        return 0;
+    }
+    return p.max_hp / RESIDUAL_DIVISOR[static_cast<uint8_t>(weather)];
+}
+
+}  // namespace weather
+}  // namespace battle
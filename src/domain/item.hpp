@@ -0,0 +1,40 @@
+/**
+ * @file domain/item.hpp
+ * @brief Held item definitions
+ *
+ * Contains the Item enum for held items.
+ * Each Pokemon holds at most one item; Battle Factory sets always hold one.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace domain {
+
+/**
+ * @brief Held item enum
+ *
+ * Based on Gen III hold effects (pokeemerald: include/constants/hold_effects.h).
+ * Items are passive effects that hook specific battle events:
+ * - Turn order (Quick Claw, Macho Brace)
+ * - Damage calculation (Choice Band)
+ * - Move selection (Choice Band locks the first move used)
+ * - Drain healing (Big Root)
+ * - End of turn (Leftovers)
+ */
+enum class Item : uint8_t {
+    None = 0,    // No held item
+    Leftovers,   // Restores 1/16 max HP at the end of each turn
+    ChoiceBand,  // Attack 1.5x, locked into the first move used
+    QuickClaw,   // 20% chance to move first within a priority bracket
+    MachoBrace,  // Speed halved
+    BigRoot,     // Drain healing 1.3x (Gen IV item, used by Factory sets)
+};
+
+/**
+ * @brief Number of Item values (for tables indexed by item)
+ */
+constexpr uint8_t NUM_ITEMS = static_cast<uint8_t>(Item::BigRoot) + 1;
+
+}  // namespace domain
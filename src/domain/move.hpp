@@ -42,9 +42,18 @@ enum class Move : uint8_t {
     QuickAttack,
     StealthRock,
     LeechSeed,
+    FutureSight,
+    RainDance,
+    SunnyDay,
+    Hail,
     // TODO: Add more moves as we implement them
 };
 
+/**
+ * @brief Number of Move values (None through the last implemented move), for move-indexed tables
+ */
+constexpr uint8_t NUM_MOVES = static_cast<uint8_t>(Move::Hail) + 1;
+
 /**
  * @brief Move data structure
  */
@@ -39,6 +39,11 @@ enum class Type : uint8_t {
     None = 255,  // No type / type slot not used
 };
 
+/**
+ * @brief Number of real types (Normal through Dark), for type-indexed tables
+ */
+constexpr uint8_t NUM_TYPES = static_cast<uint8_t>(Type::Dark) + 1;
+
 /**
  * @brief Species enum for Pokemon species
  */
@@ -29,4 +29,9 @@ enum class Weather : uint8_t {
     Hail,       // Hail (damages non-Ice)
 };
 
+/**
+ * @brief Number of weather conditions, for weather-indexed tables
+ */
+constexpr uint8_t NUM_WEATHERS = static_cast<uint8_t>(Weather::Hail) + 1;
+
 }  // namespace domain
@@ -0,0 +1,178 @@
+/**
+ * @file test/host/analysis/test_batch_runner.cpp
+ * @brief Tests for the Monte Carlo batch runner
+ *
+ * This file tests:
+ * - Deterministic matchups report exact counts and statistics
+ * - Per-thread shards cover every battle and merge into one report
+ * - Move damage is separated from end-of-turn residual damage
+ * - Battles past the turn cap are reported as unfinished
+ * - Every played turn is scored through the dispatched score kernel
+ * - Greedy sides play their highest-damage choice (dispatched damage kernel)
+ */
+
+#include <gtest/gtest.h>
+
+#include "analysis/batch_runner.hpp"
+#include "battle/evaluation.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+analysis::PolicyChoice Choose(Player side, Move move, double probability) {
+    analysis::PolicyChoice choice;
+    choice.action = BattleAction{ActionType::MOVE, side, 0, move};
+    choice.probability = probability;
+    return choice;
+}
+
+uint8_t AlwaysTackle(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Tackle, 1.0);
+    return 1;
+}
+
+uint8_t AlwaysGrowl(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Growl, 1.0);
+    return 1;
+}
+
+uint8_t AlwaysSandstorm(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Sandstorm, 1.0);
+    return 1;
+}
+
+uint8_t TackleOrGrowl(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Tackle, 0.5);
+    out[1] = Choose(side, Move::Growl, 0.5);
+    return 2;
+}
+
+}  // namespace
+
+TEST(BatchRunnerTest, DeterministicMatchupIsExact) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 100), CreatePokemonWithStats(50, 50, 50, 10));
+
+    analysis::BatchOptions options;
+    options.battles = 100;
+    analysis::BatchReport report = analysis::RunBatch(engine, AlwaysTackle, AlwaysTackle, options);
+
+    EXPECT_EQ(report.battles, 100u);
+    EXPECT_EQ(report.player_wins, 100u);
+    EXPECT_EQ(report.unfinished, 0u);
+    EXPECT_EQ(report.turns_to_finish.Count(), 100u);
+    EXPECT_EQ(report.turns_to_finish.Max(), 1.0);
+    EXPECT_EQ(report.damage_per_hit.Quantile(0.5), 10.0) << "Tackle takes the enemy's 10 HP";
+    EXPECT_EQ(report.remaining_hp.Quantile(0.5), engine.GetPlayer().current_hp);
+    EXPECT_NEAR(report.distinct_states.Estimate(), 1.0, 0.1) << "Every battle ends the same way";
+}
+
+TEST(BatchRunnerTest, ShardsCoverEveryBattle) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 50, 100),
+                      CreatePokemonWithStats(60, 50, 50, 100));
+
+    analysis::BatchOptions options;
+    options.battles = 1001;
+    options.threads = 4;
+    options.batch_size = 16;
+    analysis::BatchReport report =
+        analysis::RunBatch(engine, TackleOrGrowl, TackleOrGrowl, options);
+
+    EXPECT_EQ(report.battles, 1001u);
+    EXPECT_EQ(report.player_wins + report.enemy_wins + report.draws + report.unfinished, 1001u);
+    EXPECT_EQ(report.turns_to_finish.Count(), 1001u - report.unfinished);
+    EXPECT_GT(report.player_wins, 350u) << "Mirror matchup";
+    EXPECT_GT(report.enemy_wins, 350u) << "Mirror matchup";
+    EXPECT_GT(report.distinct_states.Estimate(), 10.0);
+}
+
+TEST(BatchRunnerTest, ThreadCountDoesNotChangeSingleShardResult) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 50, 100),
+                      CreatePokemonWithStats(60, 50, 50, 100));
+
+    analysis::BatchOptions options;
+    options.battles = 200;
+    options.seed = 77;
+    analysis::BatchReport first = analysis::RunBatch(engine, TackleOrGrowl, TackleOrGrowl, options);
+    analysis::BatchReport second =
+        analysis::RunBatch(engine, TackleOrGrowl, TackleOrGrowl, options);
+
+    EXPECT_EQ(first.player_wins, second.player_wins) << "Same seed, same battles";
+    EXPECT_EQ(first.turns_to_finish.Quantile(0.5), second.turns_to_finish.Quantile(0.5));
+}
+
+TEST(BatchRunnerTest, ResidualDamageIsNotCountedAsHits) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 50, 160),
+                      CreatePokemonWithStats(50, 50, 50, 160));
+
+    analysis::BatchOptions options;
+    options.battles = 10;
+    options.max_turns = 5;
+    analysis::BatchReport report =
+        analysis::RunBatch(engine, AlwaysSandstorm, AlwaysSandstorm, options);
+
+    EXPECT_EQ(report.damage_per_hit.Count(), 0u) << "Only sandstorm chip damage was dealt";
+    EXPECT_EQ(report.unfinished, 10u);
+}
+
+TEST(BatchRunnerTest, TurnCapLeavesBattlesUnfinished) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 50), CreatePokemonWithStats(50, 50, 50));
+
+    analysis::BatchOptions options;
+    options.battles = 20;
+    options.max_turns = 30;
+    analysis::BatchReport report = analysis::RunBatch(engine, AlwaysGrowl, AlwaysGrowl, options);
+
+    EXPECT_EQ(report.unfinished, 20u);
+    EXPECT_EQ(report.turns_to_finish.Count(), 0u);
+    EXPECT_EQ(report.remaining_hp.Count(), 0u);
+}
+
+TEST(BatchRunnerTest, PositionScoreCoversEveryPlayedTurn) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 100), CreatePokemonWithStats(50, 50, 50, 10));
+    BattleEngine reference = engine;
+    reference.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle},
+                          BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle});
+
+    analysis::BatchOptions options;
+    options.battles = 50;
+    options.batch_size = 16;
+    analysis::BatchReport report = analysis::RunBatch(engine, AlwaysTackle, AlwaysTackle, options);
+
+    EXPECT_EQ(report.position_score.Count(), 50u) << "One turn per battle";
+    EXPECT_EQ(report.position_score.Min(), evaluation::Score(reference.GetEvaluation()));
+    EXPECT_EQ(report.position_score.Max(), evaluation::Score(reference.GetEvaluation()));
+    EXPECT_GT(report.position_score.Min(), 0.0) << "The player knocked the enemy out";
+}
+
+TEST(BatchRunnerTest, GreedyPlayerTakesStrongestChoice) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 50, 100),
+                      CreatePokemonWithStats(60, 50, 50, 100));
+
+    analysis::BatchOptions options;
+    options.battles = 100;
+    options.batch_size = 16;
+    analysis::BatchReport tackling =
+        analysis::RunBatch(engine, AlwaysTackle, AlwaysTackle, options);
+    options.greedy_player = true;
+    analysis::BatchReport greedy = analysis::RunBatch(engine, TackleOrGrowl, AlwaysTackle, options);
+
+    // Tackle out-damages Growl every turn, so the greedy player always Tackles
+    EXPECT_EQ(greedy.player_wins, tackling.player_wins);
+    EXPECT_EQ(greedy.enemy_wins, tackling.enemy_wins);
+    EXPECT_EQ(greedy.turns_to_finish.Quantile(0.5), tackling.turns_to_finish.Quantile(0.5));
+    EXPECT_EQ(greedy.damage_per_hit.Count(), tackling.damage_per_hit.Count());
+
+    options.greedy_enemy = true;
+    analysis::BatchReport stalling = analysis::RunBatch(engine, AlwaysGrowl, AlwaysGrowl, options);
+    EXPECT_EQ(stalling.damage_per_hit.Count(), 0u) << "A policy's only choice is kept";
+}
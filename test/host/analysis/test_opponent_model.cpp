@@ -0,0 +1,179 @@
+/**
+ * @file test/host/analysis/test_opponent_model.cpp
+ * @brief Tests for the opponent action model
+ *
+ * This file tests:
+ * - Situation keys separate situations and ignore irrelevant detail
+ * - Observed frequencies persist across a restart
+ * - Replies are ranked by observed play and the rest folded into one sample
+ * - Propagation with the model expands fewer branches and keeps all the mass
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <string>
+
+#include "analysis/opponent_model.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+analysis::PolicyChoice Choose(Player side, Move move, double probability) {
+    analysis::PolicyChoice choice;
+    choice.action = BattleAction{ActionType::MOVE, side, 0, move};
+    choice.probability = probability;
+    return choice;
+}
+
+uint8_t AlwaysTackle(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Tackle, 1.0);
+    return 1;
+}
+
+uint8_t UniformFour(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Growl, 0.25);
+    out[1] = Choose(side, Move::TailWhip, 0.25);
+    out[2] = Choose(side, Move::StringShot, 0.25);
+    out[3] = Choose(side, Move::Tackle, 0.25);
+    return 4;
+}
+
+state::Pokemon CreatePlayer() {
+    state::Pokemon player = CreatePokemonWithStats(60, 50, 80, 60);
+    player.species = Species::Pikachu;
+    return player;
+}
+
+BattleEngine CreateMatchup() {
+    BattleEngine engine;
+    engine.InitBattle(CreatePlayer(), CreatePokemonWithStats(60, 50, 50, 60));
+    return engine;
+}
+
+/**
+ * @brief Play games where the enemy always Tackles, observing every enemy decision
+ */
+void TrainTackler(analysis::OpponentModel& model, int games) {
+    BattleAction player = {ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction enemy = {ActionType::MOVE, Player::ENEMY, 0, Move::Tackle};
+    random::Initialize(77);
+    for (int game = 0; game < games; game++) {
+        BattleEngine engine = CreateMatchup();
+        while (!engine.IsBattleOver()) {
+            model.Observe(engine, Player::ENEMY, Move::Tackle);
+            engine.ExecuteTurn(player, enemy);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(OpponentModelTest, SituationKeySeparatesSituations) {
+    BattleEngine engine = CreateMatchup();
+    BattleEngine copy = engine;
+    EXPECT_EQ(analysis::SituationKey(engine, Player::ENEMY),
+              analysis::SituationKey(copy, Player::ENEMY));
+    EXPECT_NE(analysis::SituationKey(engine, Player::ENEMY),
+              analysis::SituationKey(engine, Player::PLAYER));
+
+    state::Pokemon hurt = CreatePokemonWithStats(60, 50, 50, 60);
+    hurt.current_hp = 10;
+    BattleEngine low;
+    low.InitBattle(CreatePlayer(), hurt);
+    EXPECT_NE(analysis::SituationKey(engine, Player::ENEMY),
+              analysis::SituationKey(low, Player::ENEMY));
+}
+
+TEST(OpponentModelTest, FrequenciesPersistAcrossRestart) {
+    std::string path = testing::TempDir() + "opponent_model.bin";
+    remove(path.c_str());
+    BattleEngine engine = CreateMatchup();
+    {
+        analysis::OpponentModel model;
+        ASSERT_TRUE(model.Open(path, 256));
+        for (int i = 0; i < 3; i++) {
+            model.Observe(engine, Player::ENEMY, Move::Growl);
+        }
+        model.Observe(engine, Player::ENEMY, Move::Tackle);
+    }
+
+    analysis::OpponentModel model;
+    ASSERT_TRUE(model.Open(path, 256));
+    EXPECT_TRUE(model.WarmStarted());
+    EXPECT_EQ(model.Observations(engine, Player::ENEMY), 4u);
+    EXPECT_DOUBLE_EQ(model.Frequency(engine, Player::ENEMY, Move::Growl), 0.75);
+    EXPECT_DOUBLE_EQ(model.Frequency(engine, Player::ENEMY, Move::Tackle), 0.25);
+    EXPECT_EQ(model.Observations(engine, Player::PLAYER), 0u);
+}
+
+TEST(OpponentModelTest, RankRepliesPutsObservedPlayFirst) {
+    std::string path = testing::TempDir() + "opponent_model_rank.bin";
+    remove(path.c_str());
+    analysis::OpponentModel model;
+    ASSERT_TRUE(model.Open(path, 256));
+    BattleEngine engine = CreateMatchup();
+    for (int i = 0; i < 36; i++) {
+        model.Observe(engine, Player::ENEMY, Move::Tackle);
+    }
+
+    analysis::PolicyChoice offered[analysis::MAX_POLICY_CHOICES];
+    uint8_t count = UniformFour(engine, Player::ENEMY, offered);
+    analysis::ReplyPruning pruning;
+    analysis::PolicyChoice kept[analysis::MAX_POLICY_CHOICES];
+    uint8_t kept_count =
+        model.RankReplies(engine, Player::ENEMY, offered, count, pruning, 1234, kept);
+
+    ASSERT_EQ(kept_count, 2) << "Tackle covers 37/40 of the mass; one reply stands in for the rest";
+    EXPECT_EQ(kept[0].action.move, Move::Tackle);
+    EXPECT_DOUBLE_EQ(kept[0].probability, 37.0 / 40.0);
+    EXPECT_NE(kept[1].action.move, Move::Tackle);
+    EXPECT_DOUBLE_EQ(kept[0].probability + kept[1].probability, 1.0);
+}
+
+TEST(OpponentModelTest, UnseenSituationKeepsPolicyWeights) {
+    std::string path = testing::TempDir() + "opponent_model_unseen.bin";
+    remove(path.c_str());
+    analysis::OpponentModel model;
+    ASSERT_TRUE(model.Open(path, 256));
+    BattleEngine engine = CreateMatchup();
+
+    analysis::PolicyChoice offered[analysis::MAX_POLICY_CHOICES];
+    uint8_t count = UniformFour(engine, Player::ENEMY, offered);
+    analysis::ReplyPruning pruning;
+    pruning.max_expanded = 4;
+    pruning.coverage = 1.0;
+    analysis::PolicyChoice kept[analysis::MAX_POLICY_CHOICES];
+    ASSERT_EQ(model.RankReplies(engine, Player::ENEMY, offered, count, pruning, 0, kept), 4);
+    for (uint8_t i = 0; i < 4; i++) {
+        EXPECT_DOUBLE_EQ(kept[i].probability, 0.25);
+    }
+}
+
+TEST(OpponentModelTest, PrunedPropagationExpandsLess) {
+    std::string path = testing::TempDir() + "opponent_model_search.bin";
+    remove(path.c_str());
+    analysis::OpponentModel model;
+    ASSERT_TRUE(model.Open(path, 4096));
+    TrainTackler(model, 50);
+
+    BattleEngine start = CreateMatchup();
+    analysis::PropagationOptions full;
+    full.max_turns = 6;
+    analysis::OutcomeDistribution exact =
+        analysis::PropagateOutcomes(start, AlwaysTackle, UniformFour, full);
+
+    analysis::PropagationOptions pruned = full;
+    pruned.enemy_model = &model;
+    analysis::OutcomeDistribution fast =
+        analysis::PropagateOutcomes(start, AlwaysTackle, UniformFour, pruned);
+
+    EXPECT_EQ(exact.replies_pruned, 0u);
+    EXPECT_GT(fast.replies_pruned, 0u);
+    EXPECT_LT(fast.outcomes_expanded, exact.outcomes_expanded);
+    EXPECT_NEAR(fast.player_win + fast.enemy_win + fast.draw + fast.unresolved, 1.0, 1e-9);
+}
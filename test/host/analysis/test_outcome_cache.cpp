@@ -0,0 +1,113 @@
+/**
+ * @file test/host/analysis/test_outcome_cache.cpp
+ * @brief Tests for the persistent matchup outcome cache
+ *
+ * This file tests:
+ * - Matchup outcomes are served from the cache after a restart
+ * - Policy pairs are cached separately
+ * - Propagation with an enemy model bypasses the cache
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <string>
+
+#include "analysis/opponent_model.hpp"
+#include "analysis/outcome_cache.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+uint8_t AlwaysTackle(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0].action = BattleAction{ActionType::MOVE, side, 0, Move::Tackle};
+    out[0].probability = 1.0;
+    return 1;
+}
+
+uint8_t UniformThree(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    const Move moves[] = {Move::Tackle, Move::Growl, Move::TailWhip};
+    for (uint8_t i = 0; i < 3; i++) {
+        out[i].action = BattleAction{ActionType::MOVE, side, 0, moves[i]};
+        out[i].probability = 1.0 / 3;
+    }
+    return 3;
+}
+
+}  // namespace
+
+TEST(OutcomeCacheTest, MatchupServedFromCacheAfterRestart) {
+    std::string path = testing::TempDir() + "outcome_cache.bin";
+    remove(path.c_str());
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 50, 10),
+                      CreatePokemonWithStats(200, 50, 50, 10));
+
+    bool hit = true;
+    analysis::OutcomeSummary first;
+    {
+        analysis::OutcomeCache cache;
+        ASSERT_TRUE(cache.Open(path, 256));
+        first = cache.Propagate(engine, AlwaysTackle, AlwaysTackle, 1,
+                                analysis::PropagationOptions(), &hit);
+        EXPECT_FALSE(hit);
+        EXPECT_DOUBLE_EQ(first.player_win, 0.5) << "Speed tie";
+    }
+
+    analysis::OutcomeCache cache;
+    ASSERT_TRUE(cache.Open(path, 256));
+    EXPECT_TRUE(cache.WarmStarted());
+    analysis::OutcomeSummary again = cache.Propagate(engine, AlwaysTackle, AlwaysTackle, 1,
+                                                     analysis::PropagationOptions(), &hit);
+    EXPECT_TRUE(hit);
+    EXPECT_DOUBLE_EQ(again.player_win, first.player_win);
+    EXPECT_DOUBLE_EQ(again.enemy_win, first.enemy_win);
+
+    cache.Propagate(engine, AlwaysTackle, AlwaysTackle, 2, analysis::PropagationOptions(), &hit);
+    EXPECT_FALSE(hit) << "Policy pairs are cached separately";
+}
+
+TEST(OutcomeCacheTest, EnemyModelBypassesCache) {
+    std::string path = testing::TempDir() + "outcome_cache_model.bin";
+    std::string model_path = testing::TempDir() + "outcome_cache_model_counts.bin";
+    remove(path.c_str());
+    remove(model_path.c_str());
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 80, 60),
+                      CreatePokemonWithStats(60, 50, 50, 60));
+    analysis::PropagationOptions plain;
+    plain.max_turns = 6;
+
+    analysis::OpponentModel model;
+    ASSERT_TRUE(model.Open(model_path, 4096));
+    for (int i = 0; i < 20; i++) {
+        model.Observe(engine, Player::ENEMY, Move::Tackle);
+    }
+    analysis::PropagationOptions pruned = plain;
+    pruned.enemy_model = &model;
+    pruned.pruning.max_expanded = 1;
+    analysis::OutcomeDistribution expected =
+        analysis::PropagateOutcomes(engine, AlwaysTackle, UniformThree, pruned);
+    ASSERT_GT(expected.replies_pruned, 0u);
+
+    analysis::OutcomeCache cache;
+    ASSERT_TRUE(cache.Open(path, 256));
+    bool hit = true;
+    cache.Propagate(engine, AlwaysTackle, UniformThree, 1, plain, &hit);
+    EXPECT_FALSE(hit);
+    ASSERT_EQ(cache.Size(), 1u);
+
+    for (int call = 0; call < 2; call++) {
+        analysis::OutcomeSummary summary =
+            cache.Propagate(engine, AlwaysTackle, UniformThree, 1, pruned, &hit);
+        EXPECT_FALSE(hit) << "Never served the unpruned entry or an earlier model's result";
+        EXPECT_DOUBLE_EQ(summary.player_win, expected.player_win);
+        EXPECT_DOUBLE_EQ(summary.enemy_win, expected.enemy_win);
+        EXPECT_DOUBLE_EQ(summary.unresolved, expected.unresolved);
+    }
+    EXPECT_EQ(cache.Size(), 1u) << "Model-dependent results are not stored";
+}
@@ -0,0 +1,218 @@
+/**
+ * @file test/host/analysis/test_propagation.cpp
+ * @brief Tests for exact outcome-distribution propagation
+ *
+ * This file tests:
+ * - Forced-draw mode (forced values, recorded bounds)
+ * - Canonical state encoding (copies hash equal, independent Engine copies)
+ * - Exact win/loss/draw probabilities and turn distribution
+ * - Merging of identical states reached through different chance outcomes
+ */
+
+#include <gtest/gtest.h>
+
+#include "analysis/propagation.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+analysis::PolicyChoice Choose(Player side, Move move, double probability) {
+    analysis::PolicyChoice choice;
+    choice.action = BattleAction{ActionType::MOVE, side, 0, move};
+    choice.probability = probability;
+    return choice;
+}
+
+uint8_t AlwaysTackle(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Tackle, 1.0);
+    return 1;
+}
+
+uint8_t AlwaysGrowl(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Growl, 1.0);
+    return 1;
+}
+
+uint8_t TackleOrGrowl(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Tackle, 0.5);
+    out[1] = Choose(side, Move::Growl, 0.5);
+    return 2;
+}
+
+uint8_t EmberOrThunderWave(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Ember, 0.75);
+    out[1] = Choose(side, Move::ThunderWave, 0.25);
+    return 2;
+}
+
+uint8_t FuryAttackOrQuickAttack(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::FuryAttack, 0.5);
+    out[1] = Choose(side, Move::QuickAttack, 0.5);
+    return 2;
+}
+
+double TotalMass(const analysis::OutcomeDistribution& result) {
+    return result.player_win + result.enemy_win + result.draw + result.unresolved;
+}
+
+}  // namespace
+
+// ============================================================================
+// Forced-Draw Mode Tests
+// ============================================================================
+
+TEST(ForcedDrawTest, ReturnsForcedValuesThenZero) {
+    const uint16_t forced[] = {3, 1};
+    random::BeginForcedDraws(forced, 2);
+    EXPECT_EQ(random::Random(10), 3);
+    EXPECT_EQ(random::Random(2), 1);
+    EXPECT_EQ(random::Random(100), 0) << "Draws past the forced prefix return 0";
+    EXPECT_EQ(random::Random(0), 0) << "Random(0) is not a draw";
+
+    random::DrawRecord records[random::MAX_RECORDED_DRAWS];
+    ASSERT_EQ(random::EndForcedDraws(records), 3);
+    EXPECT_EQ(records[0].bound, 10);
+    EXPECT_EQ(records[1].bound, 2);
+    EXPECT_EQ(records[2].bound, 100);
+    EXPECT_EQ(records[2].value, 0);
+}
+
+// ============================================================================
+// State Encoding Tests
+// ============================================================================
+
+TEST(StateEncodingTest, CopiesEncodeIdentically) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreateCharmander(), CreateBulbasaur());
+    BattleEngine copy = engine;
+    EXPECT_EQ(copy.HashState(), engine.HashState());
+
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction growl{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    copy.ExecuteTurn(tackle, growl);
+    EXPECT_NE(copy.HashState(), engine.HashState());
+}
+
+TEST(StateEncodingTest, LeechSeedCopyDrainsItsOwnState) {
+    // The seeder is resolved by battler index, so a copied Engine never touches the original
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    BattleAction leech_seed{ActionType::MOVE, Player::PLAYER, 0, Move::LeechSeed};
+    BattleAction growl{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    BattleAction player_growl{ActionType::MOVE, Player::PLAYER, 0, Move::Growl};
+    while (!engine.GetEnemy().is_seeded) {
+        engine.ExecuteTurn(leech_seed, growl);
+    }
+
+    BattleEngine copy = engine;
+    uint16_t original_enemy_hp = engine.GetEnemy().current_hp;
+    copy.ExecuteTurn(player_growl, growl);
+
+    EXPECT_EQ(copy.GetEnemy().current_hp, original_enemy_hp - 12);
+    EXPECT_EQ(engine.GetEnemy().current_hp, original_enemy_hp);
+    EXPECT_EQ(engine.GetPlayer().current_hp, 100);
+}
+
+// ============================================================================
+// Propagation Tests
+// ============================================================================
+
+TEST(PropagationTest, DeterministicMatchupResolvesInOneTurn) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 100), CreatePokemonWithStats(50, 50, 50, 10));
+
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, AlwaysTackle, AlwaysTackle);
+
+    EXPECT_DOUBLE_EQ(result.player_win, 1.0);
+    EXPECT_DOUBLE_EQ(result.enemy_win, 0.0);
+    EXPECT_DOUBLE_EQ(result.end_turn[1], 1.0);
+    EXPECT_EQ(result.outcomes_expanded, 1u) << "No chance draws in this turn";
+}
+
+TEST(PropagationTest, SpeedTieSplitsEvenly) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 50, 10),
+                      CreatePokemonWithStats(200, 50, 50, 10));
+
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, AlwaysTackle, AlwaysTackle);
+
+    EXPECT_DOUBLE_EQ(result.player_win, 0.5);
+    EXPECT_DOUBLE_EQ(result.enemy_win, 0.5);
+    EXPECT_DOUBLE_EQ(result.draw, 0.0);
+}
+
+TEST(PropagationTest, ParalysisGivesGeometricTurnDistribution) {
+    // Player one-shots the enemy whenever it is not fully paralyzed (75% per turn)
+    state::Pokemon player = CreatePokemonWithStats(200, 50, 100);
+    player.status1 = Status1::PARALYSIS;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 10));
+
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, AlwaysTackle, AlwaysGrowl);
+
+    // Each merged state sums 25 outcomes of mass 1/100, so allow rounding error
+    EXPECT_NEAR(result.end_turn[1], 0.75, 1e-12);
+    EXPECT_NEAR(result.end_turn[2], 0.25 * 0.75, 1e-12);
+    EXPECT_NEAR(result.end_turn[3], 0.25 * 0.25 * 0.75, 1e-12);
+    EXPECT_NEAR(result.player_win, 1.0, 1e-9);
+    EXPECT_LT(result.unresolved, 1e-9);
+    EXPECT_EQ(result.peak_states, 1u) << "All 25 paralysis outcomes merge into one state";
+}
+
+TEST(PropagationTest, StochasticPolicyWeightsBranches) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(200, 50, 100), CreatePokemonWithStats(50, 50, 50, 10));
+
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, TackleOrGrowl, AlwaysGrowl);
+
+    EXPECT_DOUBLE_EQ(result.end_turn[1], 0.5);
+    EXPECT_DOUBLE_EQ(result.end_turn[2], 0.25);
+    EXPECT_NEAR(result.player_win, 1.0, 1e-9);
+}
+
+TEST(PropagationTest, MassIsConservedInMixedMatchup) {
+    state::Pokemon player = CreateCharmander();
+    player.max_hp = 60;
+    player.current_hp = 60;
+    state::Pokemon enemy = CreatePikachu();
+    enemy.max_hp = 60;
+    enemy.current_hp = 60;
+    BattleEngine engine;
+    engine.InitBattle(player, enemy);
+
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, EmberOrThunderWave, FuryAttackOrQuickAttack);
+
+    EXPECT_NEAR(TotalMass(result), 1.0, 1e-12);
+    EXPECT_LT(result.unresolved, 1e-9);
+    EXPECT_GT(result.player_win, 0.0);
+    EXPECT_GT(result.enemy_win, 0.0);
+
+    double by_turn = 0.0;
+    for (double mass : result.end_turn) {
+        by_turn += mass;
+    }
+    EXPECT_NEAR(by_turn, result.player_win + result.enemy_win + result.draw, 1e-12);
+}
+
+TEST(PropagationTest, StallingMatchupReportsUnresolvedMass) {
+    BattleEngine engine;
+    engine.InitBattle(CreateCharmander(), CreateBulbasaur());
+
+    analysis::PropagationOptions options;
+    options.max_turns = 5;
+    analysis::OutcomeDistribution result =
+        analysis::PropagateOutcomes(engine, AlwaysGrowl, AlwaysGrowl, options);
+
+    EXPECT_DOUBLE_EQ(result.unresolved, 1.0);
+    EXPECT_DOUBLE_EQ(result.player_win + result.enemy_win + result.draw, 0.0);
+}
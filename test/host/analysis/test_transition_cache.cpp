@@ -0,0 +1,218 @@
+/**
+ * @file test/host/analysis/test_transition_cache.cpp
+ * @brief Tests for the concurrent turn-transition memo cache
+ *
+ * This file tests:
+ * - Lookups hit only on the same state, matchup and joint action, even when
+ *   two matchups share a fingerprint
+ * - Matchups differ with the fixed battle data and the installed script table
+ * - The MB budget is enforced by evicting the least recently used entries
+ * - Propagation with the cache reuses turns and matches the uncached result
+ * - Concurrent lookups and inserts keep the counters consistent
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+#include "analysis/propagation.hpp"
+#include "analysis/transition_cache.hpp"
+#include "battle/script/loader.hpp"
+#include "battle/script/scripts.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+BattleAction Action(Player side, Move move) {
+    return BattleAction{ActionType::MOVE, side, 0, move};
+}
+
+analysis::TransitionKey MakeKey(uint64_t word, Move player_move) {
+    analysis::TransitionKey key;
+    key.state = state::StateKey{{word, ~word}};
+    key.matchup = analysis::Matchup{};
+    key.matchup.bytes[0] = 7;
+    key.matchup.fingerprint = 7;
+    key.player = Action(Player::PLAYER, player_move);
+    key.enemy = Action(Player::ENEMY, Move::Tackle);
+    return key;
+}
+
+uint8_t TackleOrGrowl(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = analysis::PolicyChoice{Action(side, Move::Tackle), 0.5};
+    out[1] = analysis::PolicyChoice{Action(side, Move::Growl), 0.5};
+    return 2;
+}
+
+uint8_t EmberOrThunderWave(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = analysis::PolicyChoice{Action(side, Move::Ember), 0.75};
+    out[1] = analysis::PolicyChoice{Action(side, Move::ThunderWave), 0.25};
+    return 2;
+}
+
+}  // namespace
+
+TEST(TransitionCacheTest, HitsOnlyOnTheSameTransition) {
+    analysis::TransitionCache cache;
+    std::vector<analysis::Successor> successors = {
+        {state::StateKey{{1, 2}}, 0.25},
+        {state::StateKey{{3, 4}}, 0.75},
+    };
+    cache.Insert(MakeKey(10, Move::Growl), successors);
+
+    std::vector<analysis::Successor> out;
+    ASSERT_TRUE(cache.Lookup(MakeKey(10, Move::Growl), &out));
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[1].state, successors[1].state);
+    EXPECT_EQ(out[1].probability, 0.75);
+
+    EXPECT_FALSE(cache.Lookup(MakeKey(11, Move::Growl), &out)) << "Other state";
+    EXPECT_FALSE(cache.Lookup(MakeKey(10, Move::Tackle), &out)) << "Other player action";
+    analysis::TransitionKey other_matchup = MakeKey(10, Move::Growl);
+    other_matchup.matchup.bytes[analysis::MATCHUP_SIZE - 1] = 1;
+    EXPECT_FALSE(cache.Lookup(other_matchup, &out)) << "Other matchup, same fingerprint";
+    analysis::TransitionKey other_scripts = MakeKey(10, Move::Growl);
+    other_scripts.matchup.scripts = 1;
+    EXPECT_FALSE(cache.Lookup(other_scripts, &out)) << "Other script table, same fingerprint";
+
+    analysis::TransitionCacheStats stats = cache.Stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, analysis::TransitionCache::EntryBytes(2));
+}
+
+TEST(TransitionCacheTest, MatchupCoversFixedDataAndScripts) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 70, 60),
+                      CreatePokemonWithStats(55, 50, 60, 60));
+    analysis::Matchup start = analysis::MakeMatchup(engine);
+
+    // Keyed fields (HP, stages, status, weather) and the turn leave it unchanged
+    engine.ExecuteTurn(Action(Player::PLAYER, Move::Growl), Action(Player::ENEMY, Move::Tackle));
+    analysis::Matchup later = analysis::MakeMatchup(engine);
+    EXPECT_EQ(memcmp(later.bytes, start.bytes, analysis::MATCHUP_SIZE), 0);
+    EXPECT_EQ(later.scripts, 0u);
+    EXPECT_EQ(later.fingerprint, start.fingerprint);
+
+    BattleEngine faster;
+    faster.InitBattle(CreatePokemonWithStats(60, 50, 71, 60),
+                      CreatePokemonWithStats(55, 50, 60, 60));
+    EXPECT_NE(memcmp(analysis::MakeMatchup(faster).bytes, start.bytes, analysis::MATCHUP_SIZE), 0);
+
+    std::vector<uint8_t> blob = {'B', 'S', 'C', 'R', script::SCRIPT_BLOB_VERSION, 1,
+                                 static_cast<uint8_t>(Move::Tackle),
+                                 static_cast<uint8_t>(sizeof(script::SCRIPT_HIT))};
+    blob.insert(blob.end(), script::SCRIPT_HIT, script::SCRIPT_HIT + sizeof(script::SCRIPT_HIT));
+    script::ScriptTable table;
+    ASSERT_TRUE(script::LoadScriptTable(blob.data(), blob.size(), &table));
+    engine.SetScriptTable(&table);
+    analysis::Matchup scripted = analysis::MakeMatchup(engine);
+    EXPECT_EQ(scripted.scripts, table.checksum);
+    EXPECT_NE(scripted.fingerprint, start.fingerprint);
+}
+
+TEST(TransitionCacheTest, EvictsLeastRecentlyUsedWithinBudget) {
+    analysis::TransitionCacheOptions options;
+    options.capacity_mb = 1;
+    options.shards = 1;
+    analysis::TransitionCache cache(options);
+
+    // Each entry takes about 1/7 MB, so only a few fit
+    const size_t successor_count = 6000;
+    std::vector<analysis::Successor> successors(successor_count,
+                                                analysis::Successor{state::StateKey{{0, 0}}, 0.0});
+    size_t per_entry = analysis::TransitionCache::EntryBytes(successor_count);
+    size_t fit = (size_t(1) << 20) / per_entry;
+    ASSERT_GE(fit, 2u);
+
+    std::vector<analysis::Successor> out;
+    for (uint64_t i = 0; i < 20; i++) {
+        cache.Insert(MakeKey(i, Move::Growl), successors);
+        EXPECT_TRUE(cache.Lookup(MakeKey(0, Move::Growl), &out) || i >= fit)
+            << "The first entry stays warm while it is used";
+    }
+
+    analysis::TransitionCacheStats stats = cache.Stats();
+    EXPECT_EQ(stats.entries, fit);
+    EXPECT_LE(stats.bytes, size_t(1) << 20);
+    EXPECT_EQ(stats.evictions, 20 - fit);
+    EXPECT_TRUE(cache.Lookup(MakeKey(0, Move::Growl), &out)) << "Recently used entry kept";
+    EXPECT_TRUE(cache.Lookup(MakeKey(19, Move::Growl), &out));
+    EXPECT_FALSE(cache.Lookup(MakeKey(1, Move::Growl), &out)) << "Least recently used evicted";
+
+    cache.Clear();
+    EXPECT_EQ(cache.Stats().entries, 0u);
+    EXPECT_EQ(cache.Stats().bytes, 0u);
+}
+
+TEST(TransitionCacheTest, PropagationReusesTurns) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 50, 70, 60),
+                      CreatePokemonWithStats(55, 50, 60, 60));
+    analysis::PropagationOptions plain;
+    plain.max_turns = 8;
+    analysis::OutcomeDistribution expected =
+        analysis::PropagateOutcomes(engine, TackleOrGrowl, EmberOrThunderWave, plain);
+
+    analysis::TransitionCache cache;
+    analysis::PropagationOptions cached = plain;
+    cached.transitions = &cache;
+    analysis::OutcomeDistribution cold =
+        analysis::PropagateOutcomes(engine, TackleOrGrowl, EmberOrThunderWave, cached);
+    analysis::OutcomeDistribution warm =
+        analysis::PropagateOutcomes(engine, TackleOrGrowl, EmberOrThunderWave, cached);
+
+    for (const analysis::OutcomeDistribution* result : {&cold, &warm}) {
+        EXPECT_NEAR(result->player_win, expected.player_win, 1e-12);
+        EXPECT_NEAR(result->enemy_win, expected.enemy_win, 1e-12);
+        EXPECT_NEAR(result->draw, expected.draw, 1e-12);
+        EXPECT_NEAR(result->unresolved, expected.unresolved, 1e-12);
+        EXPECT_EQ(result->peak_states, expected.peak_states);
+    }
+    // Keys leave out the turn counter, so states that recur on later turns already hit
+    EXPECT_EQ(cold.outcomes_expanded < expected.outcomes_expanded, cold.transitions_reused > 0);
+    EXPECT_GT(cache.Stats().entries, 0u);
+    EXPECT_GT(warm.transitions_reused, 0u);
+    EXPECT_LT(warm.outcomes_expanded, expected.outcomes_expanded / 10);
+}
+
+TEST(TransitionCacheTest, ConcurrentUseKeepsCountersConsistent) {
+    analysis::TransitionCacheOptions options;
+    options.shards = 4;
+    analysis::TransitionCache cache(options);
+    const int threads = 4;
+    const uint64_t keys = 64;
+    const int rounds = 200;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&cache, t]() {
+            std::vector<analysis::Successor> out;
+            for (int round = 0; round < rounds; round++) {
+                uint64_t word = static_cast<uint64_t>(round * threads + t) % keys;
+                analysis::TransitionKey key = MakeKey(word, Move::Growl);
+                if (cache.Lookup(key, &out)) {
+                    EXPECT_EQ(out.size(), 1u);
+                    EXPECT_EQ(out[0].state.words[0], word);
+                } else {
+                    cache.Insert(key, {analysis::Successor{state::StateKey{{word, 0}}, 1.0}});
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    analysis::TransitionCacheStats stats = cache.Stats();
+    EXPECT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(threads * rounds));
+    EXPECT_EQ(stats.entries, keys);
+    EXPECT_EQ(stats.evictions, 0u);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file test/host/cache/test_mapped_table.cpp
+ * @brief Tests for the persistent memory-mapped cache table
+ *
+ * This file tests:
+ * - Records written in one run are found after reopening the file (warm start)
+ * - A different data hash or record layout discards the file (cold start)
+ * - The data hash changes with the engine mechanics version
+ * - A full probe window replaces entries instead of failing or growing
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "battle/engine.hpp"
+#include "cache/mapped_table.hpp"
+
+namespace {
+
+std::string CachePath(const char* name) {
+    std::string path = testing::TempDir() + name;
+    remove(path.c_str());
+    return path;
+}
+
+void Put(cache::MappedTable& table, uint64_t key, uint32_t value) {
+    void* slot = table.Insert(key);
+    ASSERT_NE(slot, nullptr);
+    memcpy(slot, &value, sizeof(value));
+}
+
+bool Get(const cache::MappedTable& table, uint64_t key, uint32_t* value) {
+    const void* slot = table.Find(key);
+    if (slot == nullptr) {
+        return false;
+    }
+    memcpy(value, slot, sizeof(*value));
+    return true;
+}
+
+}  // namespace
+
+TEST(MappedTableTest, RecordsSurviveReopen) {
+    std::string path = CachePath("mapped_table_reopen.bin");
+    {
+        cache::MappedTable table;
+        ASSERT_TRUE(table.Open(path, 42, sizeof(uint32_t), 64));
+        EXPECT_FALSE(table.WarmStarted());
+        Put(table, 0, 7);  // Key 0 is a valid key
+        Put(table, 12345, 99);
+        EXPECT_EQ(table.Size(), 2u);
+    }
+
+    cache::MappedTable table;
+    ASSERT_TRUE(table.Open(path, 42, sizeof(uint32_t), 64));
+    EXPECT_TRUE(table.WarmStarted());
+    uint32_t value = 0;
+    ASSERT_TRUE(Get(table, 0, &value));
+    EXPECT_EQ(value, 7u);
+    ASSERT_TRUE(Get(table, 12345, &value));
+    EXPECT_EQ(value, 99u);
+    EXPECT_FALSE(Get(table, 5, &value));
+}
+
+TEST(MappedTableTest, StaleFilesStartCold) {
+    std::string path = CachePath("mapped_table_stale.bin");
+    {
+        cache::MappedTable table;
+        ASSERT_TRUE(table.Open(path, 42, sizeof(uint32_t), 64));
+        Put(table, 1, 1);
+    }
+
+    uint32_t value = 0;
+    cache::MappedTable table;
+    ASSERT_TRUE(table.Open(path, 43, sizeof(uint32_t), 64));
+    EXPECT_FALSE(table.WarmStarted()) << "Different engine data";
+    EXPECT_FALSE(Get(table, 1, &value));
+    table.Close();
+
+    ASSERT_TRUE(table.Open(path, 43, sizeof(uint64_t), 64));
+    EXPECT_FALSE(table.WarmStarted()) << "Different record layout";
+    table.Close();
+
+    ASSERT_TRUE(table.Open(path, 43, sizeof(uint64_t), 128));
+    EXPECT_FALSE(table.WarmStarted()) << "Different capacity";
+}
+
+TEST(MappedTableTest, FullTableReplacesEntries) {
+    cache::MappedTable table;
+    ASSERT_TRUE(table.Open(CachePath("mapped_table_full.bin"), 1, sizeof(uint32_t), 16));
+    for (uint32_t key = 1; key <= 200; key++) {
+        Put(table, key, key);
+    }
+    EXPECT_LE(table.Size(), table.Capacity());
+
+    uint32_t value = 0;
+    ASSERT_TRUE(Get(table, 200, &value)) << "Latest insert is always present";
+    EXPECT_EQ(value, 200u);
+}
+
+TEST(MappedTableTest, EngineDataHashIsStable) {
+    EXPECT_EQ(cache::EngineDataHash(), cache::EngineDataHash());
+    EXPECT_NE(cache::EngineDataHash(), 0u);
+}
+
+TEST(MappedTableTest, MechanicsVersionBumpDiscardsFile) {
+    uint32_t version = battle::ENGINE_MECHANICS_VERSION;
+    EXPECT_EQ(cache::EngineDataHash(), cache::EngineDataHash(version));
+    EXPECT_NE(cache::EngineDataHash(version), cache::EngineDataHash(version + 1));
+
+    std::string path = CachePath("mapped_table_mechanics.bin");
+    {
+        cache::MappedTable table;
+        ASSERT_TRUE(table.Open(path, cache::EngineDataHash(version - 1), sizeof(uint32_t), 16));
+        Put(table, 7, 70);
+    }
+    cache::MappedTable table;
+    ASSERT_TRUE(table.Open(path, cache::EngineDataHash(), sizeof(uint32_t), 16));
+    EXPECT_FALSE(table.WarmStarted()) << "Written by older mechanics";
+    uint32_t value = 0;
+    EXPECT_FALSE(Get(table, 7, &value));
+}
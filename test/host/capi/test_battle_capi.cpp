@@ -0,0 +1,213 @@
+/**
+ * @file test/host/capi/test_battle_capi.cpp
+ * @brief Tests for the C ABI batch entry points
+ *
+ * This file tests:
+ * - The library reports the header's ABI version
+ * - Team codes start battles; malformed codes and bad indices are rejected per item
+ * - Batch steps match BattleEngine::StepMany on the same battles and seed
+ * - Observations are the canonical encoding, written into caller buffers
+ * - Finished battles report their winner and are not stepped again
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "capi/battle_capi.h"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+/**
+ * @brief Team code for a Pokemon with the given battle stats (see battle_capi.h)
+ */
+std::vector<uint8_t> TeamCode(Species species, Type type1, uint8_t atk, uint8_t def, uint8_t spe,
+                              uint16_t hp) {
+    std::vector<uint8_t> code(BATTLE_TEAM_CODE_SIZE, 0);
+    code[0] = static_cast<uint8_t>(species);
+    code[2] = static_cast<uint8_t>(type1);
+    code[3] = static_cast<uint8_t>(Type::None);
+    code[4] = 50;
+    code[5] = atk;
+    code[6] = def;
+    code[7] = 50;
+    code[8] = 50;
+    code[9] = spe;
+    code[12] = static_cast<uint8_t>(hp);
+    code[13] = static_cast<uint8_t>(hp >> 8);
+    return code;
+}
+
+std::vector<uint8_t> Matchup() {
+    std::vector<uint8_t> teams = TeamCode(Species::Charmander, Type::Fire, 60, 50, 70, 120);
+    std::vector<uint8_t> enemy = TeamCode(Species::Bulbasaur, Type::Grass, 55, 55, 60, 130);
+    teams.insert(teams.end(), enemy.begin(), enemy.end());
+    return teams;
+}
+
+/**
+ * @brief The engine a Matchup() team pair describes
+ */
+BattleEngine MatchupEngine() {
+    state::Pokemon player =
+        CreateTestPokemon(Species::Charmander, Type::Fire, Type::None, 120, 60, 50, 50, 50, 70);
+    state::Pokemon enemy =
+        CreateTestPokemon(Species::Bulbasaur, Type::Grass, Type::None, 130, 55, 55, 50, 50, 60);
+    player.level = 50;
+    enemy.level = 50;
+    BattleEngine engine;
+    engine.InitBattle(player, enemy);
+    return engine;
+}
+
+std::vector<uint8_t> Observe(const BattleEngine& engine) {
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+    return std::vector<uint8_t>(buffer, buffer + size);
+}
+
+}  // namespace
+
+TEST(BattleCapiTest, ReportsHeaderVersion) {
+    EXPECT_EQ(battle_abi_version(), static_cast<uint32_t>(BATTLE_ABI_VERSION));
+}
+
+TEST(BattleCapiTest, InitRejectsBadItemsOnly) {
+    int32_t status = BATTLE_OK;
+    EXPECT_EQ(battle_pool_create(0, &status), nullptr);
+    EXPECT_EQ(status, BATTLE_ERR_INVALID_ARGUMENT);
+
+    battle_pool* pool = battle_pool_create(4, &status);
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(status, BATTLE_OK);
+    EXPECT_EQ(battle_pool_capacity(pool), 4u);
+
+    std::vector<uint8_t> teams = Matchup();
+    std::vector<uint8_t> bad = Matchup();
+    bad[BATTLE_TEAM_CODE_SIZE + 12] = 0;  // Enemy max HP 0
+    bad[BATTLE_TEAM_CODE_SIZE + 13] = 0;
+    std::vector<uint8_t> all = teams;
+    all.insert(all.end(), bad.begin(), bad.end());
+    all.insert(all.end(), teams.begin(), teams.end());
+
+    const uint32_t battles[] = {0, 1, 9};
+    int32_t statuses[3];
+    EXPECT_EQ(battle_pool_init(pool, battles, all.data(), 3, statuses), BATTLE_ERR_INVALID_TEAM);
+    EXPECT_EQ(statuses[0], BATTLE_OK);
+    EXPECT_EQ(statuses[1], BATTLE_ERR_INVALID_TEAM);
+    EXPECT_EQ(statuses[2], BATTLE_ERR_OUT_OF_RANGE);
+
+    uint8_t observations[2 * BATTLE_MAX_OBSERVATION_SIZE];
+    uint32_t sizes[2];
+    EXPECT_EQ(battle_pool_observe(pool, battles, 2, observations, BATTLE_MAX_OBSERVATION_SIZE,
+                                  sizes),
+              BATTLE_ERR_NOT_STARTED);
+    EXPECT_EQ(std::vector<uint8_t>(observations, observations + sizes[0]),
+              Observe(MatchupEngine()));
+    EXPECT_EQ(sizes[1], 0u) << "Slot 1 was never started";
+
+    EXPECT_EQ(battle_pool_observe(pool, battles, 1, observations, 8, sizes),
+              BATTLE_ERR_BUFFER_TOO_SMALL);
+    battle_pool_destroy(pool);
+    battle_pool_destroy(nullptr);
+}
+
+TEST(BattleCapiTest, BatchStepMatchesStepMany) {
+    const uint32_t count = 6;
+    battle_pool* pool = battle_pool_create(count, nullptr);
+    ASSERT_NE(pool, nullptr);
+    std::vector<uint32_t> battles(count);
+    std::vector<uint8_t> teams;
+    std::vector<BattleEngine> engines(count, MatchupEngine());
+    for (uint32_t i = 0; i < count; i++) {
+        battles[i] = count - 1 - i;  // Steps address slots in any order
+        std::vector<uint8_t> matchup = Matchup();
+        teams.insert(teams.end(), matchup.begin(), matchup.end());
+    }
+    ASSERT_EQ(battle_pool_init(pool, battles.data(), teams.data(), count, nullptr), BATTLE_OK);
+
+    const Move player_moves[] = {Move::Tackle, Move::Ember, Move::Growl};
+    const Move enemy_moves[] = {Move::GigaDrain, Move::Tackle, Move::ThunderWave, Move::LeechSeed};
+    battle_seed_thread(99);
+    random::Initialize(99);
+    for (int turn = 0; turn < 12; turn++) {
+        std::vector<battle_step> steps(count);
+        std::vector<BattleAction> actions;
+        for (uint32_t i = 0; i < count; i++) {
+            Move player = player_moves[(turn + i) % 3];
+            Move enemy = enemy_moves[(turn * 3 + i) % 4];
+            steps[i] = battle_step{battles[i], static_cast<uint8_t>(player),
+                                   static_cast<uint8_t>(enemy), {0, 0}};
+            actions.push_back(BattleAction{ActionType::MOVE, Player::PLAYER, 0, player});
+            actions.push_back(BattleAction{ActionType::MOVE, Player::ENEMY, 0, enemy});
+        }
+        std::vector<battle_step_result> results(count);
+        ASSERT_EQ(battle_pool_step(pool, steps.data(), count, results.data()), BATTLE_OK);
+
+        // The reference skips finished battles the same way
+        std::vector<BattleEngine> live;
+        std::vector<BattleAction> live_actions;
+        std::vector<uint32_t> live_index;
+        for (uint32_t i = 0; i < count; i++) {
+            if (!engines[i].IsBattleOver()) {
+                live.push_back(engines[i]);
+                live_actions.push_back(actions[2 * i]);
+                live_actions.push_back(actions[2 * i + 1]);
+                live_index.push_back(i);
+            }
+        }
+        BattleEngine::StepMany(live.data(), live_actions.data(), live.size());
+        for (size_t k = 0; k < live.size(); k++) {
+            engines[live_index[k]] = live[k];
+        }
+
+        std::vector<uint8_t> observations(count * BATTLE_MAX_OBSERVATION_SIZE);
+        std::vector<uint32_t> sizes(count);
+        ASSERT_EQ(battle_pool_observe(pool, battles.data(), count, observations.data(),
+                                      BATTLE_MAX_OBSERVATION_SIZE, sizes.data()),
+                  BATTLE_OK);
+        for (uint32_t i = 0; i < count; i++) {
+            const uint8_t* observation = observations.data() + i * BATTLE_MAX_OBSERVATION_SIZE;
+            EXPECT_EQ(std::vector<uint8_t>(observation, observation + sizes[i]),
+                      Observe(engines[i]))
+                << "turn " << turn << " step " << i;
+            EXPECT_EQ(results[i].status, BATTLE_OK);
+            EXPECT_EQ(results[i].turn, engines[i].GetState().scheduler.turn);
+        }
+    }
+    battle_pool_destroy(pool);
+}
+
+TEST(BattleCapiTest, FinishedBattlesReportWinner) {
+    battle_pool* pool = battle_pool_create(2, nullptr);
+    ASSERT_NE(pool, nullptr);
+    std::vector<uint8_t> teams = TeamCode(Species::Charmander, Type::Fire, 250, 50, 90, 200);
+    std::vector<uint8_t> enemy = TeamCode(Species::Pidgey, Type::Normal, 10, 5, 10, 1);
+    teams.insert(teams.end(), enemy.begin(), enemy.end());
+    const uint32_t slot = 1;
+    ASSERT_EQ(battle_pool_init(pool, &slot, teams.data(), 1, nullptr), BATTLE_OK);
+
+    battle_seed_thread(5);
+    uint8_t tackle = static_cast<uint8_t>(Move::Tackle);
+    battle_step steps[] = {{slot, tackle, tackle, {0, 0}}, {slot, tackle, tackle, {0, 0}}};
+    battle_step_result results[2];
+    EXPECT_EQ(battle_pool_step(pool, steps, 2, results), BATTLE_ERR_INVALID_ARGUMENT)
+        << "A slot may appear once per batch";
+    EXPECT_EQ(results[0].status, BATTLE_OK);
+    EXPECT_EQ(results[0].winner, BATTLE_WINNER_PLAYER);
+    EXPECT_EQ(results[1].status, BATTLE_ERR_INVALID_ARGUMENT);
+
+    ASSERT_EQ(battle_pool_step(pool, steps, 1, results), BATTLE_OK);
+    EXPECT_EQ(results[0].winner, BATTLE_WINNER_PLAYER);
+    EXPECT_EQ(results[0].turn, 1) << "Finished battles are not stepped again";
+
+    battle_step unknown_move = {slot, 200, tackle, {0, 0}};
+    EXPECT_EQ(battle_pool_step(pool, &unknown_move, 1, results), BATTLE_ERR_INVALID_MOVE);
+    battle_step unstarted = {0, tackle, tackle, {0, 0}};
+    EXPECT_EQ(battle_pool_step(pool, &unstarted, 1, results), BATTLE_ERR_NOT_STARTED);
+    battle_pool_destroy(pool);
+}
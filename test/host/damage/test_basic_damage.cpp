@@ -21,12 +21,12 @@ class BasicDamageTest : public ::testing::Test {
         // Initialize RNG with known seed for deterministic tests
         battle::random::Initialize(42);
 
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 /**
@@ -39,7 +39,7 @@ TEST_F(BasicDamageTest, TackleDealsDamage) {
     uint16_t initial_hp = defender.current_hp;
 
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -56,7 +56,7 @@ TEST_F(BasicDamageTest, EmberDealsDamage) {
     uint16_t initial_hp = defender.current_hp;
 
     domain::MoveData ember = CreateEmber();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &ember);
+    battle::BattleContext ctx = CreateBattleContext(block, &ember);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -71,17 +71,17 @@ TEST_F(BasicDamageTest, EmberDealsDamage) {
  */
 TEST_F(BasicDamageTest, StrongerMoveDealsMoreDamage) {
     // Test Tackle damage
-    battle::state::Pokemon defender1 = CreateBulbasaur();
+    battle::state::BattleState block1 = CreateBattleState(attacker, CreateBulbasaur());
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender1, &tackle);
+    battle::BattleContext ctx1 = CreateBattleContext(block1, &tackle);
     battle::effects::Effect_Hit(ctx1);
     uint16_t tackle_damage = ctx1.damage_dealt;
 
     // Test Ember damage (reset RNG for fair comparison)
     battle::random::Initialize(42);
-    battle::state::Pokemon defender2 = CreateBulbasaur();
+    battle::state::BattleState block2 = CreateBattleState(attacker, CreateBulbasaur());
     domain::MoveData ember = CreateEmber();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender2, &ember);
+    battle::BattleContext ctx2 = CreateBattleContext(block2, &ember);
     battle::effects::Effect_Hit(ctx2);
     uint16_t ember_damage = ctx2.damage_dealt;
 
@@ -97,17 +97,17 @@ TEST_F(BasicDamageTest, StrongerMoveDealsMoreDamage) {
 TEST_F(BasicDamageTest, DamageIsDeterministicWithSeed) {
     // First calculation
     battle::random::Initialize(100);
-    battle::state::Pokemon defender1 = CreateBulbasaur();
+    battle::state::BattleState block1 = CreateBattleState(attacker, CreateBulbasaur());
     domain::MoveData tackle1 = CreateTackle();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender1, &tackle1);
+    battle::BattleContext ctx1 = CreateBattleContext(block1, &tackle1);
     battle::effects::Effect_Hit(ctx1);
     uint16_t damage1 = ctx1.damage_dealt;
 
     // Second calculation with same seed
     battle::random::Initialize(100);
-    battle::state::Pokemon defender2 = CreateBulbasaur();
+    battle::state::BattleState block2 = CreateBattleState(attacker, CreateBulbasaur());
     domain::MoveData tackle2 = CreateTackle();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender2, &tackle2);
+    battle::BattleContext ctx2 = CreateBattleContext(block2, &tackle2);
     battle::effects::Effect_Hit(ctx2);
     uint16_t damage2 = ctx2.damage_dealt;
 
@@ -119,17 +119,19 @@ TEST_F(BasicDamageTest, DamageIsDeterministicWithSeed) {
  */
 TEST_F(BasicDamageTest, HigherDefenseReducesDamage) {
     // Low defense Pokemon
-    battle::state::Pokemon low_def = CreatePokemonWithStats(50, 30, 50);
+    battle::state::BattleState low_def = CreateBattleState(attacker,
+                                                           CreatePokemonWithStats(50, 30, 50));
     domain::MoveData tackle1 = CreateTackle();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &low_def, &tackle1);
+    battle::BattleContext ctx1 = CreateBattleContext(low_def, &tackle1);
     battle::effects::Effect_Hit(ctx1);
     uint16_t damage_to_low_def = ctx1.damage_dealt;
 
     // High defense Pokemon (reset RNG for fair comparison)
     battle::random::Initialize(42);
-    battle::state::Pokemon high_def = CreatePokemonWithStats(50, 80, 50);
+    battle::state::BattleState high_def = CreateBattleState(attacker,
+                                                            CreatePokemonWithStats(50, 80, 50));
     domain::MoveData tackle2 = CreateTackle();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &high_def, &tackle2);
+    battle::BattleContext ctx2 = CreateBattleContext(high_def, &tackle2);
     battle::effects::Effect_Hit(ctx2);
     uint16_t damage_to_high_def = ctx2.damage_dealt;
 
@@ -149,7 +151,7 @@ TEST_F(BasicDamageTest, HigherDefenseReducesDamage) {
  */
 TEST_F(BasicDamageTest, BasicDamageCalculation) {
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -166,20 +168,20 @@ TEST_F(BasicDamageTest, BasicDamageCalculation) {
  * Higher Attack should deal more damage
  */
 TEST_F(BasicDamageTest, DamageScalesWithAttack) {
-    battle::state::Pokemon weak_attacker = CreatePokemonWithStats(30, 40, 50, 100);
-    battle::state::Pokemon strong_attacker = CreatePokemonWithStats(90, 40, 50, 100);
-    battle::state::Pokemon defender1 = CreateBulbasaur();
-    battle::state::Pokemon defender2 = CreateBulbasaur();
+    battle::state::BattleState weak_attacker =
+        CreateBattleState(CreatePokemonWithStats(30, 40, 50, 100), CreateBulbasaur());
+    battle::state::BattleState strong_attacker =
+        CreateBattleState(CreatePokemonWithStats(90, 40, 50, 100), CreateBulbasaur());
 
     domain::MoveData tackle = CreateTackle();
 
     // Test weak attacker
-    battle::BattleContext ctx1 = CreateBattleContext(&weak_attacker, &defender1, &tackle);
+    battle::BattleContext ctx1 = CreateBattleContext(weak_attacker, &tackle);
     battle::effects::Effect_Hit(ctx1);
 
     // Test strong attacker (reset RNG for fair comparison)
     battle::random::Initialize(42);
-    battle::BattleContext ctx2 = CreateBattleContext(&strong_attacker, &defender2, &tackle);
+    battle::BattleContext ctx2 = CreateBattleContext(strong_attacker, &tackle);
     battle::effects::Effect_Hit(ctx2);
 
     EXPECT_GT(ctx2.damage_dealt, ctx1.damage_dealt) << "Higher Attack should deal more damage";
@@ -192,20 +194,20 @@ TEST_F(BasicDamageTest, DamageScalesWithAttack) {
  * Higher Defense should reduce damage taken
  */
 TEST_F(BasicDamageTest, DamageScalesWithDefense) {
-    battle::state::Pokemon attacker1 = CreateCharmander();
-    battle::state::Pokemon attacker2 = CreateCharmander();
-    battle::state::Pokemon weak_defender = CreatePokemonWithStats(50, 20, 50, 100);
-    battle::state::Pokemon strong_defender = CreatePokemonWithStats(50, 80, 50, 100);
+    battle::state::BattleState weak_defender =
+        CreateBattleState(CreateCharmander(), CreatePokemonWithStats(50, 20, 50, 100));
+    battle::state::BattleState strong_defender =
+        CreateBattleState(CreateCharmander(), CreatePokemonWithStats(50, 80, 50, 100));
 
     domain::MoveData tackle = CreateTackle();
 
     // Test weak defender
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker1, &weak_defender, &tackle);
+    battle::BattleContext ctx1 = CreateBattleContext(weak_defender, &tackle);
     battle::effects::Effect_Hit(ctx1);
 
     // Test strong defender (reset RNG for fair comparison)
     battle::random::Initialize(42);
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker2, &strong_defender, &tackle);
+    battle::BattleContext ctx2 = CreateBattleContext(strong_defender, &tackle);
     battle::effects::Effect_Hit(ctx2);
 
     EXPECT_GT(ctx1.damage_dealt, ctx2.damage_dealt) << "Higher Defense should reduce damage taken";
@@ -218,12 +220,13 @@ TEST_F(BasicDamageTest, DamageScalesWithDefense) {
  * Pokemon at 1 HP should faint
  */
 TEST_F(BasicDamageTest, CanCauseKO) {
-    battle::state::Pokemon weak_defender = CreatePokemonWithStats(50, 50, 50, 100);
+    battle::state::Pokemon& weak_defender = defender;
+    weak_defender = CreatePokemonWithStats(50, 50, 50, 100);
     weak_defender.current_hp = 1;
     weak_defender.is_fainted = false;
 
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &weak_defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -238,11 +241,11 @@ TEST_F(BasicDamageTest, CanCauseKO) {
  * Even with very weak Attack vs. very high Defense, at least 1 damage
  */
 TEST_F(BasicDamageTest, MinimumDamage) {
-    battle::state::Pokemon weak_attacker = CreatePokemonWithStats(5, 50, 50, 100);
-    battle::state::Pokemon tank_defender = CreatePokemonWithStats(50, 200, 50, 100);
+    battle::state::BattleState block = CreateBattleState(CreatePokemonWithStats(5, 50, 50, 100),
+                                                         CreatePokemonWithStats(50, 200, 50, 100));
 
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&weak_attacker, &tank_defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -256,11 +259,12 @@ TEST_F(BasicDamageTest, MinimumDamage) {
  * Overkill damage should not cause negative HP
  */
 TEST_F(BasicDamageTest, HpClampedAtZero) {
-    battle::state::Pokemon strong_attacker = CreatePokemonWithStats(200, 50, 50, 100);
-    battle::state::Pokemon weak_defender = CreatePokemonWithStats(50, 50, 50, 10);
+    battle::state::BattleState block = CreateBattleState(CreatePokemonWithStats(200, 50, 50, 100),
+                                                         CreatePokemonWithStats(50, 50, 50, 10));
+    battle::state::Pokemon& weak_defender = block.battlers[1];
 
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&strong_attacker, &weak_defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -279,7 +283,7 @@ TEST_F(BasicDamageTest, DoesNotModifyAttacker) {
     bool original_fainted = attacker.is_fainted;
 
     domain::MoveData tackle = CreateTackle();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::effects::Effect_Hit(ctx);
 
@@ -20,19 +20,19 @@ class BurnTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(BurnTest, DealsDamage) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData move = CreateEmber();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BurnHit(ctx);
 
     // Defender should take damage
@@ -41,107 +41,118 @@ TEST_F(BurnTest, DealsDamage) {
 }
 
 TEST_F(BurnTest, CanApplyBurn) {
-    // Test probabilistically by running many trials
+    // Enumerate every outcome of the burn roll exactly once
     int burns = 0;
-    const int trials = 100;
-
-    for (int i = 0; i < trials; i++) {
-        battle::random::Initialize(i);  // Different seed per trial
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
+    int outcomes = 0;
+
+    battle::random::Enumerator enumerator;
+    battle::random::BeginEnumeration(enumerator);
+    do {
+        battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                                  CreateBulbasaur());
+        battle::state::Pokemon& test_defender = test_block.battlers[1];
         domain::MoveData test_move = CreateEmber();
 
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
+        battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
         battle::effects::Effect_BurnHit(test_ctx);
 
+        outcomes++;
         if (test_defender.status1 != 0) {  // STATUS1_BURN is non-zero
             burns++;
         }
-    }
+    } while (battle::random::NextOutcome(enumerator));
 
-    // With 10% burn chance, expect around 10 burns out of 100
-    // Allow 3-20 range for statistical variance
-    EXPECT_GE(burns, 3) << "Should have some burns (at least 3/100)";
-    EXPECT_LE(burns, 20) << "Should not burn too often (max 20/100)";
+    // Ember's 10% burn chance: exactly 10 of the 100 equally likely rolls burn
+    EXPECT_EQ(outcomes, 100);
+    EXPECT_EQ(burns, 10);
 }
 
 TEST_F(BurnTest, DamageAndBurnBothApply) {
     // Verify both damage and burn can occur in same attack
-    // Run multiple trials to find case where burn applies
-    bool found_burn_with_damage = false;
-    for (int i = 0; i < 200 && !found_burn_with_damage; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
-        domain::MoveData test_move = CreateEmber();
-
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
-        battle::effects::Effect_BurnHit(test_ctx);
-
-        if (test_defender.status1 != 0 && test_defender.current_hp < test_defender.max_hp) {
-            found_burn_with_damage = true;
-        }
-    }
-
-    EXPECT_TRUE(found_burn_with_damage) << "Both damage and burn should apply in same attack";
+    // Script the burn roll to succeed (0 < 10)
+    const uint16_t burn_roll[] = {0};
+    battle::random::Script script;
+    battle::random::BeginScript(script, burn_roll, 1);
+
+    battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                              CreateBulbasaur());
+    battle::state::Pokemon& test_defender = test_block.battlers[1];
+    domain::MoveData test_move = CreateEmber();
+
+    battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
+    battle::effects::Effect_BurnHit(test_ctx);
+    EXPECT_EQ(battle::random::EndScript(script), 1) << "Only the burn roll draws";
+
+    EXPECT_NE(test_defender.status1, 0) << "Burn should apply";
+    EXPECT_LT(test_defender.current_hp, test_defender.max_hp) << "Damage should apply too";
 }
 
 TEST_F(BurnTest, FireTypeImmuneToBurn) {
     // Fire-type defender should be immune to burn
-    // Run many trials - Fire type should NEVER burn
-    for (int i = 0; i < 100; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateCharmander();  // Fire type
+    // Every outcome of the burn roll - Fire type should NEVER burn
+    int trial = 0;
+    battle::random::Enumerator enumerator;
+    battle::random::BeginEnumeration(enumerator);
+    do {
+        battle::state::BattleState test_block =
+            CreateBattleState(CreateCharmander(), CreateCharmander());  // Fire type defender
+        battle::state::Pokemon& test_defender = test_block.battlers[1];
         domain::MoveData test_move = CreateEmber();
 
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
+        battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
         battle::effects::Effect_BurnHit(test_ctx);
 
-        EXPECT_EQ(test_defender.status1, 0) << "Fire type immune to burn (trial " << i << ")";
-    }
+        EXPECT_EQ(test_defender.status1, 0) << "Fire type immune to burn (outcome " << trial << ")";
+        trial++;
+    } while (battle::random::NextOutcome(enumerator));
 }
 
 TEST_F(BurnTest, AlreadyStatusedCantBurn) {
     // Pokemon with existing status cannot be burned
-    // Run many trials - already statused Pokemon should NEVER burn
-    for (int i = 0; i < 100; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
+    // Every outcome of the burn roll - already statused Pokemon should NEVER burn
+    int trial = 0;
+    battle::random::Enumerator enumerator;
+    battle::random::BeginEnumeration(enumerator);
+    do {
+        battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                                  CreateBulbasaur());
+        battle::state::Pokemon& test_defender = test_block.battlers[1];
         test_defender.status1 = 1;  // Pre-existing status
         domain::MoveData test_move = CreateEmber();
 
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
+        battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
         battle::effects::Effect_BurnHit(test_ctx);
 
         EXPECT_EQ(test_defender.status1, 1)
-            << "Already-statused Pokemon cannot burn (trial " << i << ")";
-    }
+            << "Already-statused Pokemon cannot burn (outcome " << trial << ")";
+        trial++;
+    } while (battle::random::NextOutcome(enumerator));
 }
 
 TEST_F(BurnTest, FaintedTargetNotBurned) {
     // Pokemon that faints from damage should not be burned
-    // Run many trials - dead Pokemon should never burn
-    for (int i = 0; i < 100; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
+    // Every outcome of the burn roll - dead Pokemon should never burn
+    int trial = 0;
+    battle::random::Enumerator enumerator;
+    battle::random::BeginEnumeration(enumerator);
+    do {
+        battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                                  CreateBulbasaur());
+        battle::state::Pokemon& test_defender = test_block.battlers[1];
         test_defender.current_hp = 1;  // Will die
         domain::MoveData test_move = CreateEmber();
 
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
+        battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
         battle::effects::Effect_BurnHit(test_ctx);
 
-        EXPECT_EQ(test_defender.current_hp, 0) << "Fainted Pokemon HP is 0 (trial " << i << ")";
-        EXPECT_EQ(test_defender.status1, 0) << "Fainted Pokemon not burned (trial " << i << ")";
-        EXPECT_TRUE(test_defender.is_fainted) << "Faint flag set correctly (trial " << i << ")";
-    }
+        EXPECT_EQ(test_defender.current_hp, 0) << "Fainted Pokemon HP is 0 (outcome " << trial
+                                               << ")";
+        EXPECT_EQ(test_defender.status1, 0) << "Fainted Pokemon not burned (outcome " << trial
+                                            << ")";
+        EXPECT_TRUE(test_defender.is_fainted)
+            << "Faint flag set correctly (outcome " << trial << ")";
+        trial++;
+    } while (battle::random::NextOutcome(enumerator));
 }
 
 TEST_F(BurnTest, DoesNotModifyAttacker) {
@@ -149,7 +160,7 @@ TEST_F(BurnTest, DoesNotModifyAttacker) {
     uint8_t original_status = attacker.status1;
     domain::MoveData move = CreateEmber();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BurnHit(ctx);
 
     // Attacker should be unchanged
@@ -161,72 +172,80 @@ TEST_F(BurnTest, DoesNotModifyAttacker) {
 TEST_F(BurnTest, ZeroPowerMoveStillChecksBurn) {
     // Edge case: If move somehow has 0 power, burn should still be checked
     int burns = 0;
-    for (int i = 0; i < 100; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
+    battle::random::Enumerator enumerator;
+    battle::random::BeginEnumeration(enumerator);
+    do {
+        battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                                  CreateBulbasaur());
+        battle::state::Pokemon& test_defender = test_block.battlers[1];
         domain::MoveData test_move = CreateEmber();
         test_move.power = 0;
 
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
+        battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
         battle::effects::Effect_BurnHit(test_ctx);
 
         if (test_defender.status1 != 0) {
             burns++;
         }
-    }
+    } while (battle::random::NextOutcome(enumerator));
 
-    // Should still have ~10% burn rate even with 0 damage
-    EXPECT_GE(burns, 3) << "Zero-damage move should still roll for burn";
+    // Same 10% burn rate even with 0 damage
+    EXPECT_EQ(burns, 10) << "Zero-damage move should still roll for burn";
 }
 
 TEST_F(BurnTest, BurnProbabilityRespected) {
-    // Verify the burn probability matches Ember's 10% chance
-    int burns = 0;
-    const int trials = 1000;  // More trials for better statistics
-
-    for (int i = 0; i < trials; i++) {
-        battle::random::Initialize(i);
-        battle::state::Pokemon test_attacker = CreateCharmander();
-        battle::state::Pokemon test_defender = CreateBulbasaur();
-        domain::MoveData test_move = CreateEmber();
-
-        battle::BattleContext test_ctx =
-            CreateBattleContext(&test_attacker, &test_defender, &test_move);
-        battle::effects::Effect_BurnHit(test_ctx);
-
-        if (test_defender.status1 != 0) {
-            burns++;
-        }
+    // Verify the burn probability matches Ember's effect chance exactly, for several chances
+    const uint8_t chances[] = {1, 10, 30, 100};
+    for (uint8_t chance : chances) {
+        int burns = 0;
+        int outcomes = 0;
+
+        battle::random::Enumerator enumerator;
+        battle::random::BeginEnumeration(enumerator);
+        do {
+            battle::state::BattleState test_block = CreateBattleState(CreateCharmander(),
+                                                                      CreateBulbasaur());
+            battle::state::Pokemon& test_defender = test_block.battlers[1];
+            domain::MoveData test_move = CreateEmber();
+            test_move.effect_chance = chance;
+
+            battle::BattleContext test_ctx = CreateBattleContext(test_block, &test_move);
+            battle::effects::Effect_BurnHit(test_ctx);
+
+            outcomes++;
+            if (test_defender.status1 != 0) {
+                burns++;
+            }
+        } while (battle::random::NextOutcome(enumerator));
+
+        EXPECT_EQ(outcomes, 100) << "One Random(100) roll (chance " << int(chance) << "%)";
+        EXPECT_EQ(burns, chance) << "Exactly chance/100 rolls burn";
     }
-
-    // With 1000 trials and 10% probability, expect ~100 burns
-    // Allow reasonable statistical variance: 70-130 (7%-13%)
-    EXPECT_GE(burns, 70) << "Burn rate should be at least 7% over 1000 trials";
-    EXPECT_LE(burns, 130) << "Burn rate should be at most 13% over 1000 trials";
 }
 
 TEST_F(BurnTest, MultipleBurnsInSequence) {
     // Verify that multiple uses can cause burns independently
-    battle::state::Pokemon target1 = CreateBulbasaur();
-    battle::state::Pokemon target2 = CreateBulbasaur();
-    battle::state::Pokemon target3 = CreateBulbasaur();
+    battle::state::BattleState block1 = CreateBattleState(attacker, CreateBulbasaur());
+    battle::state::BattleState block2 = CreateBattleState(attacker, CreateBulbasaur());
+    battle::state::BattleState block3 = CreateBattleState(attacker, CreateBulbasaur());
+    battle::state::Pokemon& target1 = block1.battlers[1];
+    battle::state::Pokemon& target2 = block2.battlers[1];
+    battle::state::Pokemon& target3 = block3.battlers[1];
     domain::MoveData move = CreateEmber();
 
     // Try burning target1
     battle::random::Initialize(42);
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &target1, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block1, &move);
     battle::effects::Effect_BurnHit(ctx1);
 
     // Try burning target2
     battle::random::Initialize(43);
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &target2, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block2, &move);
     battle::effects::Effect_BurnHit(ctx2);
 
     // Try burning target3
     battle::random::Initialize(44);
-    battle::BattleContext ctx3 = CreateBattleContext(&attacker, &target3, &move);
+    battle::BattleContext ctx3 = CreateBattleContext(block3, &move);
     battle::effects::Effect_BurnHit(ctx3);
 
     // At least one should be burned with different seeds
@@ -250,7 +269,7 @@ TEST_F(BurnTest, DamageOccursEvenIfBurnFails) {
     defender.status1 = 1;  // Already has status, so burn will fail
     domain::MoveData move = CreateEmber();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BurnHit(ctx);
 
     // Damage should still be dealt even though burn fails
@@ -25,19 +25,19 @@ class RecoilTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(RecoilTest, DealsDamageToTarget) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     EXPECT_LT(defender.current_hp, original_hp) << "Double-Edge should deal damage to target";
@@ -48,7 +48,7 @@ TEST_F(RecoilTest, AttackerTakesRecoilDamage) {
     uint16_t original_attacker_hp = attacker.current_hp;
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     EXPECT_LT(attacker.current_hp, original_attacker_hp) << "Attacker should take recoil damage";
@@ -58,7 +58,7 @@ TEST_F(RecoilTest, AttackerTakesRecoilDamage) {
 TEST_F(RecoilTest, RecoilIsOneThirdOfDamage) {
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     uint16_t expected_recoil = ctx.damage_dealt / 3;
@@ -73,7 +73,7 @@ TEST_F(RecoilTest, RecoilIsOneThirdOfDamage) {
 TEST_F(RecoilTest, HighPowerMeansHighRecoil) {
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // With 120 power, expect significant damage and recoil
@@ -85,7 +85,7 @@ TEST_F(RecoilTest, NoRecoilOnMiss) {
     uint16_t original_attacker_hp = attacker.current_hp;
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     ctx.move_failed = true;  // Simulate miss
     battle::effects::Effect_RecoilHit(ctx);
 
@@ -98,7 +98,7 @@ TEST_F(RecoilTest, MinimumRecoilIsOne) {
     defender.defense = 50;  // Very high defense for low damage
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // If damage is 1 or 2, damage/3 would be 0, but recoil should be 1
@@ -111,7 +111,7 @@ TEST_F(RecoilTest, RecoilClampsAtZero) {
     attacker.current_hp = 2;  // Low HP
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // HP should not go negative
@@ -122,7 +122,7 @@ TEST_F(RecoilTest, AttackerCanFaintFromRecoil) {
     attacker.current_hp = 3;  // Very low HP
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // Attacker can faint from recoil
@@ -136,7 +136,7 @@ TEST_F(RecoilTest, DefenderCanFaintFromDamage) {
     defender.current_hp = 10;  // Low HP
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // Defender can faint from damage
@@ -151,7 +151,7 @@ TEST_F(RecoilTest, BothCanFaintInSameTurn) {
     defender.current_hp = 10;  // Also low HP
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // Both can faint - defender from damage, attacker from recoil
@@ -169,7 +169,7 @@ TEST_F(RecoilTest, RecoilOnlyIfDamageDealt) {
     defender.defense = 255;  // Maximum defense for minimal damage
     domain::MoveData move = CreateDoubleEdge();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_RecoilHit(ctx);
 
     // With very high defense, damage might be minimum (1), so recoil would be 1
@@ -192,19 +192,20 @@ class DrainTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();  // Bulbasaur for Giga Drain (Grass type)
-        defender = CreateCharmander();
+        // Bulbasaur for Giga Drain (Grass type)
+        block = CreateBattleState(CreateBulbasaur(), CreateCharmander());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(DrainTest, DealsDamageToTarget) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     EXPECT_LT(defender.current_hp, original_hp) << "Giga Drain should deal damage to target";
@@ -216,7 +217,7 @@ TEST_F(DrainTest, AttackerHealsFromDrain) {
     uint16_t original_attacker_hp = attacker.current_hp;
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     EXPECT_GT(attacker.current_hp, original_attacker_hp) << "Attacker should heal from drain";
@@ -228,7 +229,7 @@ TEST_F(DrainTest, DrainIsHalfOfDamage) {
     uint16_t original_attacker_hp = attacker.current_hp;
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     uint16_t drain_received = attacker.current_hp - original_attacker_hp;
@@ -247,7 +248,7 @@ TEST_F(DrainTest, ModeratePowerModerateDrain) {
     attacker.current_hp = 10;  // Damaged attacker
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // With 60 power, expect moderate damage and drain
@@ -260,7 +261,7 @@ TEST_F(DrainTest, NoDrainOnMiss) {
     uint16_t original_attacker_hp = attacker.current_hp;
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     ctx.move_failed = true;  // Simulate miss
     battle::effects::Effect_DrainHit(ctx);
 
@@ -273,7 +274,7 @@ TEST_F(DrainTest, MinimumDrainIsOne) {
     defender.defense = 50;     // Very high defense for low damage
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // If damage is 1, damage/2 would be 0, but drain should be 1
@@ -286,7 +287,7 @@ TEST_F(DrainTest, CannotOverheal) {
     attacker.current_hp = attacker.max_hp - 2;  // Almost full HP
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // HP should not exceed max_hp
@@ -298,7 +299,7 @@ TEST_F(DrainTest, FullHPStillHeals) {
     attacker.current_hp = attacker.max_hp;  // Already full HP
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // Still processes drain, just clamped to max
@@ -310,7 +311,7 @@ TEST_F(DrainTest, DrainClampsAtMaxHP) {
     attacker.current_hp = attacker.max_hp - 3;  // 3 HP below max
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // Even if drain would heal more than 3, HP should clamp at max_hp
@@ -321,7 +322,7 @@ TEST_F(DrainTest, DefenderCanFaintFromDamage) {
     defender.current_hp = 8;  // Low HP
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // Defender can faint from damage
@@ -337,7 +338,7 @@ TEST_F(DrainTest, AttackerStillHealsWhenDefenderFaints) {
     defender.current_hp = 5;  // Very low HP, will likely faint
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // Even if defender faints, attacker should heal
@@ -352,7 +353,7 @@ TEST_F(DrainTest, DrainOnlyIfDamageDealt) {
     defender.defense = 255;  // Maximum defense for minimal damage
     domain::MoveData move = CreateGigaDrain();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_DrainHit(ctx);
 
     // If no damage dealt, no drain
@@ -26,45 +26,46 @@ class LeechSeedTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();   // Grass type
-        defender = CreateCharmander();  // Fire type
+        block = CreateBattleState(CreateBulbasaur(), CreateCharmander());  // Grass vs Fire
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(LeechSeedTest, Application_SeedsTarget) {
     domain::MoveData move = CreateLeechSeed();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_LeechSeed(ctx);
 
     EXPECT_FALSE(ctx.move_failed) << "Leech Seed should succeed on valid target";
     EXPECT_TRUE(defender.is_seeded) << "Defender should be seeded";
-    EXPECT_EQ(defender.seeded_by, &attacker) << "Defender should be seeded by attacker";
+    EXPECT_EQ(defender.seeded_by, ctx.attacker_battler) << "Defender should be seeded by attacker";
 }
 
 TEST_F(LeechSeedTest, Application_FailsIfAlreadySeeded) {
     domain::MoveData move = CreateLeechSeed();
 
     // First application
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_LeechSeed(ctx1);
     EXPECT_FALSE(ctx1.move_failed) << "First Leech Seed should succeed";
     EXPECT_TRUE(defender.is_seeded) << "Defender should be seeded";
 
     // Second application
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_LeechSeed(ctx2);
     EXPECT_TRUE(ctx2.move_failed) << "Second Leech Seed should fail (already seeded)";
 }
 
 TEST_F(LeechSeedTest, Application_FailsOnGrassType) {
-    battle::state::Pokemon grass_defender = CreateBulbasaur();  // Grass/Poison
+    battle::state::Pokemon& grass_defender = defender;
+    grass_defender = CreateBulbasaur();  // Grass/Poison
     domain::MoveData move = CreateLeechSeed();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &grass_defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_LeechSeed(ctx);
 
     EXPECT_TRUE(ctx.move_failed) << "Leech Seed should fail on Grass type";
@@ -30,12 +30,12 @@ class StatModificationTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 // ============================================================================
@@ -44,7 +44,7 @@ class StatModificationTest : public ::testing::Test {
 
 TEST_F(StatModificationTest, AttackDown_LowersAttackStage) {
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -54,7 +54,7 @@ TEST_F(StatModificationTest, AttackDown_LowersAttackStage) {
 TEST_F(StatModificationTest, AttackDown_DoesNotDealDamage) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -64,7 +64,7 @@ TEST_F(StatModificationTest, AttackDown_DoesNotDealDamage) {
 
 TEST_F(StatModificationTest, AttackDown_CanStackMultipleTimes) {
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
     ctx.move_failed = false;
@@ -78,7 +78,7 @@ TEST_F(StatModificationTest, AttackDown_CanStackMultipleTimes) {
 TEST_F(StatModificationTest, AttackDown_MinimumStageMinus6) {
     defender.stat_stages[STAT_ATK] = -6;
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -88,7 +88,7 @@ TEST_F(StatModificationTest, AttackDown_MinimumStageMinus6) {
 TEST_F(StatModificationTest, AttackDown_CanLowerFromPositiveStages) {
     defender.stat_stages[STAT_ATK] = 2;
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -98,7 +98,7 @@ TEST_F(StatModificationTest, AttackDown_CanLowerFromPositiveStages) {
 TEST_F(StatModificationTest, AttackDown_DoesNotModifyAttacker) {
     int8_t original_stage = attacker.stat_stages[STAT_ATK];
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -108,7 +108,7 @@ TEST_F(StatModificationTest, AttackDown_DoesNotModifyAttacker) {
 
 TEST_F(StatModificationTest, AttackDown_DoesNotAffectOtherStats) {
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -121,7 +121,7 @@ TEST_F(StatModificationTest, AttackDown_DoesNotAffectOtherStats) {
 
 TEST_F(StatModificationTest, AttackDown_DoesNotCauseFaint) {
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
 
     battle::effects::Effect_AttackDown(ctx);
 
@@ -131,18 +131,17 @@ TEST_F(StatModificationTest, AttackDown_DoesNotCauseFaint) {
 
 TEST_F(StatModificationTest, AttackDown_IntegrationWithDamage) {
     domain::MoveData tackle = CreateTackle();
-    battle::state::Pokemon defender1 = CreateBulbasaur();
-    battle::state::Pokemon defender2 = CreateBulbasaur();
 
     // Normal damage
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender1, &tackle);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &tackle);
     battle::effects::Effect_Hit(ctx1);
     uint16_t normal_damage = ctx1.damage_dealt;
 
     // Damage with -1 Attack
+    defender = CreateBulbasaur();  // Fresh target
     attacker.stat_stages[STAT_ATK] = -1;
     battle::random::Initialize(42);
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender2, &tackle);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &tackle);
     battle::effects::Effect_Hit(ctx2);
     uint16_t reduced_damage = ctx2.damage_dealt;
 
@@ -160,7 +159,7 @@ TEST_F(StatModificationTest, AttackDown_IntegrationWithDamage) {
 
 TEST_F(StatModificationTest, AttackUp2_RaisesAttackStage) {
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -171,7 +170,7 @@ TEST_F(StatModificationTest, AttackUp2_RaisesAttackStage) {
 TEST_F(StatModificationTest, AttackUp2_DoesNotDealDamage) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -181,7 +180,7 @@ TEST_F(StatModificationTest, AttackUp2_DoesNotDealDamage) {
 
 TEST_F(StatModificationTest, AttackUp2_CanStackToMax) {
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
     ctx.move_failed = false;
@@ -195,7 +194,7 @@ TEST_F(StatModificationTest, AttackUp2_CanStackToMax) {
 TEST_F(StatModificationTest, AttackUp2_MaximumStagePlus6) {
     attacker.stat_stages[STAT_ATK] = +6;
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -205,7 +204,7 @@ TEST_F(StatModificationTest, AttackUp2_MaximumStagePlus6) {
 TEST_F(StatModificationTest, AttackUp2_CapsAtPlus6FromPlus5) {
     attacker.stat_stages[STAT_ATK] = +5;
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -216,7 +215,7 @@ TEST_F(StatModificationTest, AttackUp2_CapsAtPlus6FromPlus5) {
 TEST_F(StatModificationTest, AttackUp2_CanRaiseFromNegativeStages) {
     attacker.stat_stages[STAT_ATK] = -3;
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -226,7 +225,7 @@ TEST_F(StatModificationTest, AttackUp2_CanRaiseFromNegativeStages) {
 TEST_F(StatModificationTest, AttackUp2_DoesNotModifyDefender) {
     int8_t original_stage = defender.stat_stages[STAT_ATK];
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -236,7 +235,7 @@ TEST_F(StatModificationTest, AttackUp2_DoesNotModifyDefender) {
 
 TEST_F(StatModificationTest, AttackUp2_DoesNotAffectOtherStats) {
     domain::MoveData swords_dance = CreateSwordsDance();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &swords_dance);
+    battle::BattleContext ctx = CreateBattleContext(block, &swords_dance);
 
     battle::effects::Effect_AttackUp2(ctx);
 
@@ -249,18 +248,17 @@ TEST_F(StatModificationTest, AttackUp2_DoesNotAffectOtherStats) {
 
 TEST_F(StatModificationTest, AttackUp2_IntegrationDoublesDamage) {
     domain::MoveData tackle = CreateTackle();
-    battle::state::Pokemon defender1 = CreateBulbasaur();
-    battle::state::Pokemon defender2 = CreateBulbasaur();
 
     // Normal damage
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender1, &tackle);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &tackle);
     battle::effects::Effect_Hit(ctx1);
     uint16_t normal_damage = ctx1.damage_dealt;
 
     // Damage with +2 Attack (2x multiplier)
+    defender = CreateBulbasaur();  // Fresh target
     attacker.stat_stages[STAT_ATK] = +2;
     battle::random::Initialize(42);
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender2, &tackle);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &tackle);
     battle::effects::Effect_Hit(ctx2);
     uint16_t boosted_damage = ctx2.damage_dealt;
 
@@ -278,7 +276,7 @@ TEST_F(StatModificationTest, AttackUp2_IntegrationDoublesDamage) {
 
 TEST_F(StatModificationTest, DefenseDown_LowersDefenseStage) {
     domain::MoveData tail_whip = CreateTailWhip();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tail_whip);
+    battle::BattleContext ctx = CreateBattleContext(block, &tail_whip);
 
     battle::effects::Effect_DefenseDown(ctx);
 
@@ -287,7 +285,7 @@ TEST_F(StatModificationTest, DefenseDown_LowersDefenseStage) {
 
 TEST_F(StatModificationTest, DefenseUp2_RaisesDefenseStage) {
     domain::MoveData iron_defense = CreateIronDefense();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &iron_defense);
+    battle::BattleContext ctx = CreateBattleContext(block, &iron_defense);
 
     battle::effects::Effect_DefenseUp2(ctx);
 
@@ -299,14 +297,14 @@ TEST_F(StatModificationTest, Defense_MinMaxBounds) {
     // Test minimum
     defender.stat_stages[STAT_DEF] = -6;
     domain::MoveData tail_whip = CreateTailWhip();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &tail_whip);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &tail_whip);
     battle::effects::Effect_DefenseDown(ctx1);
     EXPECT_EQ(defender.stat_stages[STAT_DEF], -6) << "Defense should not go below -6";
 
     // Test maximum
     attacker.stat_stages[STAT_DEF] = +6;
     domain::MoveData iron_defense = CreateIronDefense();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &iron_defense);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &iron_defense);
     battle::effects::Effect_DefenseUp2(ctx2);
     EXPECT_EQ(attacker.stat_stages[STAT_DEF], +6) << "Defense should not go above +6";
 }
@@ -317,7 +315,7 @@ TEST_F(StatModificationTest, Defense_MinMaxBounds) {
 
 TEST_F(StatModificationTest, SpeedDown_LowersSpeedStage) {
     domain::MoveData string_shot = CreateStringShot();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &string_shot);
+    battle::BattleContext ctx = CreateBattleContext(block, &string_shot);
 
     battle::effects::Effect_SpeedDown(ctx);
 
@@ -326,7 +324,7 @@ TEST_F(StatModificationTest, SpeedDown_LowersSpeedStage) {
 
 TEST_F(StatModificationTest, SpeedUp2_RaisesSpeedStage) {
     domain::MoveData agility = CreateAgility();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &agility);
+    battle::BattleContext ctx = CreateBattleContext(block, &agility);
 
     battle::effects::Effect_SpeedUp2(ctx);
 
@@ -338,14 +336,14 @@ TEST_F(StatModificationTest, Speed_MinMaxBounds) {
     // Test minimum
     defender.stat_stages[STAT_SPEED] = -6;
     domain::MoveData string_shot = CreateStringShot();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &string_shot);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &string_shot);
     battle::effects::Effect_SpeedDown(ctx1);
     EXPECT_EQ(defender.stat_stages[STAT_SPEED], -6) << "Speed should not go below -6";
 
     // Test maximum
     attacker.stat_stages[STAT_SPEED] = +6;
     domain::MoveData agility = CreateAgility();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &agility);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &agility);
     battle::effects::Effect_SpeedUp2(ctx2);
     EXPECT_EQ(attacker.stat_stages[STAT_SPEED], +6) << "Speed should not go above +6";
 }
@@ -356,7 +354,7 @@ TEST_F(StatModificationTest, Speed_MinMaxBounds) {
 
 TEST_F(StatModificationTest, SpecialAttackUp2_RaisesSpecialAttackStage) {
     domain::MoveData tail_glow = CreateTailGlow();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tail_glow);
+    battle::BattleContext ctx = CreateBattleContext(block, &tail_glow);
 
     battle::effects::Effect_SpecialAttackUp2(ctx);
 
@@ -366,7 +364,7 @@ TEST_F(StatModificationTest, SpecialAttackUp2_RaisesSpecialAttackStage) {
 
 TEST_F(StatModificationTest, SpecialAttack_StacksToMax) {
     domain::MoveData tail_glow = CreateTailGlow();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tail_glow);
+    battle::BattleContext ctx = CreateBattleContext(block, &tail_glow);
 
     battle::effects::Effect_SpecialAttackUp2(ctx);
     ctx.move_failed = false;
@@ -384,7 +382,7 @@ TEST_F(StatModificationTest, SpecialAttack_StacksToMax) {
 
 TEST_F(StatModificationTest, SpecialDefenseDown2_LowersSpecialDefenseStage) {
     domain::MoveData fake_tears = CreateFakeTears();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &fake_tears);
+    battle::BattleContext ctx = CreateBattleContext(block, &fake_tears);
 
     battle::effects::Effect_SpecialDefenseDown2(ctx);
 
@@ -394,7 +392,7 @@ TEST_F(StatModificationTest, SpecialDefenseDown2_LowersSpecialDefenseStage) {
 
 TEST_F(StatModificationTest, SpecialDefenseUp2_RaisesSpecialDefenseStage) {
     domain::MoveData amnesia = CreateAmnesia();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &amnesia);
+    battle::BattleContext ctx = CreateBattleContext(block, &amnesia);
 
     battle::effects::Effect_SpecialDefenseUp2(ctx);
 
@@ -406,14 +404,14 @@ TEST_F(StatModificationTest, SpecialDefense_MinMaxBounds) {
     // Test minimum
     defender.stat_stages[STAT_SPDEF] = -6;
     domain::MoveData fake_tears = CreateFakeTears();
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &fake_tears);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &fake_tears);
     battle::effects::Effect_SpecialDefenseDown2(ctx1);
     EXPECT_EQ(defender.stat_stages[STAT_SPDEF], -6) << "Sp. Defense should not go below -6";
 
     // Test maximum
     attacker.stat_stages[STAT_SPDEF] = +6;
     domain::MoveData amnesia = CreateAmnesia();
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &amnesia);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &amnesia);
     battle::effects::Effect_SpecialDefenseUp2(ctx2);
     EXPECT_EQ(attacker.stat_stages[STAT_SPDEF], +6) << "Sp. Defense should not go above +6";
 }
@@ -432,7 +430,7 @@ TEST_F(StatModificationTest, StatModifications_AreIndependent) {
 
     // Apply Growl (should only affect Attack)
     domain::MoveData growl = CreateGrowl();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &growl);
+    battle::BattleContext ctx = CreateBattleContext(block, &growl);
     battle::effects::Effect_AttackDown(ctx);
 
     // Verify only Attack changed on defender, attacker stats unchanged
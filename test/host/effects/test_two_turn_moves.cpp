@@ -27,18 +27,18 @@ class SolarBeamTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();
-        defender = CreateCharmander();
+        block = CreateBattleState(CreateBulbasaur(), CreateCharmander());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(SolarBeamTest, Turn1_StartsCharging) {
     domain::MoveData move = CreateSolarBeam();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx);
 
     EXPECT_TRUE(attacker.is_charging) << "Solar Beam should set is_charging on Turn 1";
@@ -51,7 +51,7 @@ TEST_F(SolarBeamTest, Turn1_NoDamage) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData move = CreateSolarBeam();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx);
 
     EXPECT_EQ(defender.current_hp, original_hp) << "No damage should be dealt on charging turn";
@@ -62,11 +62,11 @@ TEST_F(SolarBeamTest, Turn2_ExecutesAttack) {
     domain::MoveData move = CreateSolarBeam();
 
     // Simulate Turn 1: Start charging
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Simulate Turn 2: Execute attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     EXPECT_FALSE(attacker.is_charging) << "is_charging should be cleared after attack";
@@ -78,12 +78,12 @@ TEST_F(SolarBeamTest, Turn2_ClearsChargingFlag) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
     EXPECT_TRUE(attacker.is_charging) << "Should be charging after Turn 1";
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
     EXPECT_FALSE(attacker.is_charging) << "Should not be charging after Turn 2";
 }
@@ -92,11 +92,11 @@ TEST_F(SolarBeamTest, HighPower) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // Solar Beam has 120 power, should deal significant damage
@@ -108,11 +108,11 @@ TEST_F(SolarBeamTest, AccuracyCheckOnTurn2) {
     move.accuracy = 100;  // Ensure it hits for this test
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Attack (accuracy check happens here)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // With 100% accuracy, should always hit
@@ -124,11 +124,11 @@ TEST_F(SolarBeamTest, MissAfterCharging) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Simulate miss by setting move_failed before damage calc
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     ctx2.move_failed = true;  // Force miss
     battle::effects::Effect_SolarBeam(ctx2);
 
@@ -141,12 +141,12 @@ TEST_F(SolarBeamTest, ProtectionBlocksAttack) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Defender is protected
     defender.is_protected = true;
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // Protection should block the attack
@@ -161,11 +161,11 @@ TEST_F(SolarBeamTest, StatStagesApply) {
     attacker.stat_stages[STAT_SPATK] = +2;
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Attack with boosted Sp. Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // Damage should be higher due to stat boost
@@ -177,11 +177,11 @@ TEST_F(SolarBeamTest, DefenderFaints) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Attack (should KO)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // Defender should faint
@@ -194,11 +194,11 @@ TEST_F(SolarBeamTest, NoSelfDamage) {
     domain::MoveData move = CreateSolarBeam();
 
     // Turn 1: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
 
     // Attacker should not take damage
@@ -209,22 +209,22 @@ TEST_F(SolarBeamTest, MultipleChargesSequential) {
     domain::MoveData move = CreateSolarBeam();
 
     // First Solar Beam: Charge
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx1);
     EXPECT_TRUE(attacker.is_charging) << "First charge should set flag";
 
     // First Solar Beam: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx2);
     EXPECT_FALSE(attacker.is_charging) << "First attack should clear flag";
 
     // Second Solar Beam: Charge again
-    battle::BattleContext ctx3 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx3 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx3);
     EXPECT_TRUE(attacker.is_charging) << "Second charge should set flag again";
 
     // Second Solar Beam: Attack
-    battle::BattleContext ctx4 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx4 = CreateBattleContext(block, &move);
     battle::effects::Effect_SolarBeam(ctx4);
     EXPECT_FALSE(attacker.is_charging) << "Second attack should clear flag";
 }
@@ -240,18 +240,18 @@ class FlyTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreatePidgey();
-        defender = CreateCharmander();
+        block = CreateBattleState(CreatePidgey(), CreateCharmander());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(FlyTest, Turn1_StartsCharging) {
     domain::MoveData move = CreateFly();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx);
 
     EXPECT_TRUE(attacker.is_charging) << "Fly should set is_charging on Turn 1";
@@ -263,7 +263,7 @@ TEST_F(FlyTest, Turn1_NoDamage) {
     uint16_t original_hp = defender.current_hp;
     domain::MoveData move = CreateFly();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx);
 
     EXPECT_EQ(defender.current_hp, original_hp) << "No damage should be dealt on fly-up turn";
@@ -274,11 +274,11 @@ TEST_F(FlyTest, Turn2_ExecutesAttack) {
     domain::MoveData move = CreateFly();
 
     // Simulate Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Simulate Turn 2: Attack from air
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     EXPECT_FALSE(attacker.is_charging) << "is_charging should be cleared after attack";
@@ -290,12 +290,12 @@ TEST_F(FlyTest, Turn2_ClearsChargingFlag) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
     EXPECT_TRUE(attacker.is_charging) << "Should be charging after Turn 1";
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
     EXPECT_FALSE(attacker.is_charging) << "Should not be charging after Turn 2";
 }
@@ -303,7 +303,7 @@ TEST_F(FlyTest, Turn2_ClearsChargingFlag) {
 TEST_F(FlyTest, Turn1_SetsSemiInvulnerableFlag) {
     domain::MoveData move = CreateFly();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx);
 
     EXPECT_TRUE(attacker.is_semi_invulnerable) << "Fly should set is_semi_invulnerable on Turn 1";
@@ -315,12 +315,12 @@ TEST_F(FlyTest, Turn2_ClearsSemiInvulnerableFlag) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up (become semi-invulnerable)
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
     EXPECT_TRUE(attacker.is_semi_invulnerable) << "Should be semi-invulnerable after Turn 1";
 
     // Turn 2: Attack (clear semi-invulnerable)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
     EXPECT_FALSE(attacker.is_semi_invulnerable) << "Should not be semi-invulnerable after Turn 2";
     EXPECT_EQ(attacker.semi_invulnerable_type, battle::state::SemiInvulnerableType::None)
@@ -331,7 +331,7 @@ TEST_F(FlyTest, SemiInvulnerableTypeIsOnAir) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Verify the semi-invulnerable type is specifically OnAir
@@ -348,11 +348,11 @@ TEST_F(FlyTest, AccuracyCheckOnTurn2) {
     move.accuracy = 100;  // Ensure it hits for this test
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Attack (accuracy check happens here)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // With 100% accuracy, should always hit
@@ -364,11 +364,11 @@ TEST_F(FlyTest, MissAfterFlying) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Simulate miss by setting move_failed before damage calc
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     ctx2.move_failed = true;  // Force miss
     battle::effects::Effect_Fly(ctx2);
 
@@ -383,12 +383,12 @@ TEST_F(FlyTest, ProtectionBlocksAttack) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Defender is protected
     defender.is_protected = true;
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // Protection should block the attack
@@ -402,11 +402,11 @@ TEST_F(FlyTest, DecentPower) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // Fly has 70 power, should deal decent damage
@@ -420,11 +420,11 @@ TEST_F(FlyTest, StatStagesApply) {
     attacker.stat_stages[STAT_ATK] = +2;
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Attack with boosted Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // Damage should be higher due to stat boost
@@ -436,11 +436,11 @@ TEST_F(FlyTest, DefenderFaints) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Attack (should KO)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // Defender should faint
@@ -453,11 +453,11 @@ TEST_F(FlyTest, NoSelfDamage) {
     domain::MoveData move = CreateFly();
 
     // Turn 1: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
 
     // Turn 2: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
 
     // Attacker should not take damage
@@ -468,25 +468,25 @@ TEST_F(FlyTest, MultipleUsesSequential) {
     domain::MoveData move = CreateFly();
 
     // First Fly: Fly up
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx1);
     EXPECT_TRUE(attacker.is_charging) << "First fly-up should set flag";
     EXPECT_TRUE(attacker.is_semi_invulnerable) << "First fly-up should be semi-invulnerable";
 
     // First Fly: Attack
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx2);
     EXPECT_FALSE(attacker.is_charging) << "First attack should clear charging flag";
     EXPECT_FALSE(attacker.is_semi_invulnerable) << "First attack should clear semi-invulnerable";
 
     // Second Fly: Fly up again
-    battle::BattleContext ctx3 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx3 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx3);
     EXPECT_TRUE(attacker.is_charging) << "Second fly-up should set flag again";
     EXPECT_TRUE(attacker.is_semi_invulnerable) << "Second fly-up should be semi-invulnerable";
 
     // Second Fly: Attack
-    battle::BattleContext ctx4 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx4 = CreateBattleContext(block, &move);
     battle::effects::Effect_Fly(ctx4);
     EXPECT_FALSE(attacker.is_charging) << "Second attack should clear charging flag";
     EXPECT_FALSE(attacker.is_semi_invulnerable) << "Second attack should clear semi-invulnerable";
@@ -27,18 +27,18 @@ class SubstituteTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();  // 45 HP
-        defender = CreateCharmander();
+        block = CreateBattleState(CreateBulbasaur(), CreateCharmander());  // Attacker has 45 HP
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(SubstituteTest, CreatesSuccessfully) {
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_TRUE(attacker.has_substitute) << "Substitute should be created";
@@ -50,7 +50,7 @@ TEST_F(SubstituteTest, CostsCorrectHP) {
     uint16_t expected_cost = attacker.max_hp / 4;  // 45 / 4 = 11
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_EQ(attacker.current_hp, original_hp - expected_cost)
@@ -62,7 +62,7 @@ TEST_F(SubstituteTest, StoresCorrectSubHP) {
     uint16_t expected_sub_hp = attacker.max_hp / 4;  // 11
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_EQ(attacker.substitute_hp, expected_sub_hp) << "Substitute HP should be 25% of max HP";
@@ -70,11 +70,12 @@ TEST_F(SubstituteTest, StoresCorrectSubHP) {
 }
 
 TEST_F(SubstituteTest, RoundsDownCorrectly) {
-    battle::state::Pokemon pikachu = CreatePikachu();  // 35 HP
+    battle::state::Pokemon& pikachu = attacker;
+    pikachu = CreatePikachu();  // 35 HP
     domain::MoveData move = CreateSubstitute();
     // 35 / 4 = 8.75, rounds down to 8
 
-    battle::BattleContext ctx = CreateBattleContext(&pikachu, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_EQ(pikachu.substitute_hp, 8) << "35 / 4 = 8 (rounded down)";
@@ -83,13 +84,14 @@ TEST_F(SubstituteTest, RoundsDownCorrectly) {
 
 TEST_F(SubstituteTest, MinimumCost1HP) {
     // Create Pokemon with very low max HP (3)
-    battle::state::Pokemon low_hp_mon = CreatePikachu();
+    battle::state::Pokemon& low_hp_mon = attacker;
+    low_hp_mon = CreatePikachu();
     low_hp_mon.max_hp = 3;
     low_hp_mon.current_hp = 3;
     domain::MoveData move = CreateSubstitute();
     // 3 / 4 = 0, but minimum cost is 1
 
-    battle::BattleContext ctx = CreateBattleContext(&low_hp_mon, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_EQ(low_hp_mon.substitute_hp, 1) << "Minimum substitute HP is 1";
@@ -102,7 +104,7 @@ TEST_F(SubstituteTest, FailsInsufficientHP) {
     // Set HP to exactly 11 (at threshold, should fail)
     attacker.current_hp = 11;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_TRUE(ctx.move_failed) << "Should fail with insufficient HP";
@@ -111,12 +113,13 @@ TEST_F(SubstituteTest, FailsInsufficientHP) {
 }
 
 TEST_F(SubstituteTest, FailsExactlyAtThreshold) {
-    battle::state::Pokemon charmander = CreateCharmander();  // 39 HP
-    uint16_t cost = charmander.max_hp / 4;                   // 39 / 4 = 9
-    charmander.current_hp = cost;                            // Exactly at cost
+    battle::state::Pokemon& charmander = attacker;
+    charmander = CreateCharmander();        // 39 HP
+    uint16_t cost = charmander.max_hp / 4;  // 39 / 4 = 9
+    charmander.current_hp = cost;           // Exactly at cost
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&charmander, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_TRUE(ctx.move_failed) << "Should fail when HP equals cost (need > cost)";
@@ -128,12 +131,12 @@ TEST_F(SubstituteTest, FailsAlreadyHasSubstitute) {
     domain::MoveData move = CreateSubstitute();
 
     // First substitute (should succeed)
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx1);
     EXPECT_TRUE(attacker.has_substitute) << "First substitute should succeed";
 
     // Second substitute attempt (should fail)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx2);
     EXPECT_TRUE(ctx2.move_failed) << "Should fail when already has substitute";
 }
@@ -144,7 +147,7 @@ TEST_F(SubstituteTest, SucceedsWithMinimalHP) {
     attacker.current_hp = cost + 1;
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_FALSE(ctx.move_failed) << "Should succeed with HP > cost";
@@ -156,7 +159,7 @@ TEST_F(SubstituteTest, CanRecreateAfterBreak) {
     domain::MoveData move = CreateSubstitute();
 
     // Create first substitute
-    battle::BattleContext ctx1 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx1);
     EXPECT_TRUE(attacker.has_substitute) << "First substitute created";
 
@@ -165,17 +168,18 @@ TEST_F(SubstituteTest, CanRecreateAfterBreak) {
     attacker.substitute_hp = 0;
 
     // Create second substitute (should succeed)
-    battle::BattleContext ctx2 = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx2 = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx2);
     EXPECT_FALSE(ctx2.move_failed) << "Should succeed after substitute breaks";
     EXPECT_TRUE(attacker.has_substitute) << "Second substitute created";
 }
 
 TEST_F(SubstituteTest, OddMaxHP) {
-    battle::state::Pokemon pikachu = CreatePikachu();  // 35 HP
+    battle::state::Pokemon& pikachu = attacker;
+    pikachu = CreatePikachu();  // 35 HP
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&pikachu, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     // 35 / 4 = 8.75 → 8
@@ -186,7 +190,7 @@ TEST_F(SubstituteTest, OddMaxHP) {
 TEST_F(SubstituteTest, SetsAllFlags) {
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_TRUE(attacker.has_substitute) << "has_substitute flag should be set";
@@ -199,7 +203,7 @@ TEST_F(SubstituteTest, NoChangesOnFailure) {
     uint16_t original_hp = attacker.current_hp;
     domain::MoveData move = CreateSubstitute();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Substitute(ctx);
 
     EXPECT_TRUE(ctx.move_failed) << "Move should fail";
@@ -219,12 +223,12 @@ class BatonPassTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();
-        defender = CreateCharmander();
+        block = CreateBattleState(CreateBulbasaur(), CreateCharmander());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 TEST_F(BatonPassTest, TransfersAllStats) {
@@ -239,7 +243,7 @@ TEST_F(BatonPassTest, TransfersAllStats) {
     attacker.stat_stages[STAT_ACC] = +1;
     attacker.stat_stages[STAT_EVASION] = 0;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], +2) << "ATK should be transferred";
@@ -254,7 +258,7 @@ TEST_F(BatonPassTest, TransfersAllStats) {
 TEST_F(BatonPassTest, AlwaysSucceeds) {
     domain::MoveData move = CreateBatonPass();
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_FALSE(ctx.move_failed) << "Baton Pass should always succeed";
@@ -268,7 +272,7 @@ TEST_F(BatonPassTest, TransfersMaxPositiveStages) {
         attacker.stat_stages[i] = +6;
     }
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     for (int i = 0; i < NUM_BATTLE_STATS; i++) {
@@ -281,7 +285,7 @@ TEST_F(BatonPassTest, TransfersSinglePositiveStage) {
 
     attacker.stat_stages[STAT_ATK] = +4;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], +4) << "ATK should be +4";
@@ -296,7 +300,7 @@ TEST_F(BatonPassTest, TransfersNegativeStages) {
     attacker.stat_stages[STAT_SPEED] = -3;
     attacker.stat_stages[STAT_ATK] = -1;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_SPEED], -3) << "SPEED should be -3";
@@ -311,7 +315,7 @@ TEST_F(BatonPassTest, TransfersMaxNegativeStages) {
         attacker.stat_stages[i] = -6;
     }
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     for (int i = 0; i < NUM_BATTLE_STATS; i++) {
@@ -328,7 +332,7 @@ TEST_F(BatonPassTest, OverwritesExistingStages) {
     // Attacker has -1 ATK
     attacker.stat_stages[STAT_ATK] = -1;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], -1) << "ATK should be overwritten to -1 (not added)";
@@ -347,7 +351,7 @@ TEST_F(BatonPassTest, OverwritesAllExistingStages) {
     attacker.stat_stages[STAT_DEF] = 0;
     attacker.stat_stages[STAT_SPEED] = +4;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], -2) << "ATK should be -2 (overwritten)";
@@ -363,7 +367,7 @@ TEST_F(BatonPassTest, TransfersNeutralStages) {
         attacker.stat_stages[i] = 0;
     }
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     for (int i = 0; i < NUM_BATTLE_STATS; i++) {
@@ -383,7 +387,7 @@ TEST_F(BatonPassTest, TransfersMixedStages) {
     attacker.stat_stages[STAT_ACC] = +1;     // Small boost
     attacker.stat_stages[STAT_EVASION] = 0;  // Neutral
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], +6) << "ATK should be +6";
@@ -400,7 +404,7 @@ TEST_F(BatonPassTest, TransfersAttack) {
 
     attacker.stat_stages[STAT_ATK] = +5;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ATK], +5) << "ATK should be +5";
@@ -411,7 +415,7 @@ TEST_F(BatonPassTest, TransfersDefense) {
 
     attacker.stat_stages[STAT_DEF] = +3;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_DEF], +3) << "DEF should be +3";
@@ -422,7 +426,7 @@ TEST_F(BatonPassTest, TransfersSpeed) {
 
     attacker.stat_stages[STAT_SPEED] = +6;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_SPEED], +6) << "SPEED should be +6";
@@ -433,7 +437,7 @@ TEST_F(BatonPassTest, TransfersSpecialAttack) {
 
     attacker.stat_stages[STAT_SPATK] = +4;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_SPATK], +4) << "SPATK should be +4";
@@ -444,7 +448,7 @@ TEST_F(BatonPassTest, TransfersSpecialDefense) {
 
     attacker.stat_stages[STAT_SPDEF] = +2;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_SPDEF], +2) << "SPDEF should be +2";
@@ -455,7 +459,7 @@ TEST_F(BatonPassTest, TransfersAccuracy) {
 
     attacker.stat_stages[STAT_ACC] = -2;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_ACC], -2) << "ACC should be -2";
@@ -466,28 +470,26 @@ TEST_F(BatonPassTest, TransfersEvasion) {
 
     attacker.stat_stages[STAT_EVASION] = +3;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx);
 
     EXPECT_EQ(defender.stat_stages[STAT_EVASION], +3) << "EVASION should be +3";
 }
 
 TEST_F(BatonPassTest, CanChainMultipleTimes) {
-    battle::state::Pokemon pokemon1 = CreateBulbasaur();
-    battle::state::Pokemon pokemon2 = CreateCharmander();
-    battle::state::Pokemon pokemon3 = CreatePikachu();
     domain::MoveData move = CreateBatonPass();
 
     // Pokemon 1 has +3 ATK
-    pokemon1.stat_stages[STAT_ATK] = +3;
+    attacker.stat_stages[STAT_ATK] = +3;
 
     // Pass from Pokemon 1 to Pokemon 2
-    battle::BattleContext ctx1 = CreateBattleContext(&pokemon1, &pokemon2, &move);
+    battle::BattleContext ctx1 = CreateBattleContext(block, &move);
     battle::effects::Effect_BatonPass(ctx1);
-    EXPECT_EQ(pokemon2.stat_stages[STAT_ATK], +3) << "Pokemon 2 should have +3 ATK";
+    EXPECT_EQ(defender.stat_stages[STAT_ATK], +3) << "Pokemon 2 should have +3 ATK";
 
     // Pass from Pokemon 2 to Pokemon 3
-    battle::BattleContext ctx2 = CreateBattleContext(&pokemon2, &pokemon3, &move);
+    battle::state::BattleState next = CreateBattleState(defender, CreatePikachu());
+    battle::BattleContext ctx2 = CreateBattleContext(next, &move);
     battle::effects::Effect_BatonPass(ctx2);
-    EXPECT_EQ(pokemon3.stat_stages[STAT_ATK], +3) << "Pokemon 3 should have +3 ATK";
+    EXPECT_EQ(next.battlers[1].stat_stages[STAT_ATK], +3) << "Pokemon 3 should have +3 ATK";
 }
@@ -25,13 +25,13 @@ class StealthRockTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
-    battle::state::Side side;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
+    battle::state::Side& side = block.sides[1];  // Defender's side
 };
 
 // ============================================================================
@@ -58,13 +58,7 @@ TEST_F(StealthRockTest, SetHazard_SetsStealthRockFlag) {
     // So we'll test via the effect function directly
 
     domain::MoveData sr = {domain::Move::StealthRock, domain::Type::Rock, 0, 0, 20, 0, 0};
-    battle::BattleContext ctx;
-    ctx.attacker = &attacker;
-    ctx.defender = &defender;
-    ctx.attacker_side = &side;  // Dummy
-    ctx.defender_side = &side;  // Target side
-    ctx.move = &sr;
-    ctx.move_failed = false;
+    battle::BattleContext ctx = CreateBattleContext(block, &sr);
 
     battle::effects::Effect_StealthRock(ctx);
 
@@ -77,13 +71,7 @@ TEST_F(StealthRockTest, SetHazard_FailsIfAlreadySet) {
     side.stealth_rock = true;
 
     domain::MoveData sr = {domain::Move::StealthRock, domain::Type::Rock, 0, 0, 20, 0, 0};
-    battle::BattleContext ctx;
-    ctx.attacker = &attacker;
-    ctx.defender = &defender;
-    ctx.attacker_side = &side;
-    ctx.defender_side = &side;
-    ctx.move = &sr;
-    ctx.move_failed = false;
+    battle::BattleContext ctx = CreateBattleContext(block, &sr);
 
     battle::effects::Effect_StealthRock(ctx);
 
@@ -455,13 +443,7 @@ TEST_F(StealthRockTest, Integration_SetAndApply) {
 
     // Step 1: Set Stealth Rock
     domain::MoveData sr = {domain::Move::StealthRock, domain::Type::Rock, 0, 0, 20, 0, 0};
-    battle::BattleContext ctx;
-    ctx.attacker = &attacker;
-    ctx.defender = &defender;
-    ctx.attacker_side = &side;
-    ctx.defender_side = &side;
-    ctx.move = &sr;
-    ctx.move_failed = false;
+    battle::BattleContext ctx = CreateBattleContext(block, &sr);
 
     battle::effects::Effect_StealthRock(ctx);
 
@@ -5,33 +5,32 @@
 
 #include "battle_helpers.hpp"
 
+#include "battle/items.hpp"
+
 namespace test {
 namespace helpers {
 
-battle::BattleContext CreateBattleContext(battle::state::Pokemon* attacker,
-                                          battle::state::Pokemon* defender) {
-    battle::BattleContext ctx;
-    ctx.attacker = attacker;
-    ctx.defender = defender;
-    ctx.move = nullptr;
-    ctx.move_failed = false;
-    ctx.damage_dealt = 0;
-    ctx.critical_hit = false;
-    ctx.effectiveness = 4;  // Default to 1x (neutral, using 4 = 1.0 in fixed-point)
-    ctx.override_power = 0;
-    ctx.override_type = 0;
-    ctx.recoil_dealt = 0;
-    ctx.drain_received = 0;
-    ctx.hit_count = 0;
-    return ctx;
+battle::state::BattleState CreateBattleState(const battle::state::Pokemon& attacker,
+                                             const battle::state::Pokemon& defender) {
+    battle::state::BattleState block = {};
+    block.battlers[0] = attacker;
+    block.battlers[1] = defender;
+    block.field.weather = domain::Weather::None;  // Clear weather
+    block.field.weather_duration = 0;
+    block.sides[0].stealth_rock = false;
+    block.sides[1].stealth_rock = false;
+    block.scheduler.turn = 0;
+    block.scheduler.count = 0;
+    return block;
 }
 
-battle::BattleContext CreateBattleContext(battle::state::Pokemon* attacker,
-                                          battle::state::Pokemon* defender,
-                                          const domain::MoveData* move) {
-    battle::BattleContext ctx = CreateBattleContext(attacker, defender);
-    ctx.move = move;
-    return ctx;
+battle::BattleContext CreateBattleContext(battle::state::BattleState& block,
+                                          const domain::MoveData* move,
+                                          uint8_t attacker_battler) {
+    block.eval = battle::evaluation::Compute(block.battlers[0], block.battlers[1], block.field,
+                                             block.sides[0], block.sides[1]);
+    block.item_hooks = battle::items::BattleHooks(block.battlers[0], block.battlers[1]);
+    return battle::BindContext(block, attacker_battler, move);
 }
 
 // ============================================================================
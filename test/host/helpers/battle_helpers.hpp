@@ -2,13 +2,14 @@
  * @file test/host/helpers/battle_helpers.hpp
  * @brief Battle context and move data creation helpers for GTest unit tests
  *
- * This file provides factory functions for creating battle contexts and move data
+ * This file provides factory functions for creating battle states, contexts and move data
  * to reduce boilerplate in tests.
  */
 
 #pragma once
 
 #include "battle/context.hpp"
+#include "battle/state/battle_state.hpp"
 #include "battle/state/pokemon.hpp"
 #include "domain/move.hpp"
 
@@ -16,31 +17,32 @@ namespace test {
 namespace helpers {
 
 /**
- * @brief Create a battle context for testing
+ * @brief Create a battle state block for testing
  *
- * Creates a BattleContext with all fields initialized to default/safe values.
- * Pointers to attacker and defender are set, but move must be assigned separately.
+ * The attacker is battler 0 and the defender battler 1. Weather is clear, no side
+ * has hazards and the scheduler is empty.
  *
- * @param attacker Pointer to attacking Pokemon
- * @param defender Pointer to defending Pokemon
- * @return Initialized BattleContext ready for testing
+ * @param attacker Attacking Pokemon (copied into the block)
+ * @param defender Defending Pokemon (copied into the block)
+ * @return State block ready for CreateBattleContext()
  */
-battle::BattleContext CreateBattleContext(battle::state::Pokemon* attacker,
-                                          battle::state::Pokemon* defender);
+battle::state::BattleState CreateBattleState(const battle::state::Pokemon& attacker,
+                                             const battle::state::Pokemon& defender);
 
 /**
- * @brief Create a battle context with move data
+ * @brief Create a battle context over a state block
  *
- * Creates a BattleContext with pointers to attacker, defender, and move data.
+ * Re-derives the block's evaluation terms and item hooks first, so tests can edit
+ * the battlers freely between creating the block and the context.
  *
- * @param attacker Pointer to attacking Pokemon
- * @param defender Pointer to defending Pokemon
- * @param move Pointer to move data
+ * @param block State block the move runs in
+ * @param move Pointer to move data (nullptr for no move)
+ * @param attacker_battler Acting battler (0 by default); the other one defends
  * @return Initialized BattleContext ready for testing
  */
-battle::BattleContext CreateBattleContext(battle::state::Pokemon* attacker,
-                                          battle::state::Pokemon* defender,
-                                          const domain::MoveData* move);
+battle::BattleContext CreateBattleContext(battle::state::BattleState& block,
+                                          const domain::MoveData* move = nullptr,
+                                          uint8_t attacker_battler = 0);
 
 // ============================================================================
 // MOVE DATA FACTORIES
@@ -26,6 +26,7 @@ battle::state::Pokemon CreateTestPokemon(domain::Species species, domain::Type t
     p.current_hp = hp;
     p.is_fainted = false;
     p.status1 = 0;  // No status
+    p.toxic_counter = 0;
 
     // Initialize stat stages to 0 (neutral)
     for (int i = 0; i < 8; i++) {
@@ -50,7 +51,11 @@ battle::state::Pokemon CreateTestPokemon(domain::Species species, domain::Type t
 
     // Initialize Leech Seed state
     p.is_seeded = false;
-    p.seeded_by = nullptr;
+    p.seeded_by = 0;
+
+    // Initialize held item state
+    p.item = domain::Item::None;
+    p.choiced_move = domain::Move::None;
 
     return p;
 }
@@ -0,0 +1,203 @@
+/**
+ * @file test/host/items/test_held_items.cpp
+ * @brief Tests for held items and the battle's item hook mask
+ *
+ * Based on Gen III hold effects (pokeemerald):
+ * - Leftovers: restores 1/16 max HP at the end of each turn
+ * - Choice Band: Attack 1.5x, locked into the first move used
+ * - Quick Claw: 20% chance to move first within a priority bracket
+ * - Macho Brace: Speed halved
+ * - Big Root (Gen IV): drain healing 1.3x
+ *
+ * The hook mask is the union of the held items' hooks; battles without
+ * items never touch the item paths.
+ */
+
+#include <gtest/gtest.h>
+
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+BattleAction PlayerUses(Move move) {
+    return BattleAction{ActionType::MOVE, Player::PLAYER, 0, move};
+}
+
+BattleAction EnemyUses(Move move) {
+    return BattleAction{ActionType::MOVE, Player::ENEMY, 0, move};
+}
+
+/**
+ * @brief HP the enemy loses to one player Tackle (enemy uses Growl)
+ */
+uint16_t TackleDamage(Item player_item) {
+    state::Pokemon player = CreatePokemonWithStats(80, 50, 100, 200);
+    player.item = player_item;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 60, 50, 200));
+    engine.ExecuteTurn(PlayerUses(Move::Tackle), EnemyUses(Move::Growl));
+    return 200 - engine.GetEnemy().current_hp;
+}
+
+/**
+ * @brief True if the player moves first: both Tackle and the first hit faints its target
+ */
+bool PlayerMovesFirst(const state::Pokemon& player, const state::Pokemon& enemy) {
+    BattleEngine engine;
+    engine.InitBattle(player, enemy);
+    engine.ExecuteTurn(PlayerUses(Move::Tackle), EnemyUses(Move::Tackle));
+    return engine.GetEnemy().is_fainted && !engine.GetPlayer().is_fainted;
+}
+
+}  // namespace
+
+// ============================================================================
+// Hook mask
+// ============================================================================
+
+TEST(HeldItemTest, HookMaskIsUnionOfHeldItems) {
+    BattleEngine engine;
+    engine.InitBattle(CreateCharmander(), CreateBulbasaur());
+    EXPECT_EQ(engine.GetState().item_hooks, 0) << "No items: every item path is skipped";
+
+    state::Pokemon player = CreateCharmander();
+    state::Pokemon enemy = CreateBulbasaur();
+    player.item = Item::Leftovers;
+    enemy.item = Item::ChoiceBand;
+    engine.InitBattle(player, enemy);
+    EXPECT_EQ(engine.GetState().item_hooks,
+              items::HOOK_END_OF_TURN | items::HOOK_DAMAGE | items::HOOK_MOVE_LOCK);
+}
+
+TEST(HeldItemTest, DecodedStateRebuildsHookMask) {
+    state::Pokemon player = CreateCharmander();
+    player.item = Item::QuickClaw;
+    BattleEngine engine;
+    engine.InitBattle(player, CreateBulbasaur());
+
+    uint8_t encoded[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(encoded);
+    BattleEngine decoded;
+    ASSERT_TRUE(decoded.DecodeState(encoded, size));
+    EXPECT_EQ(decoded.GetPlayer().item, Item::QuickClaw);
+    EXPECT_EQ(decoded.GetState().item_hooks, items::HOOK_SPEED);
+}
+
+// ============================================================================
+// Leftovers
+// ============================================================================
+
+TEST(HeldItemTest, LeftoversHealsSixteenthAtEndOfTurn) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 50, 160);
+    player.item = Item::Leftovers;
+    player.current_hp = 100;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 160));
+
+    engine.ExecuteTurn(PlayerUses(Move::Growl), EnemyUses(Move::Growl));
+    EXPECT_EQ(engine.GetPlayer().current_hp, 110);
+}
+
+TEST(HeldItemTest, LeftoversDoesNotOverheal) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 50, 160);
+    player.item = Item::Leftovers;
+    player.current_hp = 155;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 160));
+
+    engine.ExecuteTurn(PlayerUses(Move::Growl), EnemyUses(Move::Growl));
+    EXPECT_EQ(engine.GetPlayer().current_hp, 160);
+    EXPECT_TRUE(evaluation::Equal(engine.GetEvaluation(), engine.RecomputeEvaluation()));
+}
+
+// ============================================================================
+// Choice Band
+// ============================================================================
+
+TEST(HeldItemTest, ChoiceBandBoostsDamage) {
+    uint16_t plain = TackleDamage(Item::None);
+    uint16_t banded = TackleDamage(Item::ChoiceBand);
+    EXPECT_GT(banded, plain);
+    EXPECT_EQ(TackleDamage(Item::Leftovers), plain) << "Other items leave damage alone";
+}
+
+TEST(HeldItemTest, ChoiceBandLocksFirstMove) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 100, 200);
+    player.item = Item::ChoiceBand;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 200));
+
+    engine.ExecuteTurn(PlayerUses(Move::Growl), EnemyUses(Move::Growl));
+    EXPECT_EQ(engine.GetPlayer().choiced_move, Move::Growl);
+
+    // Tackle is chosen, but the lock makes it Growl again
+    engine.ExecuteTurn(PlayerUses(Move::Tackle), EnemyUses(Move::Growl));
+    EXPECT_EQ(engine.GetEnemy().current_hp, 200);
+    EXPECT_EQ(engine.GetEnemy().stat_stages[STAT_ATK], -2);
+}
+
+// ============================================================================
+// Speed items
+// ============================================================================
+
+TEST(HeldItemTest, MachoBraceHalvesSpeed) {
+    state::Pokemon player = CreatePokemonWithStats(200, 10, 100, 20);
+    state::Pokemon enemy = CreatePokemonWithStats(200, 10, 60, 20);
+    EXPECT_TRUE(PlayerMovesFirst(player, enemy));
+
+    player.item = Item::MachoBrace;
+    EXPECT_FALSE(PlayerMovesFirst(player, enemy)) << "100 / 2 = 50 is slower than 60";
+}
+
+TEST(HeldItemTest, QuickClawMovesSlowerHolderFirstOnActivation) {
+    state::Pokemon player = CreatePokemonWithStats(200, 10, 20, 20);
+    player.item = Item::QuickClaw;
+    state::Pokemon enemy = CreatePokemonWithStats(200, 10, 90, 20);
+
+    // First draw of the turn is the Quick Claw roll (20 in 100)
+    const uint16_t activates[] = {19};
+    random::BeginForcedDraws(activates, 1);
+    EXPECT_TRUE(PlayerMovesFirst(player, enemy));
+    random::DrawRecord records[random::MAX_RECORDED_DRAWS];
+    random::EndForcedDraws(records);
+    EXPECT_EQ(records[0].bound, 100);
+
+    const uint16_t fails[] = {20};
+    random::BeginForcedDraws(fails, 1);
+    EXPECT_FALSE(PlayerMovesFirst(player, enemy));
+    random::EndForcedDraws(records);
+}
+
+TEST(HeldItemTest, NoItemsMeansNoExtraDraws) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 20, 200);
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 90, 200);
+
+    random::BeginForcedDraws(nullptr, 0);
+    BattleEngine engine;
+    engine.InitBattle(player, enemy);
+    engine.ExecuteTurn(PlayerUses(Move::Growl), EnemyUses(Move::Growl));
+    random::DrawRecord records[random::MAX_RECORDED_DRAWS];
+    EXPECT_EQ(random::EndForcedDraws(records), 0) << "Turn order needed no roll";
+}
+
+// ============================================================================
+// Big Root
+// ============================================================================
+
+TEST(HeldItemTest, BigRootBoostsDrain) {
+    uint16_t healed[2];
+    for (int rooted = 0; rooted < 2; rooted++) {
+        state::Pokemon player = CreatePokemonWithStats(90, 50, 100, 300);
+        player.current_hp = 100;
+        player.item = rooted ? Item::BigRoot : Item::None;
+        BattleEngine engine;
+        engine.InitBattle(player, CreatePokemonWithStats(50, 40, 50, 300));
+        engine.ExecuteTurn(PlayerUses(Move::GigaDrain), EnemyUses(Move::Growl));
+        healed[rooted] = engine.GetPlayer().current_hp - 100;
+    }
+    EXPECT_GT(healed[0], 0);
+    EXPECT_EQ(healed[1], healed[0] * 130 / 100);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file test/host/kernels/test_kernel_dispatch.cpp
+ * @brief Tests for the batched kernels and their runtime dispatch
+ *
+ * This file tests:
+ * - The active table is the widest variant this CPU supports
+ * - Every supported variant matches the scalar kernels exactly, including
+ *   tails shorter than a vector
+ * - The active kernels match the engine (damage formula, evaluation score)
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "battle/commands/damage.hpp"
+#include "kernels/dispatch.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using kernels::Isa;
+
+namespace {
+
+const size_t SIZES[] = {0, 1, 7, 33, 100};
+
+/**
+ * @brief Deterministic input generator (SplitMix64)
+ */
+struct Inputs {
+    uint64_t state = 0x1234;
+
+    uint64_t Next() {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+};
+
+std::vector<Isa> SimdVariants() {
+    std::vector<Isa> variants;
+    for (uint8_t i = 1; i < kernels::NUM_ISAS; i++) {
+        Isa isa = static_cast<Isa>(i);
+        if (kernels::Table(isa) != nullptr && kernels::Supported(isa)) {
+            variants.push_back(isa);
+        }
+    }
+    return variants;
+}
+
+}  // namespace
+
+TEST(KernelDispatchTest, ActiveIsWidestSupported) {
+    const kernels::KernelTable& active = kernels::Active();
+    EXPECT_TRUE(kernels::Supported(active.isa));
+    EXPECT_EQ(&kernels::Active(), &active) << "Selected once";
+    if (getenv("BATTLE_KERNELS") == nullptr) {
+        for (uint8_t i = static_cast<uint8_t>(active.isa) + 1; i < kernels::NUM_ISAS; i++) {
+            EXPECT_FALSE(kernels::Supported(static_cast<Isa>(i))) << kernels::IsaName(active.isa);
+        }
+    }
+    EXPECT_TRUE(kernels::Supported(Isa::Scalar));
+}
+
+TEST(KernelDispatchTest, DamageVariantsMatchScalar) {
+    const kernels::KernelTable& scalar = *kernels::Table(Isa::Scalar);
+    for (Isa isa : SimdVariants()) {
+        for (size_t n : SIZES) {
+            Inputs inputs;
+            std::vector<uint8_t> power(n), modifier(n);
+            std::vector<uint16_t> attack(n), defense(n);
+            for (size_t i = 0; i < n; i++) {
+                power[i] = static_cast<uint8_t>(inputs.Next());
+                modifier[i] = static_cast<uint8_t>(inputs.Next() % 16);
+                attack[i] = static_cast<uint16_t>(inputs.Next());
+                // Small defenses push damage past 16 bits (truncated like damage_dealt)
+                uint64_t r = inputs.Next();
+                defense[i] = static_cast<uint16_t>(r % 4 == 0 ? 1 + i % 7 : 1 + (r >> 8) % 65535);
+            }
+            kernels::DamageInputs in{power.data(), attack.data(), defense.data(), modifier.data()};
+            std::vector<uint16_t> expected(n), actual(n);
+            scalar.base_damage(in, expected.data(), n);
+            kernels::Table(isa)->base_damage(in, actual.data(), n);
+            EXPECT_EQ(actual, expected) << kernels::IsaName(isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(KernelDispatchTest, ScoreVariantsMatchScalar) {
+    const kernels::KernelTable& scalar = *kernels::Table(Isa::Scalar);
+    for (Isa isa : SimdVariants()) {
+        for (size_t n : SIZES) {
+            Inputs inputs;
+            std::vector<evaluation::Terms> terms(n);
+            for (size_t i = 0; i < n; i++) {
+                // Full int16 range: the sum wraps like the scalar conversion
+                uint64_t r = inputs.Next();
+                terms[i] = evaluation::Terms{static_cast<int16_t>(r), static_cast<int16_t>(r >> 16),
+                                             static_cast<int16_t>(r >> 32),
+                                             static_cast<int16_t>(r >> 48)};
+            }
+            std::vector<int16_t> expected(n), actual(n);
+            scalar.score(terms.data(), expected.data(), n);
+            kernels::Table(isa)->score(terms.data(), actual.data(), n);
+            EXPECT_EQ(actual, expected) << kernels::IsaName(isa) << " n=" << n;
+        }
+    }
+}
+
+TEST(KernelDispatchTest, ActiveKernelsMatchEngine) {
+    const kernels::KernelTable& active = kernels::Active();
+
+    // Damage matches CalculateDamage on a real context
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(123, 50, 50),
+                                                 CreatePokemonWithStats(50, 77, 50));
+    domain::MoveData tackle = CreateTackle();
+    BattleContext ctx = CreateBattleContext(block, &tackle);
+    commands::CalculateDamage(ctx);
+
+    uint8_t power = tackle.power;
+    uint16_t attack = 123;
+    uint16_t defense = 77;
+    uint8_t neutral = weather::MODIFIER_NEUTRAL;
+    uint16_t damage = 0;
+    active.base_damage(kernels::DamageInputs{&power, &attack, &defense, &neutral}, &damage, 1);
+    EXPECT_EQ(damage, ctx.damage_dealt);
+
+    // Score matches the engine's view of the state block
+    int16_t score = 0;
+    active.score(&block.eval, &score, 1);
+    EXPECT_EQ(score, evaluation::Score(block.eval));
+}
@@ -0,0 +1,182 @@
+/**
+ * @file test/host/mechanics/test_battle_state.cpp
+ * @brief Tests for the contiguous battle state block and context binding
+ *
+ * This file tests:
+ * - BindContext derives the attacker/defender/side views from battler indices
+ * - Move data is looked up by id
+ * - The state block is relocatable (byte copies behave like the original)
+ * - Encoded states decode back to equivalent engines
+ * - Decoding rejects out-of-range indices and enum values
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <type_traits>
+
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+static_assert(std::is_trivially_copyable<state::BattleState>::value,
+              "BattleState must stay plain data so it can be relocated by byte copy");
+
+namespace {
+
+state::BattleState CreateState() {
+    state::BattleState block;
+    block.battlers[0] = CreateCharmander();
+    block.battlers[1] = CreateBulbasaur();
+    block.sides[0].stealth_rock = false;
+    block.sides[1].stealth_rock = true;
+    block.field.weather = Weather::None;
+    block.field.weather_duration = 0;
+    block.scheduler.turn = 0;
+    block.scheduler.count = 0;
+    block.eval = evaluation::Compute(block.battlers[0], block.battlers[1], block.field,
+                                     block.sides[0], block.sides[1]);
+    return block;
+}
+
+}  // namespace
+
+TEST(BattleStateTest, BindContextUsesBattlerIndices) {
+    state::BattleState block = CreateState();
+    BattleContext ctx = BindContext(block, 1, Move::Ember);
+
+    EXPECT_EQ(&ctx.state, &block);
+    EXPECT_EQ(&ctx.Attacker(), &block.battlers[1]);
+    EXPECT_EQ(&ctx.Defender(), &block.battlers[0]);
+    EXPECT_EQ(&ctx.AttackerSide(), &block.sides[1]);
+    EXPECT_EQ(&ctx.DefenderSide(), &block.sides[0]);
+    EXPECT_EQ(ctx.attacker_battler, 1);
+    EXPECT_EQ(ctx.defender_battler, 0);
+    ASSERT_NE(ctx.move, nullptr);
+    EXPECT_EQ(ctx.move->move, Move::Ember);
+    EXPECT_EQ(ctx.move->effect_chance, 10);
+    EXPECT_FALSE(ctx.move_failed);
+}
+
+TEST(BattleStateTest, BoundContextDrivesEffects) {
+    state::BattleState block = CreateState();
+    BattleContext ctx = BindContext(block, 0, Move::Growl);
+    effects::Effect_AttackDown(ctx);
+
+    EXPECT_EQ(block.battlers[1].stat_stages[STAT_ATK], -1);
+    EXPECT_EQ(block.eval.stages, 1) << "Bound contexts keep the running evaluation in step";
+}
+
+TEST(BattleStateTest, EngineIsRelocatableByByteCopy) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    BattleAction leech_seed{ActionType::MOVE, Player::PLAYER, 0, Move::LeechSeed};
+    BattleAction tackle{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle};
+    engine.ExecuteTurn(leech_seed, tackle);
+
+    // Move the whole engine to different storage with a raw byte copy
+    alignas(BattleEngine) unsigned char storage[sizeof(BattleEngine)];
+    memcpy(storage, &engine, sizeof(BattleEngine));
+    BattleEngine* moved = reinterpret_cast<BattleEngine*>(storage);
+
+    random::Initialize(7);
+    engine.ExecuteTurn(leech_seed, tackle);
+    random::Initialize(7);
+    moved->ExecuteTurn(leech_seed, tackle);
+
+    EXPECT_EQ(moved->HashState(), engine.HashState());
+}
+
+TEST(BattleStateTest, EncodedStateDecodesToEquivalentEngine) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 300),
+                      CreatePokemonWithStats(50, 50, 50, 300));
+    BattleAction future_sight{ActionType::MOVE, Player::PLAYER, 0, Move::FutureSight};
+    BattleAction sandstorm{ActionType::MOVE, Player::ENEMY, 0, Move::Sandstorm};
+    engine.ExecuteTurn(future_sight, sandstorm);
+    ASSERT_GT(engine.GetState().scheduler.count, 0) << "Scheduler events are round-tripped";
+
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+    BattleEngine restored;
+    ASSERT_TRUE(restored.DecodeState(buffer, size));
+    EXPECT_EQ(restored.HashState(), engine.HashState());
+    EXPECT_TRUE(evaluation::Equal(restored.GetEvaluation(), engine.GetEvaluation()));
+
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    random::Initialize(7);
+    engine.ExecuteTurn(tackle, sandstorm);
+    random::Initialize(7);
+    restored.ExecuteTurn(tackle, sandstorm);
+    EXPECT_EQ(restored.HashState(), engine.HashState());
+}
+
+TEST(BattleStateTest, TruncatedEncodingIsRejected) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 50), CreatePokemonWithStats(50, 50, 50));
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+
+    BattleEngine other;
+    other.InitBattle(CreatePokemonWithStats(60, 60, 60), CreatePokemonWithStats(60, 60, 60));
+    uint64_t before = other.HashState();
+    EXPECT_FALSE(other.DecodeState(buffer, size - 1));
+    EXPECT_FALSE(other.DecodeState(buffer, 3));
+    EXPECT_EQ(other.HashState(), before) << "A rejected buffer leaves the state unchanged";
+}
+
+TEST(BattleStateTest, OutOfRangeValuesAreRejected) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 300),
+                      CreatePokemonWithStats(50, 50, 50, 300));
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::FutureSight},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Growl});
+    ASSERT_EQ(engine.GetState().scheduler.count, 1);
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+
+    // Byte offsets follow EncodePokemon / EncodeField / EncodeScheduler
+    const size_t enemy = state::ENCODED_POKEMON_SIZE;
+    const size_t field = 2 * state::ENCODED_POKEMON_SIZE;
+    const size_t event = state::ENCODED_FIXED_SIZE + state::ENCODED_SCHEDULER_HEADER_SIZE;
+    struct Corruption {
+        size_t offset;
+        uint8_t value;
+        const char* what;
+    };
+    const Corruption corruptions[] = {
+        {35, state::NUM_BATTLERS, "seeded_by"},
+        {event + 2, state::NUM_BATTLERS, "scheduled event battler"},
+        {event + 3, 0, "scheduled effect None"},
+        {event + 3, 9, "scheduled effect"},
+        {field, NUM_WEATHERS, "weather"},
+        {enemy + 15, Status1::BURN | Status1::PARALYSIS, "status1 with two statuses"},
+        {enemy + 15, Status1::POISON | 2, "status1 poison and sleep"},
+        {enemy + 16, 16, "toxic counter"},
+        {enemy + 18, 7, "stat stage"},
+        {28, NUM_MOVES, "charging move"},
+        {enemy + 37, 200, "choiced move"},
+        {36, NUM_ITEMS, "item"},
+        {2, NUM_TYPES, "type1"},
+        {enemy + 30, 4, "semi-invulnerable type"},
+    };
+
+    BattleEngine restored;
+    ASSERT_TRUE(restored.DecodeState(buffer, size));
+    uint64_t before = restored.HashState();
+    for (const Corruption& c : corruptions) {
+        uint8_t corrupted[MAX_ENCODED_STATE_SIZE];
+        memcpy(corrupted, buffer, size);
+        corrupted[c.offset] = c.value;
+        EXPECT_FALSE(restored.DecodeState(corrupted, size)) << c.what;
+        EXPECT_EQ(restored.HashState(), before) << c.what;
+    }
+
+    buffer[enemy + 15] = Status1::SLEEP;  // Seven sleep turns are in range
+    EXPECT_TRUE(restored.DecodeState(buffer, size));
+}
@@ -0,0 +1,97 @@
+/**
+ * @file test/host/mechanics/test_chance.cpp
+ * @brief Tests for chance events as precomputed threshold tables
+ *
+ * This file tests:
+ * - Tables are well formed and their outcome weights give the documented probabilities
+ * - Every event is exactly one draw of its table's denominator
+ * - Enumerating an event's draw visits each outcome with its exact weight
+ * - Protect tables cover any consecutive-use count
+ */
+
+#include <gtest/gtest.h>
+
+#include "battle/chance.hpp"
+
+using namespace battle;
+
+namespace {
+
+void ExpectWellFormed(const chance::Table& table) {
+    ASSERT_GE(table.outcome_count, 1);
+    ASSERT_LE(table.outcome_count, chance::MAX_OUTCOMES);
+    EXPECT_EQ(table.threshold[table.outcome_count - 1], table.denominator);
+    for (uint8_t i = 1; i < table.outcome_count; i++) {
+        EXPECT_LE(table.threshold[i - 1], table.threshold[i]) << "Thresholds are cumulative";
+    }
+}
+
+}  // namespace
+
+TEST(ChanceTest, EngineTablesAreWellFormed) {
+    ExpectWellFormed(chance::FULL_PARALYSIS);
+    ExpectWellFormed(chance::SPEED_TIE);
+    ExpectWellFormed(chance::MULTI_HIT);
+    for (const chance::Table& table : chance::PROTECT) {
+        ExpectWellFormed(table);
+    }
+    ExpectWellFormed(chance::Percent(0));
+    ExpectWellFormed(chance::Percent(100));
+}
+
+TEST(ChanceTest, WeightsGiveExactProbabilities) {
+    EXPECT_EQ(chance::Weight(chance::FULL_PARALYSIS, 0), 1);
+    EXPECT_EQ(chance::FULL_PARALYSIS.denominator, 4);
+    EXPECT_EQ(chance::Weight(chance::SPEED_TIE, 0), 1);
+    EXPECT_EQ(chance::SPEED_TIE.denominator, 2);
+
+    // 2, 3, 4, 5 hits: 3/8, 3/8, 1/8, 1/8
+    EXPECT_EQ(chance::Weight(chance::MULTI_HIT, 0), 3);
+    EXPECT_EQ(chance::Weight(chance::MULTI_HIT, 1), 3);
+    EXPECT_EQ(chance::Weight(chance::MULTI_HIT, 2), 1);
+    EXPECT_EQ(chance::Weight(chance::MULTI_HIT, 3), 1);
+}
+
+TEST(ChanceTest, EachEventIsOneDraw) {
+    random::Script script;
+    random::BeginScript(script, nullptr, 0);
+    chance::Roll(chance::MULTI_HIT);
+    chance::Occurs(chance::Percent(30));
+    chance::Occurs(chance::ProtectChance(3));
+    ASSERT_EQ(random::EndScript(script), 3);
+    EXPECT_EQ(script.records[0].bound, 8);
+    EXPECT_EQ(script.records[1].bound, 100);
+    EXPECT_EQ(script.records[2].bound, 100);
+}
+
+TEST(ChanceTest, EnumerationMatchesWeights) {
+    uint16_t seen[chance::MAX_OUTCOMES] = {0};
+    random::Enumerator enumerator;
+    random::BeginEnumeration(enumerator);
+    do {
+        seen[chance::Roll(chance::MULTI_HIT)]++;
+    } while (random::NextOutcome(enumerator));
+
+    for (uint8_t i = 0; i < chance::MULTI_HIT.outcome_count; i++) {
+        EXPECT_EQ(seen[i], chance::Weight(chance::MULTI_HIT, i)) << "outcome " << int(i);
+    }
+}
+
+TEST(ChanceTest, PercentEdgesAreCertain) {
+    random::Enumerator enumerator;
+    random::BeginEnumeration(enumerator);
+    do {
+        EXPECT_TRUE(chance::Occurs(chance::Percent(100)));
+        EXPECT_FALSE(chance::Occurs(chance::Percent(0)));
+    } while (random::NextOutcome(enumerator));
+}
+
+TEST(ChanceTest, ProtectChanceHalvesAndClamps) {
+    EXPECT_EQ(chance::Weight(chance::ProtectChance(0), 0), 100);
+    EXPECT_EQ(chance::Weight(chance::ProtectChance(1), 0), 50);
+    EXPECT_EQ(chance::Weight(chance::ProtectChance(2), 0), 25);
+    EXPECT_EQ(chance::Weight(chance::ProtectChance(3), 0), 12);
+    EXPECT_EQ(chance::Weight(chance::ProtectChance(7), 0), 0);
+    EXPECT_EQ(&chance::ProtectChance(8), &chance::ProtectChance(7)) << "Past the table: last entry";
+    EXPECT_EQ(&chance::ProtectChance(255), &chance::ProtectChance(7));
+}
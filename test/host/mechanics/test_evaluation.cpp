@@ -0,0 +1,184 @@
+/**
+ * @file test/host/mechanics/test_evaluation.cpp
+ * @brief Tests for the incrementally maintained evaluation terms
+ *
+ * This file tests:
+ * - Commands update the state block's terms (material, stages, status, hazards)
+ * - The Engine's running terms match a from-scratch recompute across whole battles
+ * - Snapshot/restore by copying the Engine carries the terms along
+ */
+
+#include <gtest/gtest.h>
+
+#include "battle/engine.hpp"
+#include "battle/evaluation.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+evaluation::Terms ZeroTerms() {
+    evaluation::Terms terms;
+    terms.material = 0;
+    terms.stages = 0;
+    terms.status = 0;
+    terms.hazards = 0;
+    return terms;
+}
+
+void ExpectMatchesRecompute(const BattleEngine& engine) {
+    evaluation::Terms running = engine.GetEvaluation();
+    evaluation::Terms fresh = engine.RecomputeEvaluation();
+    EXPECT_EQ(running.material, fresh.material);
+    EXPECT_EQ(running.stages, fresh.stages);
+    EXPECT_EQ(running.status, fresh.status);
+    EXPECT_EQ(running.hazards, fresh.hazards);
+}
+
+}  // namespace
+
+// ============================================================================
+// Command-level Tests
+// ============================================================================
+
+TEST(EvaluationTest, ApplyDamageUpdatesMaterial) {
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(50, 50, 50, 64),
+                                                 CreatePokemonWithStats(50, 50, 50, 64));
+    state::Pokemon& defender = block.battlers[1];
+    MoveData tackle = CreateTackle();
+    BattleContext ctx = CreateBattleContext(block, &tackle);
+    evaluation::Terms& terms = block.eval;
+    terms = ZeroTerms();
+    ctx.damage_dealt = 16;
+    commands::ApplyDamage(ctx);
+
+    // Defender (enemy) lost 16/64 of its HP: player material advantage +16
+    EXPECT_EQ(defender.current_hp, 48);
+    EXPECT_EQ(terms.material, 16);
+}
+
+TEST(EvaluationTest, ModifyStatStageUpdatesStagesWithSign) {
+    state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+    MoveData growl = CreateGrowl();
+    BattleContext ctx = CreateBattleContext(block, &growl);
+    evaluation::Terms& terms = block.eval;
+    terms = ZeroTerms();
+    commands::ModifyStatStage(ctx, STAT_ATK, -1);        // Enemy -1
+    commands::ModifyStatStage(ctx, STAT_ATK, +2, true);  // Player +2
+
+    EXPECT_EQ(terms.stages, 3);
+}
+
+TEST(EvaluationTest, ClampedStageChangeLeavesTermUnchanged) {
+    state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+    state::Pokemon& attacker = block.battlers[0];
+    attacker.stat_stages[STAT_ATK] = 5;
+    MoveData swords_dance = CreateSwordsDance();
+    BattleContext ctx = CreateBattleContext(block, &swords_dance);
+    evaluation::Terms& terms = block.eval;
+    terms = ZeroTerms();
+    commands::ModifyStatStage(ctx, STAT_ATK, +2, true);  // Only +1 applies (clamped at +6)
+
+    EXPECT_EQ(terms.stages, 1);
+}
+
+TEST(EvaluationTest, StatusUpdatesPenalty) {
+    state::BattleState block = CreateBattleState(CreateBulbasaur(), CreateCharmander());
+    state::Pokemon& defender = block.battlers[1];
+    MoveData thunder_wave = CreateThunderWave();
+    BattleContext ctx = CreateBattleContext(block, &thunder_wave);
+    evaluation::Terms& terms = block.eval;
+    terms = ZeroTerms();
+    commands::TryApplyParalysis(ctx, 100);
+
+    // Enemy picked up a penalty: status difference goes negative (good for player)
+    EXPECT_EQ(terms.status, -evaluation::StatusTerm(defender));
+    EXPECT_LT(terms.status, 0);
+}
+
+TEST(EvaluationTest, StateBlockTermsMatchRecompute) {
+    state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+    state::Pokemon& defender = block.battlers[1];
+    MoveData tackle = CreateTackle();
+
+    BattleContext ctx = CreateBattleContext(block, &tackle);
+    effects::Effect_Hit(ctx);
+
+    EXPECT_LT(defender.current_hp, defender.max_hp);
+    EXPECT_TRUE(evaluation::Equal(
+        block.eval, evaluation::Compute(block.battlers[0], block.battlers[1], block.field,
+                                        block.sides[0], block.sides[1])));
+}
+
+// ============================================================================
+// Engine Tests
+// ============================================================================
+
+TEST(EvaluationTest, EngineTermsMatchRecomputeAcrossBattle) {
+    // Exercise every state-mutating path the Engine has
+    const Move player_moves[] = {Move::StealthRock, Move::Sandstorm,  Move::Ember,
+                                 Move::LeechSeed,   Move::Substitute, Move::SwordsDance,
+                                 Move::DoubleEdge,  Move::GigaDrain,  Move::FuryAttack,
+                                 Move::BatonPass,   Move::FutureSight};
+    const Move enemy_moves[] = {Move::ThunderWave, Move::Growl,      Move::TailWhip,
+                                Move::FakeTears,   Move::QuickAttack, Move::Tackle};
+
+    for (uint32_t seed = 1; seed <= 20; seed++) {
+        random::Initialize(seed);
+        BattleEngine engine;
+        state::Pokemon player = CreateCharmander();
+        player.max_hp = 300;
+        player.current_hp = 300;
+        state::Pokemon enemy = CreateBulbasaur();
+        enemy.max_hp = 300;
+        enemy.current_hp = 300;
+        enemy.ability = Ability::Intimidate;
+        engine.InitBattle(player, enemy);
+        ExpectMatchesRecompute(engine);
+
+        for (uint8_t turn = 0; turn < 20 && !engine.IsBattleOver(); turn++) {
+            BattleAction p{ActionType::MOVE, Player::PLAYER, 0,
+                           player_moves[(turn + seed) % (sizeof(player_moves) / sizeof(Move))]};
+            BattleAction e{ActionType::MOVE, Player::ENEMY, 0,
+                           enemy_moves[(turn * 3 + seed) % (sizeof(enemy_moves) / sizeof(Move))]};
+            engine.ExecuteTurn(p, e);
+            ExpectMatchesRecompute(engine);
+        }
+    }
+}
+
+TEST(EvaluationTest, EvaluateFavorsHealthierSide) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(80, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    EXPECT_EQ(engine.Evaluate(), 0);
+
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction growl{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    engine.ExecuteTurn(tackle, growl);
+
+    // Player dealt damage and lost only an Attack stage worth 2 points
+    EXPECT_GT(engine.Evaluate(), 0);
+}
+
+TEST(EvaluationTest, SnapshotRestoreKeepsTerms) {
+    random::Initialize(7);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(80, 50, 100), CreatePokemonWithStats(50, 50, 50));
+
+    BattleAction sandstorm{ActionType::MOVE, Player::PLAYER, 0, Move::Sandstorm};
+    BattleAction tackle{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle};
+    engine.ExecuteTurn(sandstorm, tackle);
+
+    BattleEngine snapshot = engine;
+    int16_t score_before = engine.Evaluate();
+
+    engine.ExecuteTurn(tackle, tackle);
+    EXPECT_NE(engine.Evaluate(), score_before);
+
+    engine = snapshot;  // Restore
+    EXPECT_EQ(engine.Evaluate(), score_before);
+    ExpectMatchesRecompute(engine);
+}
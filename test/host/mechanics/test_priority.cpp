@@ -42,13 +42,15 @@ class PriorityTest : public ::testing::Test {
 
 TEST_F(PriorityTest, QuickAttack_HigherPriorityOverridesSpeed) {
     // Slow Pokemon using Quick Attack (+1) should go before fast Pokemon using Tackle (0)
+    // Set HP to track who moved first (before InitBattle so engine state stays consistent)
+    slow_pokemon.max_hp = 100;
+    slow_pokemon.current_hp = 100;
+    fast_pokemon.max_hp = 100;
+    fast_pokemon.current_hp = 100;
+
     battle::BattleEngine engine;
     engine.InitBattle(slow_pokemon, fast_pokemon);
 
-    // Set HP to track who moved first
-    const_cast<battle::state::Pokemon&>(engine.GetPlayer()).current_hp = 100;
-    const_cast<battle::state::Pokemon&>(engine.GetEnemy()).current_hp = 100;
-
     // Player (slow) uses Quick Attack, Enemy (fast) uses Tackle
     battle::BattleAction player_action{battle::ActionType::MOVE, battle::Player::PLAYER, 0,
                                        domain::Move::QuickAttack};
@@ -0,0 +1,156 @@
+/**
+ * @file test/host/mechanics/test_random_source.cpp
+ * @brief Tests for injectable RNG sources
+ *
+ * This file tests:
+ * - Custom sources replace PCG32 until reset
+ * - Scripted sources return their values, then 0, and record every draw
+ * - The exhaustive enumerator visits every outcome exactly once, including
+ *   draws that only happen for some earlier values
+ * - Draws on one stream never shift another stream's sequence (also while recording)
+ * - Bounded draws reduce without dividing: low bits for powers of two, multiply-shift
+ *   otherwise
+ */
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+#include "test_common.hpp"
+
+using namespace battle;
+
+namespace {
+
+uint16_t AlwaysMax(void* context, uint16_t bound) {
+    (*static_cast<int*>(context))++;
+    return bound - 1;
+}
+
+}  // namespace
+
+TEST(RandomSourceTest, CustomSourceReplacesPcg32) {
+    int calls = 0;
+    random::SetSource(random::Source{AlwaysMax, &calls});
+    EXPECT_EQ(random::Random(100), 99);
+    EXPECT_EQ(random::Random(4), 3);
+    EXPECT_EQ(random::Random(0), 0) << "Random(0) is not a draw";
+    random::ResetSource();
+    EXPECT_EQ(calls, 2);
+
+    // PCG32 is back: the sequence matches a fresh seed
+    random::Initialize(5);
+    uint16_t first = random::Random(1000);
+    random::Initialize(5);
+    EXPECT_EQ(random::Random(1000), first);
+}
+
+TEST(RandomSourceTest, ScriptReturnsValuesThenZero) {
+    const uint16_t values[] = {7, 1};
+    random::Script script;
+    random::BeginScript(script, values, 2);
+    EXPECT_EQ(random::Random(10), 7);
+    EXPECT_EQ(random::Random(2), 1);
+    EXPECT_EQ(random::Random(100), 0);
+    ASSERT_EQ(random::EndScript(script), 3);
+
+    EXPECT_EQ(script.records[0].bound, 10);
+    EXPECT_EQ(script.records[1].value, 1);
+    EXPECT_EQ(script.records[2].bound, 100);
+}
+
+TEST(RandomSourceTest, EnumeratorVisitsEveryOutcomeOnce) {
+    // Second draw only happens when the first is 2: outcomes {0}, {1}, {2,0..4}
+    std::set<std::vector<uint16_t>> seen;
+    uint32_t total_weight = 0;
+
+    random::Enumerator enumerator;
+    random::BeginEnumeration(enumerator);
+    do {
+        std::vector<uint16_t> outcome;
+        outcome.push_back(random::Random(3));
+        if (outcome[0] == 2) {
+            outcome.push_back(random::Random(5));
+        }
+        EXPECT_TRUE(seen.insert(outcome).second) << "Outcome visited twice";
+        EXPECT_EQ(random::OutcomeDraws(enumerator), outcome.size());
+        total_weight += 15 / random::OutcomeSpace(enumerator);
+    } while (random::NextOutcome(enumerator));
+
+    EXPECT_EQ(seen.size(), 7u);
+    EXPECT_EQ(total_weight, 15u) << "Outcome probabilities sum to exactly 1";
+}
+
+TEST(RandomSourceTest, EnumeratorWithNoDrawsHasOneOutcome) {
+    int outcomes = 0;
+    random::Enumerator enumerator;
+    random::BeginEnumeration(enumerator);
+    do {
+        outcomes++;
+        EXPECT_EQ(random::OutcomeSpace(enumerator), 1u);
+    } while (random::NextOutcome(enumerator));
+    EXPECT_EQ(outcomes, 1);
+}
+
+TEST(RandomSourceTest, StreamsDoNotShiftEachOther) {
+    random::Initialize(9);
+    uint16_t expected[8];
+    for (uint16_t& value : expected) {
+        value = random::Random(1000, random::Stream::SpeedTie);
+    }
+
+    // Same seed with extra draws on other streams in between
+    random::Initialize(9);
+    bool differs = false;
+    for (uint16_t i = 0; i < 8; i++) {
+        uint16_t other = random::Random(1000, random::Stream::MultiHit);
+        random::Random(100);
+        EXPECT_EQ(random::Random(1000, random::Stream::SpeedTie), expected[i]) << "draw " << i;
+        differs |= other != expected[i];
+    }
+    EXPECT_TRUE(differs) << "Streams have distinct sequences";
+}
+
+TEST(RandomSourceTest, RecordingAdvancesEachStreamAsUsual) {
+    random::Initialize(11);
+    uint16_t gate = random::Random(1000, random::Stream::StatusGate);
+    uint16_t next_gate = random::Random(1000, random::Stream::StatusGate);
+
+    random::Initialize(11);
+    random::Script script;
+    random::BeginRecording(script);
+    random::Random(1000, random::Stream::Protect);
+    EXPECT_EQ(random::Random(1000, random::Stream::StatusGate), gate);
+    ASSERT_EQ(random::EndScript(script), 2);
+    EXPECT_EQ(script.records[1].value, gate);
+    EXPECT_EQ(random::Random(1000, random::Stream::StatusGate), next_gate);
+}
+
+TEST(RandomSourceTest, BoundedDrawsReduceWithoutDividing) {
+    // A generator seeded like Stream::General reproduces its raw outputs
+    const uint32_t seed = 77;
+    uint64_t state = 0;
+    uint64_t inc = (static_cast<uint64_t>(seed) << 1u) | 1u;
+    random::Pcg32Step(state, inc);
+    state += seed;
+    random::Pcg32Step(state, inc);
+
+    random::Initialize(seed);
+    for (int i = 0; i < 16; i++) {
+        uint32_t raw = random::Pcg32Step(state, inc);
+        EXPECT_EQ(random::Random(100), static_cast<uint16_t>((uint64_t{raw} * 100) >> 32))
+            << "draw " << i;
+        raw = random::Pcg32Step(state, inc);
+        EXPECT_EQ(random::Random(16), raw & 15) << "draw " << i;
+    }
+
+    // Recording reduces the same way
+    random::Initialize(seed);
+    uint16_t plain = random::Random(100);
+    random::Initialize(seed);
+    random::Script script;
+    random::BeginRecording(script);
+    EXPECT_EQ(random::Random(100), plain);
+    random::EndScript(script);
+}
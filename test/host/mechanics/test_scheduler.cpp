@@ -0,0 +1,235 @@
+/**
+ * @file test/host/mechanics/test_scheduler.cpp
+ * @brief Tests for the turn-indexed delayed-effect scheduler
+ *
+ * This file tests:
+ * - Scheduler ordering (due turn, FIFO within a turn, capacity)
+ * - Popping only the effects that are due
+ * - Future Sight delayed damage through the Engine
+ * - Two-turn move charge expiry when the release turn is skipped
+ */
+
+#include <gtest/gtest.h>
+
+#include "battle/commands/schedule.hpp"
+#include "battle/engine.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+state::Scheduler CreateEmptyScheduler() {
+    state::Scheduler scheduler;
+    scheduler.turn = 0;
+    scheduler.count = 0;
+    return scheduler;
+}
+
+}  // namespace
+
+// ============================================================================
+// Scheduler Ordering Tests
+// ============================================================================
+
+TEST(SchedulerTest, PopsOnlyDueEffects) {
+    state::Scheduler scheduler = CreateEmptyScheduler();
+    scheduler.turn = 1;
+
+    commands::ScheduleEffect(scheduler, 2, 0, state::ScheduledEffect::FutureSight, 10);
+    commands::ScheduleEffect(scheduler, 0, 1, state::ScheduledEffect::ChargeExpire);
+
+    state::ScheduledEvent event;
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.effect, state::ScheduledEffect::ChargeExpire);
+    EXPECT_EQ(event.battler, 1);
+    EXPECT_FALSE(commands::PopDueEffect(scheduler, event)) << "Future Sight is not due yet";
+    EXPECT_EQ(scheduler.count, 1);
+
+    scheduler.turn = 3;
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.effect, state::ScheduledEffect::FutureSight);
+    EXPECT_EQ(event.value, 10);
+    EXPECT_EQ(scheduler.count, 0);
+}
+
+TEST(SchedulerTest, OrdersByDueTurnRegardlessOfInsertionOrder) {
+    state::Scheduler scheduler = CreateEmptyScheduler();
+
+    commands::ScheduleEffect(scheduler, 5, 0, state::ScheduledEffect::FutureSight, 5);
+    commands::ScheduleEffect(scheduler, 1, 0, state::ScheduledEffect::FutureSight, 1);
+    commands::ScheduleEffect(scheduler, 3, 0, state::ScheduledEffect::FutureSight, 3);
+
+    scheduler.turn = 10;
+    state::ScheduledEvent event;
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.value, 1);
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.value, 3);
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.value, 5);
+}
+
+TEST(SchedulerTest, SameTurnEffectsResolveInScheduleOrder) {
+    state::Scheduler scheduler = CreateEmptyScheduler();
+
+    commands::ScheduleEffect(scheduler, 1, 0, state::ScheduledEffect::FutureSight, 1);
+    commands::ScheduleEffect(scheduler, 1, 1, state::ScheduledEffect::FutureSight, 2);
+
+    scheduler.turn = 1;
+    state::ScheduledEvent event;
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.value, 1);
+    ASSERT_TRUE(commands::PopDueEffect(scheduler, event));
+    EXPECT_EQ(event.value, 2);
+}
+
+TEST(SchedulerTest, RejectsWhenFull) {
+    state::Scheduler scheduler = CreateEmptyScheduler();
+
+    for (uint8_t i = 0; i < state::MAX_SCHEDULED_EVENTS; i++) {
+        EXPECT_TRUE(commands::ScheduleEffect(scheduler, i, 0, state::ScheduledEffect::None));
+    }
+    EXPECT_FALSE(commands::ScheduleEffect(scheduler, 1, 0, state::ScheduledEffect::None));
+    EXPECT_EQ(scheduler.count, state::MAX_SCHEDULED_EVENTS);
+}
+
+TEST(SchedulerTest, CopiesWithState) {
+    // The scheduler is plain data, so a state copy carries the pending effects
+    state::Scheduler scheduler = CreateEmptyScheduler();
+    commands::ScheduleEffect(scheduler, 2, 1, state::ScheduledEffect::FutureSight, 42);
+
+    state::Scheduler copy = scheduler;
+    EXPECT_TRUE(commands::HasScheduledEffect(copy, 1, state::ScheduledEffect::FutureSight));
+    EXPECT_FALSE(commands::HasScheduledEffect(copy, 0, state::ScheduledEffect::FutureSight));
+}
+
+// ============================================================================
+// Future Sight Tests (Engine)
+// ============================================================================
+
+class FutureSightTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        random::Initialize(42);
+        // 50 Atk vs 50 Def: damage = ((22 * 80 * 50 / 50) / 50) + 2 = 37
+        engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    }
+
+    BattleEngine engine;
+    BattleAction future_sight{ActionType::MOVE, Player::PLAYER, 0, Move::FutureSight};
+    BattleAction player_setup{ActionType::MOVE, Player::PLAYER, 0, Move::SwordsDance};
+    BattleAction enemy_setup{ActionType::MOVE, Player::ENEMY, 0, Move::SwordsDance};
+};
+
+TEST_F(FutureSightTest, HitsAtEndOfSecondFollowingTurn) {
+    engine.ExecuteTurn(future_sight, enemy_setup);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 100) << "No damage on the turn it is used";
+
+    engine.ExecuteTurn(player_setup, enemy_setup);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 100) << "No damage one turn later";
+
+    engine.ExecuteTurn(player_setup, enemy_setup);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 63) << "Hits two turns later";
+
+    engine.ExecuteTurn(player_setup, enemy_setup);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 63) << "Hits only once";
+}
+
+TEST_F(FutureSightTest, DamageIsFixedAtUseTime) {
+    // Attack boosts after the move is used do not change the stored damage
+    engine.ExecuteTurn(future_sight, enemy_setup);
+    engine.ExecuteTurn(player_setup, enemy_setup);
+    engine.ExecuteTurn(player_setup, enemy_setup);
+
+    EXPECT_EQ(engine.GetPlayer().stat_stages[STAT_ATK], 4);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 63);
+}
+
+TEST_F(FutureSightTest, SecondUseWhilePendingFails) {
+    engine.ExecuteTurn(future_sight, enemy_setup);
+    engine.ExecuteTurn(future_sight, enemy_setup);  // Fails: already pending
+    engine.ExecuteTurn(player_setup, enemy_setup);  // First one hits here
+    EXPECT_EQ(engine.GetEnemy().current_hp, 63);
+
+    engine.ExecuteTurn(player_setup, enemy_setup);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 63) << "The failed use never hits";
+}
+
+TEST_F(FutureSightTest, SchedulesIntoStateBlock) {
+    // The delayed hit is held by the bound state block, not by an Engine
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(50, 50, 100),
+                                                 CreatePokemonWithStats(50, 50, 50));
+    state::Pokemon& defender = block.battlers[1];
+    MoveData move{Move::FutureSight, Type::Psychic, 80, 90, 15, 0, 0};
+    BattleContext ctx = CreateBattleContext(block, &move);
+
+    effects::Effect_FutureSight(ctx);
+
+    EXPECT_FALSE(ctx.move_failed);
+    EXPECT_EQ(defender.current_hp, 100) << "Nothing is dealt on the turn it is used";
+    EXPECT_EQ(block.scheduler.count, 1);
+    EXPECT_TRUE(commands::HasScheduledEffect(block.scheduler, 1,
+                                             state::ScheduledEffect::FutureSight));
+
+    BattleContext again = CreateBattleContext(block, &move);
+    effects::Effect_FutureSight(again);
+    EXPECT_TRUE(again.move_failed) << "Only one delayed hit per target";
+    EXPECT_EQ(block.scheduler.count, 1);
+}
+
+TEST_F(FutureSightTest, ProtectOnUseDoesNotStopSetup) {
+    // Accuracy belongs to the turn the hit lands, so the use itself runs no AccuracyCheck
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(50, 50, 100),
+                                                 CreatePokemonWithStats(50, 50, 50));
+    block.battlers[1].is_protected = true;
+    MoveData move{Move::FutureSight, Type::Psychic, 80, 90, 15, 0, 0};
+    BattleContext ctx = CreateBattleContext(block, &move);
+
+    effects::Effect_FutureSight(ctx);
+
+    EXPECT_FALSE(ctx.move_failed);
+    ASSERT_EQ(block.scheduler.count, 1);
+    EXPECT_EQ(block.scheduler.events[0].value, 37) << "Stored damage from CalculateDamage";
+}
+
+// ============================================================================
+// Charge Expiry Tests (Engine)
+// ============================================================================
+
+TEST(ChargeExpiryTest, ChargeDroppedWhenReleaseTurnSkipped) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+
+    BattleAction fly{ActionType::MOVE, Player::PLAYER, 0, Move::Fly};
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction enemy_setup{ActionType::MOVE, Player::ENEMY, 0, Move::SwordsDance};
+
+    engine.ExecuteTurn(fly, enemy_setup);
+    EXPECT_TRUE(engine.GetPlayer().is_charging);
+    EXPECT_TRUE(engine.GetPlayer().is_semi_invulnerable);
+
+    // Release turn never happens (a different move is used)
+    engine.ExecuteTurn(tackle, enemy_setup);
+    EXPECT_FALSE(engine.GetPlayer().is_charging) << "Charge expires at end of the release turn";
+    EXPECT_FALSE(engine.GetPlayer().is_semi_invulnerable);
+}
+
+TEST(ChargeExpiryTest, ReleasedChargeThenRecharge) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50, 500));
+
+    BattleAction solar_beam{ActionType::MOVE, Player::PLAYER, 0, Move::SolarBeam};
+    BattleAction enemy_setup{ActionType::MOVE, Player::ENEMY, 0, Move::SwordsDance};
+
+    engine.ExecuteTurn(solar_beam, enemy_setup);  // Charge
+    engine.ExecuteTurn(solar_beam, enemy_setup);  // Release
+    EXPECT_LT(engine.GetEnemy().current_hp, 500);
+    EXPECT_FALSE(engine.GetPlayer().is_charging);
+
+    engine.ExecuteTurn(solar_beam, enemy_setup);  // Charge again
+    EXPECT_TRUE(engine.GetPlayer().is_charging) << "Old expiry event must not clear a new charge";
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test/host/mechanics/test_state_key.cpp
+ * @brief Tests for the packed 16-byte battle state key
+ *
+ * This file tests:
+ * - Keys fit in 16 bytes
+ * - Packable states unpack to engines with the same encoding and that play on
+ *   identically
+ * - Keys distinguish states that differ in a single field
+ * - States with no keyed form (pending Future Sight, accuracy stages) are refused
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+static_assert(sizeof(state::StateKey) <= 16, "State keys fit in 16 bytes");
+
+namespace {
+
+const Move PLAYER_MOVES[] = {Move::ThunderWave, Move::Protect, Move::Fly,     Move::Substitute,
+                             Move::SwordsDance, Move::Tackle,  Move::Hail,    Move::LeechSeed,
+                             Move::StealthRock, Move::Protect, Move::SolarBeam};
+const Move ENEMY_MOVES[] = {Move::Ember,     Move::Growl,   Move::Sandstorm, Move::Agility,
+                            Move::SunnyDay,  Move::Tackle,  Move::FuryAttack, Move::TailWhip,
+                            Move::GigaDrain, Move::Protect};
+
+BattleEngine CreateEngine() {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(60, 70, 80, 400),
+                      CreatePokemonWithStats(70, 60, 80, 400));
+    return engine;
+}
+
+std::vector<uint8_t> Encoding(const BattleEngine& engine) {
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+    return std::vector<uint8_t>(buffer, buffer + size);
+}
+
+}  // namespace
+
+TEST(StateKeyTest, PlayoutStatesRoundTrip) {
+    int packed = 0;
+    for (uint32_t seed = 1; seed <= 20; seed++) {
+        random::Initialize(seed);
+        BattleEngine engine = CreateEngine();
+        for (size_t turn = 0; turn < 24 && !engine.IsBattleOver(); turn++) {
+            Move player = PLAYER_MOVES[(turn + seed) % (sizeof(PLAYER_MOVES) / sizeof(Move))];
+            Move enemy = ENEMY_MOVES[(turn * seed) % (sizeof(ENEMY_MOVES) / sizeof(Move))];
+            engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, player},
+                               BattleAction{ActionType::MOVE, Player::ENEMY, 0, enemy});
+
+            state::StateKey key;
+            if (!engine.PackKey(&key)) {
+                continue;
+            }
+            packed++;
+
+            BattleEngine restored = CreateEngine();
+            state::BattleState turn_only = restored.GetState();
+            turn_only.scheduler.turn = engine.GetState().scheduler.turn;
+            restored.LoadState(turn_only);
+            restored.UnpackKey(key);
+            ASSERT_EQ(Encoding(restored), Encoding(engine)) << "seed " << seed << " turn " << turn;
+            EXPECT_TRUE(evaluation::Equal(restored.GetEvaluation(), engine.GetEvaluation()));
+
+            state::StateKey repacked;
+            ASSERT_TRUE(restored.PackKey(&repacked));
+            EXPECT_EQ(repacked, key);
+            EXPECT_EQ(state::HashKey(repacked), state::HashKey(key));
+
+            // Both play on identically from the same draws
+            BattleEngine original = engine;
+            BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+            BattleAction ember{ActionType::MOVE, Player::ENEMY, 0, Move::Ember};
+            random::Initialize(seed * 31 + static_cast<uint32_t>(turn));
+            original.ExecuteTurn(tackle, ember);
+            random::Initialize(seed * 31 + static_cast<uint32_t>(turn));
+            restored.ExecuteTurn(tackle, ember);
+            EXPECT_EQ(restored.HashState(), original.HashState());
+        }
+    }
+    EXPECT_GT(packed, 100) << "Most playout states have a keyed form";
+}
+
+TEST(StateKeyTest, SingleFieldChangesTheKey) {
+    BattleEngine engine = CreateEngine();
+    state::StateKey base;
+    ASSERT_TRUE(engine.PackKey(&base));
+
+    const state::BattleState original = engine.GetState();
+    state::BattleState changed = original;
+    changed.battlers[1].current_hp -= 1;
+    engine.LoadState(changed);
+    state::StateKey key;
+    ASSERT_TRUE(engine.PackKey(&key));
+    EXPECT_NE(key, base);
+
+    changed = original;
+    changed.battlers[0].stat_stages[STAT_SPDEF] = -6;
+    engine.LoadState(changed);
+    ASSERT_TRUE(engine.PackKey(&key));
+    EXPECT_NE(key, base);
+
+    changed = original;
+    changed.sides[1].stealth_rock = true;
+    engine.LoadState(changed);
+    ASSERT_TRUE(engine.PackKey(&key));
+    EXPECT_NE(key, base);
+
+    changed = original;
+    changed.field.weather_duration = 1;
+    engine.LoadState(changed);
+    ASSERT_TRUE(engine.PackKey(&key));
+    EXPECT_NE(key, base);
+}
+
+TEST(StateKeyTest, UnkeyableStatesAreRefused) {
+    random::Initialize(3);
+    BattleEngine engine = CreateEngine();
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::FutureSight},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Growl});
+    state::StateKey key;
+    EXPECT_FALSE(engine.PackKey(&key)) << "Pending Future Sight damage is not keyed";
+
+    BattleEngine fresh = CreateEngine();
+    state::BattleState staged = fresh.GetState();
+    staged.battlers[0].stat_stages[STAT_ACC] = 1;
+    fresh.LoadState(staged);
+    EXPECT_FALSE(fresh.PackKey(&key)) << "Accuracy stages are not keyed";
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test/host/mechanics/test_step_many.cpp
+ * @brief Tests for interleaved batch stepping (BattleEngine::StepMany)
+ *
+ * This file tests:
+ * - StepMany produces the same states as stepping each battle with ExecuteTurn
+ * - Batches that are not a multiple of the group size
+ * - Finished battles are skipped
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+const Move MOVE_POOL[] = {Move::Tackle,    Move::Ember,      Move::ThunderWave, Move::Growl,
+                          Move::LeechSeed, Move::Sandstorm,  Move::FuryAttack,  Move::Protect,
+                          Move::GigaDrain, Move::DoubleEdge, Move::FutureSight, Move::QuickAttack};
+constexpr size_t MOVE_POOL_SIZE = sizeof(MOVE_POOL) / sizeof(MOVE_POOL[0]);
+
+/**
+ * @brief Build n heterogeneous battles (different stats, speeds and HP)
+ */
+std::vector<BattleEngine> CreateBattles(size_t n) {
+    std::vector<BattleEngine> engines(n);
+    for (size_t i = 0; i < n; i++) {
+        state::Pokemon player = CreatePokemonWithStats(40 + i * 7 % 60, 50, 30 + i * 13 % 70, 120);
+        state::Pokemon enemy = CreatePokemonWithStats(45 + i * 11 % 50, 55, 35 + i * 5 % 60, 110);
+        engines[i].InitBattle(player, enemy);
+    }
+    return engines;
+}
+
+std::vector<BattleAction> CreateActions(size_t n, uint8_t turn) {
+    std::vector<BattleAction> actions(2 * n);
+    for (size_t i = 0; i < n; i++) {
+        actions[2 * i] = {ActionType::MOVE, Player::PLAYER, 0,
+                          MOVE_POOL[(i + turn) % MOVE_POOL_SIZE]};
+        actions[2 * i + 1] = {ActionType::MOVE, Player::ENEMY, 0,
+                              MOVE_POOL[(i * 5 + turn * 3 + 1) % MOVE_POOL_SIZE]};
+    }
+    return actions;
+}
+
+/**
+ * @brief Run both stepping paths with every RNG draw forced to 0
+ *
+ * Forcing the draws removes the dependence on the order in which battles consume
+ * the RNG, so both paths must produce identical states.
+ */
+void ExpectStepManyMatchesSequential(size_t n, uint8_t turns) {
+    std::vector<BattleEngine> batched = CreateBattles(n);
+    std::vector<BattleEngine> sequential = CreateBattles(n);
+    random::DrawRecord records[random::MAX_RECORDED_DRAWS];
+
+    for (uint8_t turn = 0; turn < turns; turn++) {
+        std::vector<BattleAction> actions = CreateActions(n, turn);
+
+        random::BeginForcedDraws(nullptr, 0);
+        BattleEngine::StepMany(batched.data(), actions.data(), n);
+        for (size_t i = 0; i < n; i++) {
+            if (!sequential[i].IsBattleOver()) {
+                sequential[i].ExecuteTurn(actions[2 * i], actions[2 * i + 1]);
+            }
+        }
+        random::EndForcedDraws(records);
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(batched[i].HashState(), sequential[i].HashState())
+                << "Battle " << i << " diverged on turn " << static_cast<int>(turn);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(StepManyTest, MatchesSequentialStepping) {
+    ExpectStepManyMatchesSequential(32, 12);
+}
+
+TEST(StepManyTest, HandlesPartialGroups) {
+    ExpectStepManyMatchesSequential(1, 6);
+    ExpectStepManyMatchesSequential(13, 6);
+}
+
+TEST(StepManyTest, EmptyBatchIsNoOp) {
+    BattleEngine::StepMany(nullptr, nullptr, 0);
+}
+
+TEST(StepManyTest, SkipsFinishedBattles) {
+    random::Initialize(42);
+    std::vector<BattleEngine> engines(2);
+    engines[0].InitBattle(CreatePokemonWithStats(200, 50, 100),
+                          CreatePokemonWithStats(50, 50, 50, 10));
+    engines[1].InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction enemy_tackle{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle};
+    std::vector<BattleAction> actions = {tackle, enemy_tackle, tackle, enemy_tackle};
+
+    BattleEngine::StepMany(engines.data(), actions.data(), engines.size());
+    ASSERT_TRUE(engines[0].IsBattleOver());
+    uint64_t finished = engines[0].HashState();
+    uint16_t second_hp = engines[1].GetEnemy().current_hp;
+
+    BattleEngine::StepMany(engines.data(), actions.data(), engines.size());
+    EXPECT_EQ(engines[0].HashState(), finished) << "Finished battle is left untouched";
+    EXPECT_LT(engines[1].GetEnemy().current_hp, second_hp);
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test/host/profile/test_allocation_tracker.cpp
+ * @brief Tests for scoped allocation tracking and the zero-allocation hot path
+ *
+ * This file tests:
+ * - Scopes count allocations and frees, nest, and sample call sites
+ * - Nothing is counted outside a scope
+ * - ExecuteTurn, StepMany and full rollouts (including chance enumeration,
+ *   state encoding and hashing) never touch the heap
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "profile/allocation_tracker.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+// Moves that reach every random stream and most commands
+const Move ROTATION[] = {Move::Ember,      Move::ThunderWave, Move::FuryAttack, Move::Protect,
+                         Move::GigaDrain,  Move::LeechSeed,   Move::Sandstorm,  Move::SolarBeam,
+                         Move::DoubleEdge, Move::FutureSight, Move::QuickAttack};
+constexpr size_t ROTATION_SIZE = sizeof(ROTATION) / sizeof(ROTATION[0]);
+
+BattleAction MoveAction(Player side, Move move) {
+    return BattleAction{ActionType::MOVE, side, 0, move};
+}
+
+void StartBattle(BattleEngine& engine) {
+    engine.InitBattle(CreatePokemonWithStats(60, 60, 60, 300),
+                      CreatePokemonWithStats(60, 60, 60, 300));
+}
+
+}  // namespace
+
+TEST(AllocationTrackerTest, ScopesCountNestAndSampleSites) {
+    ASSERT_TRUE(profile::TrackingInstalled());
+
+    profile::AllocationScope outer("outer");
+    std::unique_ptr<int> before(new int(1));
+    {
+        profile::AllocationScope inner("inner");
+        std::vector<int> values(100);
+        values.clear();
+        values.shrink_to_fit();
+        const profile::AllocationCounts& counts = inner.Stop();
+        EXPECT_EQ(counts.allocations, 1u);
+        EXPECT_EQ(counts.frees, 1u);
+        EXPECT_EQ(counts.bytes, 100 * sizeof(int));
+        ASSERT_EQ(counts.site_count, 1);
+        EXPECT_EQ(counts.sites[0].samples, 1u);
+        EXPECT_NE(counts.sites[0].caller, nullptr);
+    }
+    before.reset();
+    profile::AllocationCounts totals = outer.Stop();
+    EXPECT_EQ(totals.allocations, 2u) << "Inner allocations also count in the outer scope";
+    EXPECT_EQ(totals.frees, 2u);
+
+    // Stopped scopes no longer count
+    std::unique_ptr<int> after(new int(2));
+    EXPECT_EQ(outer.Counts().allocations, 2u);
+}
+
+TEST(AllocationTrackerTest, SamplingKeepsEveryNthSite) {
+    // Kept alive past the loop: an optimizer may elide a plain `delete new int`
+    std::unique_ptr<int> kept[10];
+    profile::AllocationScope scope("sampled", 4);
+    for (int i = 0; i < 10; i++) {
+        kept[i].reset(new int(i));
+    }
+    const profile::AllocationCounts& counts = scope.Stop();
+    EXPECT_EQ(counts.allocations, 10u);
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < counts.site_count; i++) {
+        samples += counts.sites[i].samples;
+    }
+    EXPECT_EQ(samples, 2u);
+}
+
+TEST(AllocationTrackerTest, TurnLoopAllocatesNothing) {
+    random::Initialize(3);
+    BattleEngine engine;
+    StartBattle(engine);
+
+    profile::AllocationScope scope("ExecuteTurn");
+    for (size_t turn = 0; turn < 40 && !engine.IsBattleOver(); turn++) {
+        engine.ExecuteTurn(MoveAction(Player::PLAYER, ROTATION[turn % ROTATION_SIZE]),
+                           MoveAction(Player::ENEMY, ROTATION[(turn + 5) % ROTATION_SIZE]));
+        engine.Evaluate();
+    }
+    scope.Stop();
+    EXPECT_EQ(scope.Counts().allocations, 0u) << profile::DescribeScope(scope);
+}
+
+TEST(AllocationTrackerTest, StepManyAllocatesNothing) {
+    random::Initialize(4);
+    constexpr size_t BATTLES = 16;
+    BattleEngine engines[BATTLES];
+    BattleAction actions[2 * BATTLES];
+    for (BattleEngine& engine : engines) {
+        StartBattle(engine);
+    }
+
+    profile::AllocationScope scope("StepMany");
+    for (size_t turn = 0; turn < 30; turn++) {
+        for (size_t i = 0; i < BATTLES; i++) {
+            actions[2 * i] = MoveAction(Player::PLAYER, ROTATION[(turn + i) % ROTATION_SIZE]);
+            actions[2 * i + 1] =
+                MoveAction(Player::ENEMY, ROTATION[(turn * 3 + i) % ROTATION_SIZE]);
+        }
+        BattleEngine::StepMany(engines, actions, BATTLES);
+    }
+    scope.Stop();
+    EXPECT_EQ(scope.Counts().allocations, 0u) << profile::DescribeScope(scope);
+}
+
+TEST(AllocationTrackerTest, RolloutsAllocateNothing) {
+    random::Initialize(5);
+    BattleEngine start;
+    StartBattle(start);
+    uint8_t encoded[MAX_ENCODED_STATE_SIZE];
+
+    profile::AllocationScope scope("Rollout");
+    uint64_t checksum = 0;
+    for (size_t rollout = 0; rollout < 8; rollout++) {
+        BattleEngine engine = start;
+        for (size_t turn = 0; turn < 25 && !engine.IsBattleOver(); turn++) {
+            Move player = ROTATION[random::Random(ROTATION_SIZE)];
+            Move enemy = ROTATION[random::Random(ROTATION_SIZE)];
+
+            // Enumerate the turn's chance outcomes, then play one for real
+            random::Enumerator outcomes;
+            random::BeginEnumeration(outcomes);
+            do {
+                BattleEngine branch = engine;
+                branch.ExecuteTurn(MoveAction(Player::PLAYER, player),
+                                   MoveAction(Player::ENEMY, enemy));
+                checksum ^= branch.HashState();
+            } while (random::NextOutcome(outcomes));
+
+            engine.ExecuteTurn(MoveAction(Player::PLAYER, player),
+                               MoveAction(Player::ENEMY, enemy));
+            size_t size = engine.EncodeState(encoded);
+            BattleEngine decoded;
+            ASSERT_TRUE(decoded.DecodeState(encoded, size));
+        }
+    }
+    scope.Stop();
+    EXPECT_EQ(scope.Counts().allocations, 0u) << profile::DescribeScope(scope);
+    EXPECT_NE(checksum, 0u);
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test/host/script/test_interpreter.cpp
+ * @brief Tests for the battle script bytecode interpreter
+ *
+ * This file tests:
+ * - Every bundled script matches its native Effect_* (both dispatch loops)
+ * - JumpIfFailed control flow
+ * - Script validation (unknown opcodes, truncation, missing End, bad jumps)
+ * - Operand validation (stats, stage changes, percentages, weathers)
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "battle/script/interpreter.hpp"
+#include "battle/script/scripts.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+using EffectFunction = void (*)(BattleContext&);
+using ScriptRunner = void (*)(const uint8_t*, BattleContext&);
+
+struct ScriptCase {
+    const char* name;
+    const uint8_t* script;
+    size_t length;
+    EffectFunction native;
+    MoveData move;
+};
+
+#define SCRIPT_CASE(bytecode, effect, move_data) \
+    ScriptCase{#bytecode, script::bytecode, sizeof(script::bytecode), effects::effect, move_data}
+
+std::vector<ScriptCase> AllCases() {
+    MoveData sandstorm{Move::Sandstorm, Type::Rock, 0, 0, 10, 0, 0};
+    MoveData rain_dance{Move::RainDance, Type::Water, 0, 0, 5, 0, 0};
+    MoveData sunny_day{Move::SunnyDay, Type::Fire, 0, 0, 5, 0, 0};
+    MoveData hail{Move::Hail, Type::Ice, 0, 0, 10, 0, 0};
+    MoveData scald{Move::Ember, Type::Fire, 40, 100, 25, 100, 0};  // Always-burn variant
+
+    return {
+        SCRIPT_CASE(SCRIPT_HIT, Effect_Hit, CreateTackle()),
+        SCRIPT_CASE(SCRIPT_BURN_HIT, Effect_BurnHit, CreateEmber()),
+        SCRIPT_CASE(SCRIPT_BURN_HIT, Effect_BurnHit, scald),
+        SCRIPT_CASE(SCRIPT_PARALYZE, Effect_Paralyze, CreateThunderWave()),
+        SCRIPT_CASE(SCRIPT_ATTACK_DOWN, Effect_AttackDown, CreateGrowl()),
+        SCRIPT_CASE(SCRIPT_DEFENSE_DOWN, Effect_DefenseDown, CreateTailWhip()),
+        SCRIPT_CASE(SCRIPT_SPEED_DOWN, Effect_SpeedDown, CreateStringShot()),
+        SCRIPT_CASE(SCRIPT_SPECIAL_DEFENSE_DOWN_2, Effect_SpecialDefenseDown2, CreateFakeTears()),
+        SCRIPT_CASE(SCRIPT_ATTACK_UP_2, Effect_AttackUp2, CreateSwordsDance()),
+        SCRIPT_CASE(SCRIPT_DEFENSE_UP_2, Effect_DefenseUp2, CreateIronDefense()),
+        SCRIPT_CASE(SCRIPT_SPEED_UP_2, Effect_SpeedUp2, CreateAgility()),
+        SCRIPT_CASE(SCRIPT_SPECIAL_ATTACK_UP_2, Effect_SpecialAttackUp2, CreateTailGlow()),
+        SCRIPT_CASE(SCRIPT_SPECIAL_DEFENSE_UP_2, Effect_SpecialDefenseUp2, CreateAmnesia()),
+        SCRIPT_CASE(SCRIPT_RECOIL_HIT, Effect_RecoilHit, CreateDoubleEdge()),
+        SCRIPT_CASE(SCRIPT_DRAIN_HIT, Effect_DrainHit, CreateGigaDrain()),
+        SCRIPT_CASE(SCRIPT_SANDSTORM, Effect_Sandstorm, sandstorm),
+        SCRIPT_CASE(SCRIPT_RAIN_DANCE, Effect_RainDance, rain_dance),
+        SCRIPT_CASE(SCRIPT_SUNNY_DAY, Effect_SunnyDay, sunny_day),
+        SCRIPT_CASE(SCRIPT_HAIL, Effect_Hail, hail),
+    };
+}
+
+/**
+ * @brief Everything an effect can change, captured for comparison
+ */
+struct Outcome {
+    uint8_t attacker[state::ENCODED_POKEMON_SIZE];
+    uint8_t defender[state::ENCODED_POKEMON_SIZE];
+    uint8_t field[state::ENCODED_FIELD_SIZE];
+    bool move_failed;
+    uint16_t damage_dealt;
+    uint16_t recoil_dealt;
+    uint16_t drain_received;
+};
+
+template <typename Run>
+Outcome RunOnFreshState(const MoveData& move, uint16_t defender_hp, uint32_t seed, Run run) {
+    random::Initialize(seed);
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(80, 50, 60, 120),
+                                                 CreatePokemonWithStats(60, 40, 50, defender_hp));
+    block.battlers[0].current_hp = 90;
+
+    BattleContext ctx = CreateBattleContext(block, &move);
+    run(ctx);
+
+    Outcome outcome;
+    state::EncodePokemon(outcome.attacker, block.battlers[0]);
+    state::EncodePokemon(outcome.defender, block.battlers[1]);
+    state::EncodeField(outcome.field, block.field);
+    outcome.move_failed = ctx.move_failed;
+    outcome.damage_dealt = ctx.damage_dealt;
+    outcome.recoil_dealt = ctx.recoil_dealt;
+    outcome.drain_received = ctx.drain_received;
+    return outcome;
+}
+
+void ExpectSameOutcome(const Outcome& native, const Outcome& scripted, const char* name) {
+    EXPECT_EQ(memcmp(native.attacker, scripted.attacker, sizeof(native.attacker)), 0) << name;
+    EXPECT_EQ(memcmp(native.defender, scripted.defender, sizeof(native.defender)), 0) << name;
+    EXPECT_EQ(memcmp(native.field, scripted.field, sizeof(native.field)), 0) << name;
+    EXPECT_EQ(native.move_failed, scripted.move_failed) << name;
+    EXPECT_EQ(native.damage_dealt, scripted.damage_dealt) << name;
+    EXPECT_EQ(native.recoil_dealt, scripted.recoil_dealt) << name;
+    EXPECT_EQ(native.drain_received, scripted.drain_received) << name;
+}
+
+void ExpectScriptsMatchNative(ScriptRunner runner) {
+    for (const ScriptCase& c : AllCases()) {
+        ASSERT_TRUE(script::ValidateScript(c.script, c.length)) << c.name;
+        // Low defender HP covers the faint paths; several seeds cover the chance rolls
+        for (uint16_t hp : {200, 10}) {
+            for (uint32_t seed = 1; seed <= 8; seed++) {
+                Outcome native = RunOnFreshState(c.move, hp, seed,
+                                                 [&](BattleContext& ctx) { c.native(ctx); });
+                Outcome scripted = RunOnFreshState(
+                    c.move, hp, seed, [&](BattleContext& ctx) { runner(c.script, ctx); });
+                ExpectSameOutcome(native, scripted, c.name);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Equivalence Tests
+// ============================================================================
+
+TEST(BattleScriptTest, SwitchDispatchMatchesNativeEffects) {
+    ExpectScriptsMatchNative(script::RunScriptSwitch);
+}
+
+#if BATTLE_SCRIPT_THREADED
+TEST(BattleScriptTest, ThreadedDispatchMatchesNativeEffects) {
+    ExpectScriptsMatchNative(script::RunScriptThreaded);
+}
+#endif
+
+TEST(BattleScriptTest, RunScriptMatchesNativeEffects) {
+    ExpectScriptsMatchNative(script::RunScript);
+}
+
+// ============================================================================
+// Control Flow Tests
+// ============================================================================
+
+TEST(BattleScriptTest, JumpIfFailedSkipsToTarget) {
+    // Swords Dance only if the accuracy check passed
+    const uint8_t bytecode[] = {
+        script::Code(script::Op::AccuracyCheck),
+        script::Code(script::Op::JumpIfFailed), 6,
+        script::Code(script::Op::ModifyStatSelf), STAT_ATK, 2,
+        script::Code(script::Op::End),
+    };
+    ASSERT_TRUE(script::ValidateScript(bytecode, sizeof(bytecode)));
+
+    state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+    state::Pokemon& attacker = block.battlers[0];
+    state::Pokemon& defender = block.battlers[1];
+    MoveData growl = CreateGrowl();
+
+    BattleContext hit = CreateBattleContext(block, &growl);
+    script::RunScript(bytecode, hit);
+    EXPECT_EQ(attacker.stat_stages[STAT_ATK], 2);
+
+    defender.is_protected = true;
+    BattleContext blocked = CreateBattleContext(block, &growl);
+    script::RunScript(bytecode, blocked);
+    EXPECT_EQ(attacker.stat_stages[STAT_ATK], 2) << "Jump skipped the boost";
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST(BattleScriptValidationTest, RejectsMalformedScripts) {
+    const uint8_t unknown_op[] = {0xEE, script::Code(script::Op::End)};
+    const uint8_t truncated[] = {script::Code(script::Op::ModifyStat), STAT_ATK};
+    const uint8_t no_end[] = {script::Code(script::Op::Hit), script::Code(script::Op::CheckFaint)};
+    const uint8_t backward_jump[] = {script::Code(script::Op::AccuracyCheck),
+                                     script::Code(script::Op::JumpIfFailed), 0,
+                                     script::Code(script::Op::End)};
+    const uint8_t mid_instruction_jump[] = {script::Code(script::Op::JumpIfFailed), 3,
+                                            script::Code(script::Op::Recoil), 33,
+                                            script::Code(script::Op::End)};
+    const uint8_t past_end_jump[] = {script::Code(script::Op::JumpIfFailed), 4,
+                                     script::Code(script::Op::End), 0, 0};
+
+    EXPECT_FALSE(script::ValidateScript(unknown_op, sizeof(unknown_op)));
+    EXPECT_FALSE(script::ValidateScript(truncated, sizeof(truncated)));
+    EXPECT_FALSE(script::ValidateScript(no_end, sizeof(no_end)));
+    EXPECT_FALSE(script::ValidateScript(backward_jump, sizeof(backward_jump)));
+    EXPECT_FALSE(script::ValidateScript(mid_instruction_jump, sizeof(mid_instruction_jump)));
+    EXPECT_FALSE(script::ValidateScript(past_end_jump, sizeof(past_end_jump)));
+    EXPECT_FALSE(script::ValidateScript(nullptr, 4));
+}
+
+TEST(BattleScriptValidationTest, AcceptsTrailingBytesAfterEnd) {
+    const uint8_t padded[] = {script::Code(script::Op::HitAndFaint), script::Code(script::Op::End),
+                              0xFF, 0xFF};
+    EXPECT_TRUE(script::ValidateScript(padded, sizeof(padded)));
+}
+
+TEST(BattleScriptValidationTest, RejectsOutOfRangeOperands) {
+    const uint8_t end = script::Code(script::Op::End);
+    const uint8_t modify = script::Code(script::Op::ModifyStat);
+    const uint8_t self = script::Code(script::Op::ModifyStatSelf);
+    const uint8_t weather = script::Code(script::Op::SetWeather);
+    const uint8_t stat_past_end[] = {modify, NUM_BATTLE_STATS, 0xFF, end};
+    const uint8_t hp_stage[] = {self, STAT_HP, 1, end};
+    const uint8_t stage_too_high[] = {self, STAT_ATK, 7, end};
+    const uint8_t stage_too_low[] = {modify, STAT_DEF, static_cast<uint8_t>(-7), end};
+    const uint8_t stage_zero[] = {modify, STAT_SPEED, 0, end};
+    const uint8_t burn_over_100[] = {script::Code(script::Op::TryBurn), 101, end};
+    const uint8_t paralysis_over_100[] = {script::Code(script::Op::TryParalysis), 255, end};
+    const uint8_t recoil_zero[] = {script::Code(script::Op::Recoil), 0, end};
+    const uint8_t recoil_over_100[] = {script::Code(script::Op::Recoil), 101, end};
+    const uint8_t drain_over_100[] = {script::Code(script::Op::Drain), 200, end};
+    const uint8_t weather_past_end[] = {weather, NUM_WEATHERS, 5, end};
+    const uint8_t weather_too_long[] = {weather, static_cast<uint8_t>(Weather::Rain), 8, end};
+    const uint8_t weather_no_turns[] = {weather, static_cast<uint8_t>(Weather::Sun), 0, end};
+    const uint8_t clear_with_turns[] = {weather, static_cast<uint8_t>(Weather::None), 5, end};
+
+    EXPECT_FALSE(script::ValidateScript(stat_past_end, sizeof(stat_past_end)));
+    EXPECT_FALSE(script::ValidateScript(hp_stage, sizeof(hp_stage)));
+    EXPECT_FALSE(script::ValidateScript(stage_too_high, sizeof(stage_too_high)));
+    EXPECT_FALSE(script::ValidateScript(stage_too_low, sizeof(stage_too_low)));
+    EXPECT_FALSE(script::ValidateScript(stage_zero, sizeof(stage_zero)));
+    EXPECT_FALSE(script::ValidateScript(burn_over_100, sizeof(burn_over_100)));
+    EXPECT_FALSE(script::ValidateScript(paralysis_over_100, sizeof(paralysis_over_100)));
+    EXPECT_FALSE(script::ValidateScript(recoil_zero, sizeof(recoil_zero)));
+    EXPECT_FALSE(script::ValidateScript(recoil_over_100, sizeof(recoil_over_100)));
+    EXPECT_FALSE(script::ValidateScript(drain_over_100, sizeof(drain_over_100)));
+    EXPECT_FALSE(script::ValidateScript(weather_past_end, sizeof(weather_past_end)));
+    EXPECT_FALSE(script::ValidateScript(weather_too_long, sizeof(weather_too_long)));
+    EXPECT_FALSE(script::ValidateScript(weather_no_turns, sizeof(weather_no_turns)));
+    EXPECT_FALSE(script::ValidateScript(clear_with_turns, sizeof(clear_with_turns)));
+
+    // The limits themselves are accepted
+    const uint8_t limits[] = {self,
+                              STAT_EVASION,
+                              6,
+                              modify,
+                              STAT_ACC,
+                              static_cast<uint8_t>(-6),
+                              script::Code(script::Op::Drain),
+                              100,
+                              weather,
+                              static_cast<uint8_t>(Weather::Hail),
+                              7,
+                              end};
+    EXPECT_TRUE(script::ValidateScript(limits, sizeof(limits)));
+}
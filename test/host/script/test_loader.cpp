@@ -0,0 +1,190 @@
+/**
+ * @file test/host/script/test_loader.cpp
+ * @brief Tests for per-move script tables and their use by the engine
+ *
+ * This file tests:
+ * - A well-formed blob fills the table; malformed blobs are rejected whole
+ * - An engine running the bundled scripts matches the native effects turn by turn
+ * - A loaded script replaces the move's native effect
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "battle/script/interpreter.hpp"
+#include "battle/script/loader.hpp"
+#include "battle/script/scripts.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+std::vector<uint8_t> BlobHeader(uint8_t count) {
+    return {'B', 'S', 'C', 'R', script::SCRIPT_BLOB_VERSION, count};
+}
+
+void AddEntry(std::vector<uint8_t>* blob, Move move, const uint8_t* bytes, size_t length) {
+    blob->push_back(static_cast<uint8_t>(move));
+    blob->push_back(static_cast<uint8_t>(length));
+    blob->insert(blob->end(), bytes, bytes + length);
+}
+
+#define ADD_SCRIPT(blob, move, bytecode) \
+    AddEntry(&(blob), move, script::bytecode, sizeof(script::bytecode))
+
+/**
+ * @brief Blob assigning every bundled script to the move whose effect it mirrors
+ */
+std::vector<uint8_t> BundledBlob() {
+    std::vector<uint8_t> blob = BlobHeader(12);
+    ADD_SCRIPT(blob, Move::Tackle, SCRIPT_HIT);
+    ADD_SCRIPT(blob, Move::Ember, SCRIPT_BURN_HIT);
+    ADD_SCRIPT(blob, Move::ThunderWave, SCRIPT_PARALYZE);
+    ADD_SCRIPT(blob, Move::Growl, SCRIPT_ATTACK_DOWN);
+    ADD_SCRIPT(blob, Move::TailWhip, SCRIPT_DEFENSE_DOWN);
+    ADD_SCRIPT(blob, Move::SwordsDance, SCRIPT_ATTACK_UP_2);
+    ADD_SCRIPT(blob, Move::DoubleEdge, SCRIPT_RECOIL_HIT);
+    ADD_SCRIPT(blob, Move::GigaDrain, SCRIPT_DRAIN_HIT);
+    ADD_SCRIPT(blob, Move::Sandstorm, SCRIPT_SANDSTORM);
+    ADD_SCRIPT(blob, Move::RainDance, SCRIPT_RAIN_DANCE);
+    ADD_SCRIPT(blob, Move::SunnyDay, SCRIPT_SUNNY_DAY);
+    ADD_SCRIPT(blob, Move::Hail, SCRIPT_HAIL);
+    return blob;
+}
+
+BattleAction Action(Player side, Move move) {
+    return BattleAction{ActionType::MOVE, side, 0, move};
+}
+
+std::vector<uint8_t> Observe(const BattleEngine& engine) {
+    uint8_t buffer[MAX_ENCODED_STATE_SIZE];
+    size_t size = engine.EncodeState(buffer);
+    return std::vector<uint8_t>(buffer, buffer + size);
+}
+
+}  // namespace
+
+TEST(ScriptLoaderTest, LoadsWellFormedBlob) {
+    std::vector<uint8_t> blob = BundledBlob();
+    script::ScriptTable table;
+    ASSERT_TRUE(script::LoadScriptTable(blob.data(), blob.size(), &table));
+
+    ASSERT_NE(table.scripts[static_cast<uint8_t>(Move::Growl)], nullptr);
+    EXPECT_EQ(memcmp(table.scripts[static_cast<uint8_t>(Move::Growl)],
+                     script::SCRIPT_ATTACK_DOWN, sizeof(script::SCRIPT_ATTACK_DOWN)),
+              0);
+    EXPECT_EQ(table.scripts[static_cast<uint8_t>(Move::None)], nullptr);
+    EXPECT_EQ(table.scripts[static_cast<uint8_t>(Move::Protect)], nullptr) << "No entry";
+    uint64_t bundled = table.checksum;
+    EXPECT_NE(bundled, 0u) << "0 is reserved for native effects";
+
+    std::vector<uint8_t> empty = BlobHeader(0);
+    ASSERT_TRUE(script::LoadScriptTable(empty.data(), empty.size(), &table));
+    EXPECT_EQ(table.scripts[static_cast<uint8_t>(Move::Growl)], nullptr);
+    EXPECT_NE(table.checksum, bundled) << "Different blobs, different configurations";
+}
+
+TEST(ScriptLoaderTest, RejectsMalformedBlobs) {
+    const uint8_t end = script::Code(script::Op::End);
+    const uint8_t bad_operand[] = {script::Code(script::Op::Recoil), 0, end};
+
+    std::vector<std::vector<uint8_t>> bad;
+    std::vector<uint8_t> blob = BundledBlob();
+    blob[0] = 'X';
+    bad.push_back(blob);  // Magic
+    blob = BundledBlob();
+    blob[4] = script::SCRIPT_BLOB_VERSION + 1;
+    bad.push_back(blob);  // Version
+    blob = BundledBlob();
+    blob[5] = 13;
+    bad.push_back(blob);  // More entries than the blob holds
+    blob = BundledBlob();
+    blob.push_back(0);
+    bad.push_back(blob);  // Trailing byte
+    blob = BundledBlob();
+    blob.pop_back();
+    bad.push_back(blob);  // Truncated script
+    blob = BlobHeader(1);
+    ADD_SCRIPT(blob, Move::None, SCRIPT_HIT);
+    bad.push_back(blob);
+    blob = BlobHeader(1);
+    AddEntry(&blob, static_cast<Move>(NUM_MOVES), script::SCRIPT_HIT, sizeof(script::SCRIPT_HIT));
+    bad.push_back(blob);
+    blob = BlobHeader(2);
+    ADD_SCRIPT(blob, Move::Tackle, SCRIPT_HIT);
+    ADD_SCRIPT(blob, Move::Tackle, SCRIPT_HIT);
+    bad.push_back(blob);  // Duplicate move
+    blob = BlobHeader(1);
+    AddEntry(&blob, Move::Tackle, bad_operand, sizeof(bad_operand));
+    bad.push_back(blob);  // Script fails validation
+    blob = BlobHeader(1);
+    AddEntry(&blob, Move::Tackle, script::SCRIPT_HIT, 1);
+    bad.push_back(blob);  // End lies past the entry's length
+
+    std::vector<uint8_t> good = BundledBlob();
+    script::ScriptTable table;
+    ASSERT_TRUE(script::LoadScriptTable(good.data(), good.size(), &table));
+    const uint8_t* growl = table.scripts[static_cast<uint8_t>(Move::Growl)];
+    for (size_t i = 0; i < bad.size(); i++) {
+        EXPECT_FALSE(script::LoadScriptTable(bad[i].data(), bad[i].size(), &table)) << i;
+        EXPECT_EQ(table.scripts[static_cast<uint8_t>(Move::Growl)], growl)
+            << "A rejected blob leaves the table unchanged (" << i << ")";
+    }
+    EXPECT_FALSE(script::LoadScriptTable(nullptr, 6, &table));
+}
+
+TEST(ScriptLoaderTest, EngineRunsBundledScriptsLikeNativeEffects) {
+    std::vector<uint8_t> blob = BundledBlob();
+    script::ScriptTable table;
+    ASSERT_TRUE(script::LoadScriptTable(blob.data(), blob.size(), &table));
+
+    const Move player_moves[] = {Move::Tackle, Move::Ember,     Move::SwordsDance,
+                                 Move::Growl,  Move::RainDance, Move::DoubleEdge};
+    const Move enemy_moves[] = {Move::GigaDrain, Move::ThunderWave, Move::TailWhip,
+                                Move::Sandstorm, Move::SunnyDay,    Move::Hail};
+    for (uint32_t seed = 1; seed <= 6; seed++) {
+        BattleEngine native;
+        native.InitBattle(CreatePokemonWithStats(70, 60, 65, 200),
+                          CreatePokemonWithStats(65, 60, 60, 200));
+        BattleEngine scripted = native;
+        scripted.SetScriptTable(&table);
+
+        for (int turn = 0; turn < 10 && !native.IsBattleOver(); turn++) {
+            BattleAction player = Action(Player::PLAYER, player_moves[(turn + seed) % 6]);
+            BattleAction enemy = Action(Player::ENEMY, enemy_moves[(turn * 5 + seed) % 6]);
+            random::Initialize(seed * 100 + turn);
+            native.ExecuteTurn(player, enemy);
+            random::Initialize(seed * 100 + turn);
+            scripted.ExecuteTurn(player, enemy);
+            ASSERT_EQ(Observe(scripted), Observe(native)) << "seed " << seed << " turn " << turn;
+        }
+    }
+}
+
+TEST(ScriptLoaderTest, LoadedScriptReplacesNativeEffect) {
+    // Tackle becomes a self-boost that deals no damage
+    const uint8_t boost[] = {script::Code(script::Op::ModifyStatSelf), STAT_ATK, 1,
+                             script::Code(script::Op::End)};
+    std::vector<uint8_t> blob = BlobHeader(1);
+    AddEntry(&blob, Move::Tackle, boost, sizeof(boost));
+    script::ScriptTable table;
+    ASSERT_TRUE(script::LoadScriptTable(blob.data(), blob.size(), &table));
+
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(70, 60, 80, 200),
+                      CreatePokemonWithStats(65, 60, 60, 200));
+    engine.SetScriptTable(&table);
+    random::Initialize(3);
+    engine.ExecuteTurn(Action(Player::PLAYER, Move::Tackle), Action(Player::ENEMY, Move::Growl));
+    EXPECT_EQ(engine.GetEnemy().current_hp, engine.GetEnemy().max_hp) << "No damage dealt";
+    EXPECT_EQ(engine.GetPlayer().stat_stages[STAT_ATK], 0) << "+1 from the script, -1 from Growl";
+
+    engine.SetScriptTable(nullptr);
+    engine.ExecuteTurn(Action(Player::PLAYER, Move::Tackle), Action(Player::ENEMY, Move::Growl));
+    EXPECT_LT(engine.GetEnemy().current_hp, engine.GetEnemy().max_hp) << "Native Tackle again";
+}
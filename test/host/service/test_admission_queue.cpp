@@ -0,0 +1,97 @@
+/**
+ * @file test/host/service/test_admission_queue.cpp
+ * @brief Tests for the bounded turn queue and its admission policies
+ *
+ * This file tests:
+ * - Requests come out in FIFO order, stamped with their admission time
+ * - Reject turns new requests away from a full queue
+ * - ShedOldest drops the oldest request to admit a new one
+ * - Degrade flags requests past the degrade depth and still bounds the queue
+ */
+
+#include <gtest/gtest.h>
+
+#include "service/admission_queue.hpp"
+
+using namespace service;
+
+namespace {
+
+TurnRequest Request(uint64_t session) {
+    TurnRequest request = {};
+    request.session = session;
+    return request;
+}
+
+}  // namespace
+
+TEST(AdmissionQueueTest, FifoWithAdmissionTime) {
+    AdmissionQueue queue(4, AdmissionPolicy::Reject, 4);
+    Clock::time_point t0 = Clock::now();
+    queue.Offer(Request(1), t0);
+    queue.Offer(Request(2), t0 + std::chrono::milliseconds(1));
+
+    TurnRequest out;
+    ASSERT_TRUE(queue.Pop(&out));
+    EXPECT_EQ(out.session, 1u);
+    EXPECT_EQ(out.enqueued, t0);
+    ASSERT_TRUE(queue.Pop(&out));
+    EXPECT_EQ(out.session, 2u);
+    EXPECT_FALSE(queue.Pop(&out));
+}
+
+TEST(AdmissionQueueTest, RejectWhenFull) {
+    AdmissionQueue queue(2, AdmissionPolicy::Reject, 2);
+    EXPECT_EQ(queue.Offer(Request(1), Clock::now()).admission, Admission::Accepted);
+    EXPECT_EQ(queue.Offer(Request(2), Clock::now()).admission, Admission::Accepted);
+    OfferResult full = queue.Offer(Request(3), Clock::now());
+    EXPECT_EQ(full.admission, Admission::Rejected);
+    EXPECT_FALSE(full.shed);
+    EXPECT_EQ(queue.Size(), 2u);
+}
+
+TEST(AdmissionQueueTest, ShedOldestMakesRoom) {
+    AdmissionQueue queue(2, AdmissionPolicy::ShedOldest, 2);
+    queue.Offer(Request(1), Clock::now());
+    queue.Offer(Request(2), Clock::now());
+    OfferResult result = queue.Offer(Request(3), Clock::now());
+
+    EXPECT_EQ(result.admission, Admission::Accepted);
+    ASSERT_TRUE(result.shed);
+    EXPECT_EQ(result.shed_request.session, 1u);
+    EXPECT_EQ(queue.Size(), 2u);
+
+    TurnRequest out;
+    queue.Pop(&out);
+    EXPECT_EQ(out.session, 2u);
+    queue.Pop(&out);
+    EXPECT_EQ(out.session, 3u);
+}
+
+TEST(AdmissionQueueTest, DegradePastDepthThenReject) {
+    AdmissionQueue queue(4, AdmissionPolicy::Degrade, 2);
+    EXPECT_EQ(queue.Offer(Request(1), Clock::now()).admission, Admission::Accepted);
+    EXPECT_EQ(queue.Offer(Request(2), Clock::now()).admission, Admission::Accepted);
+    EXPECT_EQ(queue.Offer(Request(3), Clock::now()).admission, Admission::Degraded);
+    EXPECT_EQ(queue.Offer(Request(4), Clock::now()).admission, Admission::Degraded);
+    EXPECT_EQ(queue.Offer(Request(5), Clock::now()).admission, Admission::Rejected)
+        << "Degrade still bounds the queue";
+
+    TurnRequest out;
+    queue.Pop(&out);
+    EXPECT_FALSE(out.degraded);
+    queue.Pop(&out);
+    queue.Pop(&out);
+    EXPECT_TRUE(out.degraded);
+}
+
+TEST(AdmissionQueueTest, RingWrapsAround) {
+    AdmissionQueue queue(3, AdmissionPolicy::Reject, 3);
+    TurnRequest out;
+    for (uint64_t i = 0; i < 10; i++) {
+        ASSERT_EQ(queue.Offer(Request(i), Clock::now()).admission, Admission::Accepted);
+        ASSERT_TRUE(queue.Pop(&out));
+        EXPECT_EQ(out.session, i);
+    }
+    EXPECT_TRUE(queue.Empty());
+}
@@ -0,0 +1,362 @@
+/**
+ * @file test/host/service/test_battle_server.cpp
+ * @brief Tests for the in-process battle server
+ *
+ * This file tests:
+ * - Submitted turns run on the session's worker and are replied to
+ * - Unknown sessions and finished battles are reported, not executed
+ * - Overload is bounded by the admission policy (reject, shed, degrade)
+ * - Queue delay and execution time are recorded separately
+ * - Concurrent turns are coalesced into batches that keep per-session order
+ * - Idle sessions are hibernated and rehydrated without changing their battles
+ * - Batch steps make no heap allocations
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "service/battle_server.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+analysis::PolicyChoice Choose(Player side, Move move, double probability) {
+    analysis::PolicyChoice choice;
+    choice.action = BattleAction{ActionType::MOVE, side, 0, move};
+    choice.probability = probability;
+    return choice;
+}
+
+uint8_t TackleAi(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Growl, 0.25);
+    out[1] = Choose(side, Move::Tackle, 0.75);
+    return 2;
+}
+
+uint8_t GrowlAi(const BattleEngine&, Player side, analysis::PolicyChoice* out) {
+    out[0] = Choose(side, Move::Growl, 1.0);
+    return 1;
+}
+
+/**
+ * @brief Expensive AI: holds the worker long enough for a backlog to build
+ */
+uint8_t SlowAi(const BattleEngine& engine, Player side, analysis::PolicyChoice* out) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    return TackleAi(engine, side, out);
+}
+
+struct Replies {
+    std::mutex mutex;
+    std::vector<service::TurnResult> results;
+
+    static void Collect(void* user, const service::TurnResult& result) {
+        Replies* self = static_cast<Replies*>(user);
+        std::lock_guard<std::mutex> lock(self->mutex);
+        self->results.push_back(result);
+    }
+
+    size_t Count(service::TurnStatus status) {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = 0;
+        for (const service::TurnResult& result : results) {
+            count += (result.status == status) ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+const BattleAction PLAYER_GROWL = {ActionType::MOVE, Player::PLAYER, 0, Move::Growl};
+
+}  // namespace
+
+TEST(BattleServerTest, TurnsRunAndReply) {
+    Replies replies;
+    service::ServerOptions options;
+    options.workers = 3;
+    options.ai = TackleAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+
+    for (uint64_t id = 0; id < 9; id++) {
+        ASSERT_TRUE(server.OpenSession(id, CreatePokemonWithStats(50, 50, 50, 200),
+                                       CreatePokemonWithStats(50, 50, 50, 200)));
+    }
+    EXPECT_FALSE(server.OpenSession(3, CreatePokemonWithStats(50, 50, 50),
+                                    CreatePokemonWithStats(50, 50, 50)));
+
+    for (int turn = 0; turn < 3; turn++) {
+        for (uint64_t id = 0; id < 9; id++) {
+            EXPECT_EQ(server.SubmitTurn(id, PLAYER_GROWL), service::Admission::Accepted);
+        }
+    }
+    server.Drain();
+
+    EXPECT_EQ(replies.Count(service::TurnStatus::Done), 27u);
+    for (const service::TurnResult& result : replies.results) {
+        EXPECT_EQ(result.enemy_action.move, Move::Tackle) << "Most likely AI choice is played";
+        EXPECT_FALSE(result.degraded);
+    }
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_EQ(stats.accepted, 27u);
+    EXPECT_EQ(stats.completed, 27u);
+    EXPECT_EQ(stats.queue_ns.Count(), 27u);
+    EXPECT_EQ(stats.execution_ns.Count(), 27u);
+}
+
+TEST(BattleServerTest, UnknownSessionAndFinishedBattle) {
+    Replies replies;
+    service::ServerOptions options;
+    options.ai = TackleAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+
+    state::Pokemon fainted = CreatePokemonWithStats(50, 50, 50);
+    fainted.current_hp = 0;
+    fainted.is_fainted = true;
+    server.OpenSession(1, CreatePokemonWithStats(50, 50, 50), fainted);
+
+    server.SubmitTurn(1, PLAYER_GROWL);
+    server.SubmitTurn(2, PLAYER_GROWL);
+    server.Drain();
+
+    EXPECT_EQ(replies.Count(service::TurnStatus::BattleOver), 1u);
+    EXPECT_EQ(replies.Count(service::TurnStatus::UnknownSession), 1u);
+}
+
+TEST(BattleServerTest, RejectBoundsBacklog) {
+    Replies replies;
+    service::ServerOptions options;
+    options.queue_capacity = 4;
+    options.ai = SlowAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+    server.OpenSession(0, CreatePokemonWithStats(50, 50, 50, 999),
+                       CreatePokemonWithStats(50, 50, 50, 999));
+
+    size_t rejected = 0;
+    for (int i = 0; i < 40; i++) {
+        rejected += server.SubmitTurn(0, PLAYER_GROWL) == service::Admission::Rejected ? 1 : 0;
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_GT(rejected, 0u);
+    EXPECT_EQ(stats.rejected, rejected);
+    EXPECT_EQ(stats.accepted + stats.rejected, 40u);
+    EXPECT_EQ(stats.completed, stats.accepted);
+    EXPECT_LE(stats.accepted, 40u - rejected);
+}
+
+TEST(BattleServerTest, ShedOldestRepliesToDroppedRequests) {
+    Replies replies;
+    service::ServerOptions options;
+    options.queue_capacity = 4;
+    options.policy = service::AdmissionPolicy::ShedOldest;
+    options.ai = SlowAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+    server.OpenSession(0, CreatePokemonWithStats(50, 50, 50, 999),
+                       CreatePokemonWithStats(50, 50, 50, 999));
+
+    for (int i = 0; i < 40; i++) {
+        EXPECT_EQ(server.SubmitTurn(0, PLAYER_GROWL), service::Admission::Accepted);
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_GT(stats.shed, 0u);
+    EXPECT_EQ(replies.Count(service::TurnStatus::Shed), stats.shed);
+    EXPECT_EQ(stats.completed + stats.shed, 40u) << "Every admitted request gets one reply";
+}
+
+TEST(BattleServerTest, DegradeUsesFallbackAi) {
+    Replies replies;
+    service::ServerOptions options;
+    options.queue_capacity = 8;
+    options.degrade_depth = 2;
+    options.policy = service::AdmissionPolicy::Degrade;
+    options.ai = SlowAi;
+    options.fallback_ai = GrowlAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+    server.OpenSession(0, CreatePokemonWithStats(50, 50, 50, 999),
+                       CreatePokemonWithStats(50, 50, 50, 999));
+
+    for (int i = 0; i < 8; i++) {
+        server.SubmitTurn(0, PLAYER_GROWL);
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_GT(stats.degraded, 0u);
+    for (const service::TurnResult& result : replies.results) {
+        EXPECT_EQ(result.enemy_action.move, result.degraded ? Move::Growl : Move::Tackle);
+    }
+}
+
+TEST(BattleServerTest, QueueDelaySeparateFromExecution) {
+    Replies replies;
+    service::ServerOptions options;
+    options.queue_capacity = 16;
+    options.ai = SlowAi;
+    service::BattleServer server(options, Replies::Collect, &replies);
+    server.OpenSession(0, CreatePokemonWithStats(50, 50, 50, 999),
+                       CreatePokemonWithStats(50, 50, 50, 999));
+
+    for (int i = 0; i < 8; i++) {
+        server.SubmitTurn(0, PLAYER_GROWL);
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_GE(stats.execution_ns.Min(), 2e6) << "Each turn runs the 2 ms AI";
+    EXPECT_GT(stats.queue_ns.Max(), stats.execution_ns.Max())
+        << "The last request waited behind the others";
+}
+
+TEST(BattleServerTest, CoalescesConcurrentSessions) {
+    Replies replies;
+    service::ServerOptions options;
+    options.ai = TackleAi;
+    options.coalesce_window = std::chrono::milliseconds(20);
+    service::BattleServer server(options, Replies::Collect, &replies);
+    for (uint64_t id = 0; id < 32; id++) {
+        server.OpenSession(id, CreatePokemonWithStats(50, 50, 50, 200),
+                           CreatePokemonWithStats(50, 50, 50, 200));
+    }
+
+    for (uint64_t id = 0; id < 32; id++) {
+        server.SubmitTurn(id, PLAYER_GROWL);
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_EQ(replies.Count(service::TurnStatus::Done), 32u);
+    EXPECT_LT(stats.batches, 32u);
+    EXPECT_GT(stats.batch_size.Max(), 1.0);
+}
+
+TEST(BattleServerTest, MaxBatchCapsBatch) {
+    Replies replies;
+    service::ServerOptions options;
+    options.ai = TackleAi;
+    options.max_batch = 4;
+    options.coalesce_window = std::chrono::milliseconds(20);
+    service::BattleServer server(options, Replies::Collect, &replies);
+    for (uint64_t id = 0; id < 16; id++) {
+        server.OpenSession(id, CreatePokemonWithStats(50, 50, 50, 200),
+                           CreatePokemonWithStats(50, 50, 50, 200));
+        server.SubmitTurn(id, PLAYER_GROWL);
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_EQ(stats.completed, 16u);
+    EXPECT_LE(stats.batch_size.Max(), 4.0);
+}
+
+TEST(BattleServerTest, BatchesKeepSessionTurnOrder) {
+    Replies replies;
+    service::ServerOptions options;
+    options.ai = TackleAi;
+    options.coalesce_window = std::chrono::milliseconds(5);
+    service::BattleServer server(options, Replies::Collect, &replies);
+    for (uint64_t id = 0; id < 4; id++) {
+        server.OpenSession(id, CreatePokemonWithStats(50, 50, 50, 999),
+                           CreatePokemonWithStats(50, 50, 50, 999));
+    }
+
+    for (int turn = 0; turn < 3; turn++) {
+        for (uint64_t id = 0; id < 4; id++) {
+            server.SubmitTurn(id, PLAYER_GROWL);
+        }
+    }
+    server.Drain();
+
+    uint16_t last_turn[4] = {0, 0, 0, 0};
+    for (const service::TurnResult& result : replies.results) {
+        ASSERT_EQ(result.status, service::TurnStatus::Done);
+        EXPECT_EQ(result.turn, last_turn[result.session] + 1) << "session " << result.session;
+        last_turn[result.session] = result.turn;
+    }
+    for (uint16_t turn : last_turn) {
+        EXPECT_EQ(turn, 3);
+    }
+}
+
+TEST(BattleServerTest, HibernatedSessionsRehydrateUnchanged) {
+    Replies bounded_replies;
+    Replies unbounded_replies;
+    service::ServerOptions options;
+    options.ai = TackleAi;
+    options.max_batch = 1;
+    service::BattleServer unbounded(options, Replies::Collect, &unbounded_replies);
+    options.max_resident_sessions = 2;
+    service::BattleServer bounded(options, Replies::Collect, &bounded_replies);
+
+    for (uint64_t id = 0; id < 6; id++) {
+        state::Pokemon player = CreatePokemonWithStats(60 + id * 9, 50, 40, 200);
+        state::Pokemon enemy = CreatePokemonWithStats(70, 45 + id * 3, 50, 190);
+        bounded.OpenSession(id, player, enemy);
+        unbounded.OpenSession(id, player, enemy);
+    }
+    bounded.Drain();
+    EXPECT_EQ(bounded.Stats().resident_sessions, 2u);
+    EXPECT_EQ(bounded.Stats().hibernated_sessions, 4u);
+
+    // Round-robin turns: every turn lands on a hibernated session
+    for (int turn = 0; turn < 3; turn++) {
+        for (uint64_t id = 0; id < 6; id++) {
+            bounded.SubmitTurn(id, PLAYER_GROWL);
+            unbounded.SubmitTurn(id, PLAYER_GROWL);
+            bounded.Drain();
+            unbounded.Drain();
+            EXPECT_LE(bounded.Stats().resident_sessions, 2u);
+        }
+    }
+
+    ASSERT_EQ(bounded_replies.results.size(), 18u);
+    ASSERT_EQ(unbounded_replies.results.size(), 18u);
+    for (size_t i = 0; i < 18; i++) {
+        EXPECT_EQ(bounded_replies.results[i].status, service::TurnStatus::Done);
+        EXPECT_EQ(bounded_replies.results[i].state_hash, unbounded_replies.results[i].state_hash)
+            << "reply " << i;
+    }
+
+    service::ServerStats stats = bounded.Stats();
+    EXPECT_EQ(stats.rehydrations, 18u);
+    EXPECT_EQ(stats.rehydrate_ns.Count(), 18u);
+    EXPECT_GT(stats.hibernated_bytes, 0u);
+    EXPECT_LT(stats.hibernated_bytes, 4 * MAX_ENCODED_STATE_SIZE);
+    EXPECT_EQ(unbounded.Stats().hibernations, 0u);
+}
+
+TEST(BattleServerTest, BatchStepsAllocateNothing) {
+    Replies replies;
+    replies.results.reserve(64);
+    service::ServerOptions options;
+    options.workers = 2;
+    options.ai = TackleAi;
+    options.track_allocations = true;
+    service::BattleServer server(options, Replies::Collect, &replies);
+
+    for (uint64_t id = 0; id < 8; id++) {
+        server.OpenSession(id, CreatePokemonWithStats(50, 50, 50, 200),
+                           CreatePokemonWithStats(50, 50, 50, 200));
+    }
+    for (int turn = 0; turn < 4; turn++) {
+        for (uint64_t id = 0; id < 8; id++) {
+            server.SubmitTurn(id, PLAYER_GROWL);
+        }
+    }
+    server.Drain();
+
+    service::ServerStats stats = server.Stats();
+    EXPECT_EQ(stats.completed, 32u);
+    EXPECT_EQ(stats.step_allocations, 0u);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file test/host/service/test_hibernation.cpp
+ * @brief Tests for packing idle battles
+ *
+ * This file tests:
+ * - A packed battle unpacks to the same state and keeps playing identically
+ * - Packing is smaller than the plain encoding
+ * - Malformed packed bytes are rejected
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "service/hibernation.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+TEST(HibernationTest, PackedBattleResumesIdentically) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(120, 60, 50, 100),
+                      CreatePokemonWithStats(110, 55, 45, 90));
+    BattleAction player{ActionType::MOVE, Player::PLAYER, 0, Move::LeechSeed};
+    BattleAction enemy{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    random::Initialize(7);
+    engine.ExecuteTurn(player, enemy);
+
+    std::vector<uint8_t> packed;
+    service::PackState(engine, &packed);
+    uint8_t encoded[MAX_ENCODED_STATE_SIZE];
+    EXPECT_LT(packed.size(), engine.EncodeState(encoded));
+
+    BattleEngine restored;
+    ASSERT_TRUE(service::UnpackState(packed, &restored));
+    EXPECT_EQ(restored.HashState(), engine.HashState());
+
+    player.move = Move::Tackle;
+    random::Initialize(8);
+    engine.ExecuteTurn(player, enemy);
+    random::Initialize(8);
+    restored.ExecuteTurn(player, enemy);
+    EXPECT_EQ(restored.HashState(), engine.HashState());
+}
+
+TEST(HibernationTest, MalformedPackingIsRejected) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 50), CreatePokemonWithStats(50, 50, 50));
+    uint64_t hash = engine.HashState();
+
+    std::vector<uint8_t> packed;
+    service::PackState(engine, &packed);
+    std::vector<uint8_t> truncated(packed.begin(), packed.end() - 2);
+    std::vector<uint8_t> bad_run = {0, 0};
+
+    EXPECT_FALSE(service::UnpackState(truncated, &engine));
+    EXPECT_FALSE(service::UnpackState(bad_run, &engine));
+    EXPECT_EQ(engine.HashState(), hash);
+}
@@ -0,0 +1,251 @@
+/**
+ * @file test/host/spectate/test_broadcast_ring.cpp
+ * @brief Tests for the battle event stream and the spectator broadcast ring
+ *
+ * This file tests:
+ * - The Engine emits turn, move, HP and faint events to a registered sink
+ * - Every reader sees every event in order, with its own cursor
+ * - Slow readers detect overruns and resync from the latest snapshot
+ * - Concurrent readers never see a torn or out-of-order event
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "spectate/broadcast_ring.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+BattleEvent MakeEvent(uint64_t sequence) {
+    BattleEvent event;
+    event.turn = static_cast<uint16_t>(sequence >> 32);
+    event.type = EventType::HpChanged;
+    event.battler = static_cast<uint8_t>(sequence & 1);
+    event.value = static_cast<uint16_t>(sequence);
+    event.extra = static_cast<uint16_t>(sequence >> 16);
+    return event;
+}
+
+uint64_t SequenceOf(const BattleEvent& event) {
+    return (static_cast<uint64_t>(event.turn) << 32) | (static_cast<uint64_t>(event.extra) << 16) |
+           event.value;
+}
+
+void Collect(void* user, const BattleEvent& event) {
+    static_cast<std::vector<BattleEvent>*>(user)->push_back(event);
+}
+
+}  // namespace
+
+TEST(EventStreamTest, EngineEmitsTurnEvents) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    std::vector<BattleEvent> events;
+    engine.SetEventSink(Collect, &events);
+
+    BattleAction tackle_p{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    BattleAction tackle_e{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle};
+    engine.ExecuteTurn(tackle_p, tackle_e);
+
+    ASSERT_GE(events.size(), 5u);
+    EXPECT_EQ(events[0].type, EventType::TurnStart);
+    EXPECT_EQ(events[0].value, 1);
+    EXPECT_EQ(events[1].type, EventType::MoveUsed);
+    EXPECT_EQ(events[1].battler, 0) << "Faster player moves first";
+    EXPECT_EQ(events[1].value, static_cast<uint16_t>(Move::Tackle));
+    EXPECT_EQ(events[2].type, EventType::HpChanged);
+    EXPECT_EQ(events[2].battler, 1);
+    EXPECT_EQ(events[2].value, engine.GetEnemy().current_hp);
+    EXPECT_EQ(events[3].type, EventType::MoveUsed);
+    EXPECT_EQ(events[3].battler, 1);
+    EXPECT_EQ(events[4].type, EventType::HpChanged);
+    EXPECT_EQ(events[4].battler, 0);
+    EXPECT_EQ(events.back().type, EventType::EndOfTurn);
+    for (const BattleEvent& event : events) {
+        EXPECT_EQ(event.turn, 1);
+    }
+}
+
+TEST(EventStreamTest, FaintIsReported) {
+    random::Initialize(42);
+    BattleEngine engine;
+    state::Pokemon weak = CreatePokemonWithStats(50, 50, 50);
+    weak.current_hp = 1;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), weak);
+    std::vector<BattleEvent> events;
+    engine.SetEventSink(Collect, &events);
+
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle});
+
+    ASSERT_EQ(events.size(), 4u) << "Battle ends before the enemy acts";
+    EXPECT_EQ(events[2].type, EventType::HpChanged);
+    EXPECT_EQ(events[2].value, 0);
+    EXPECT_EQ(events[2].extra, 1);
+    EXPECT_EQ(events[3].type, EventType::Fainted);
+    EXPECT_EQ(events[3].battler, 1);
+}
+
+TEST(EventStreamTest, NoSinkMeansNoEvents) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    std::vector<BattleEvent> events;
+    engine.SetEventSink(Collect, &events);
+    engine.SetEventSink(nullptr, nullptr);
+
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle});
+    EXPECT_TRUE(events.empty());
+}
+
+TEST(BroadcastRingTest, ReadersHaveIndependentCursors) {
+    spectate::BroadcastRing ring(4);
+    spectate::BroadcastReader fast(ring);
+    spectate::BroadcastReader slow(ring);
+
+    for (uint64_t i = 0; i < 10; i++) {
+        ring.Publish(MakeEvent(i));
+    }
+
+    BattleEvent event;
+    for (uint64_t i = 0; i < 10; i++) {
+        ASSERT_EQ(fast.Next(&event), spectate::ReadStatus::Ok);
+        EXPECT_EQ(SequenceOf(event), i);
+        EXPECT_EQ(fast.Cursor(), i + 1);
+    }
+    EXPECT_EQ(fast.Next(&event), spectate::ReadStatus::Empty);
+
+    ASSERT_EQ(slow.Next(&event), spectate::ReadStatus::Ok);
+    EXPECT_EQ(SequenceOf(event), 0u) << "Reading with one cursor does not consume for another";
+    EXPECT_EQ(slow.Cursor(), 1u);
+}
+
+TEST(BroadcastRingTest, LateReaderStartsAtHead) {
+    spectate::BroadcastRing ring(4);
+    ring.Publish(MakeEvent(0));
+    spectate::BroadcastReader reader(ring);
+
+    BattleEvent event;
+    EXPECT_EQ(reader.Next(&event), spectate::ReadStatus::Empty);
+    ring.Publish(MakeEvent(1));
+    ASSERT_EQ(reader.Next(&event), spectate::ReadStatus::Ok);
+    EXPECT_EQ(SequenceOf(event), 1u);
+}
+
+TEST(BroadcastRingTest, SlowReaderOverrunsAndResyncs) {
+    spectate::BroadcastRing ring(3);  // 8 slots
+    spectate::BroadcastReader reader(ring);
+
+    state::BattleState snapshot{};
+    snapshot.scheduler.turn = 7;
+    for (uint64_t i = 0; i < 20; i++) {
+        if (i == 15) {
+            ASSERT_TRUE(ring.PublishSnapshot(snapshot));
+        }
+        ring.Publish(MakeEvent(i));
+    }
+
+    BattleEvent event;
+    EXPECT_EQ(reader.Next(&event), spectate::ReadStatus::Overrun);
+    EXPECT_EQ(reader.Cursor(), 0u) << "An overrun does not move the cursor";
+
+    state::BattleState resynced{};
+    ASSERT_TRUE(reader.Resync(&resynced));
+    EXPECT_EQ(resynced.scheduler.turn, 7);
+    EXPECT_EQ(reader.Cursor(), 15u) << "Replay resumes at the first event after the snapshot";
+    for (uint64_t i = 15; i < 20; i++) {
+        ASSERT_EQ(reader.Next(&event), spectate::ReadStatus::Ok);
+        EXPECT_EQ(SequenceOf(event), i);
+    }
+    EXPECT_EQ(reader.Next(&event), spectate::ReadStatus::Empty);
+}
+
+TEST(BroadcastRingTest, ResyncWithoutSnapshotSkipsToHead) {
+    spectate::BroadcastRing ring(2);
+    spectate::BroadcastReader reader(ring);
+    for (uint64_t i = 0; i < 9; i++) {
+        ring.Publish(MakeEvent(i));
+    }
+
+    state::BattleState resynced{};
+    EXPECT_FALSE(reader.Resync(&resynced));
+    EXPECT_EQ(reader.Cursor(), 9u);
+}
+
+TEST(BroadcastRingTest, EngineFeedsRingThroughSink) {
+    random::Initialize(42);
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100), CreatePokemonWithStats(50, 50, 50));
+    spectate::BroadcastRing ring(6);
+    spectate::BroadcastReader reader(ring);
+    engine.SetEventSink(spectate::BroadcastRing::Sink, &ring);
+
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Tackle});
+
+    BattleEvent event;
+    ASSERT_EQ(reader.Next(&event), spectate::ReadStatus::Ok);
+    EXPECT_EQ(event.type, EventType::TurnStart);
+    EXPECT_EQ(ring.Head(), 6u) << "Turn start, two moves with their HP changes, end of turn";
+}
+
+TEST(BroadcastRingTest, ConcurrentReadersSeeOrderedWholeEvents) {
+    constexpr uint64_t EVENT_COUNT = 200000;
+    constexpr int READER_COUNT = 3;
+    spectate::BroadcastRing ring(6);
+
+    // Attach every reader before the producer starts
+    std::vector<spectate::BroadcastReader> readers;
+    for (int r = 0; r < READER_COUNT; r++) {
+        readers.emplace_back(ring);
+    }
+
+    std::vector<uint64_t> bad(READER_COUNT, 0);
+    std::vector<std::thread> threads;
+    for (int r = 0; r < READER_COUNT; r++) {
+        threads.emplace_back([&, r]() {
+            spectate::BroadcastReader& reader = readers[r];
+            state::BattleState snapshot;
+            BattleEvent event;
+            while (reader.Cursor() < EVENT_COUNT) {
+                uint64_t expected = reader.Cursor();
+                switch (reader.Next(&event)) {
+                    case spectate::ReadStatus::Ok:
+                        if (SequenceOf(event) != expected) {
+                            bad[r]++;
+                        }
+                        break;
+                    case spectate::ReadStatus::Overrun:
+                        reader.Resync(&snapshot);
+                        break;
+                    case spectate::ReadStatus::Empty:
+                        std::this_thread::yield();
+                        break;
+                }
+            }
+        });
+    }
+
+    for (uint64_t i = 0; i < EVENT_COUNT; i++) {
+        ring.Publish(MakeEvent(i));
+        if ((i & 255) == 0) {
+            std::this_thread::yield();  // Give readers a chance to interleave
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int r = 0; r < READER_COUNT; r++) {
+        EXPECT_EQ(bad[r], 0u) << "Reader " << r << " saw a torn or misordered event";
+        EXPECT_EQ(readers[r].Cursor(), EVENT_COUNT);
+    }
+}
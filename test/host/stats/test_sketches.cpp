@@ -0,0 +1,142 @@
+/**
+ * @file test/host/stats/test_sketches.cpp
+ * @brief Tests for the streaming quantile sketch and distinct counter
+ *
+ * This file tests:
+ * - Quantiles stay within the rank error bound on large streams
+ * - Merged per-shard sketches match a single sketch of the whole stream
+ * - Sketch memory stays bounded however long the stream is
+ * - Distinct counts ignore duplicates and merge as set unions
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+#include "stats/distinct_counter.hpp"
+#include "stats/quantile_sketch.hpp"
+
+namespace {
+
+/**
+ * @brief Deterministic permutation of [0, n) for n a power of two (odd multiplier)
+ */
+uint64_t Scatter(uint64_t i, uint64_t n) {
+    return (i * 0x9e3779b97f4a7c15ULL) & (n - 1);
+}
+
+}  // namespace
+
+// ============================================================================
+// Quantile Sketch Tests
+// ============================================================================
+
+TEST(QuantileSketchTest, EmptySketchReportsZero) {
+    stats::QuantileSketch sketch;
+    EXPECT_EQ(sketch.Count(), 0u);
+    EXPECT_EQ(sketch.Quantile(0.5), 0.0);
+}
+
+TEST(QuantileSketchTest, SmallStreamIsExact) {
+    stats::QuantileSketch sketch;
+    for (int v = 1; v <= 9; v++) {
+        sketch.Add(v);
+    }
+    EXPECT_EQ(sketch.Quantile(0.0), 1.0);
+    EXPECT_EQ(sketch.Quantile(0.5), 5.0);
+    EXPECT_EQ(sketch.Quantile(1.0), 9.0);
+}
+
+TEST(QuantileSketchTest, LargeStreamWithinRankError) {
+    const uint64_t n = 1 << 18;
+    stats::QuantileSketch sketch(200);
+    for (uint64_t i = 0; i < n; i++) {
+        sketch.Add(static_cast<double>(Scatter(i, n)));
+    }
+
+    EXPECT_EQ(sketch.Count(), n);
+    EXPECT_EQ(sketch.Min(), 0.0);
+    EXPECT_EQ(sketch.Max(), static_cast<double>(n - 1));
+    for (double q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+        double rank = sketch.Quantile(q) / static_cast<double>(n);
+        EXPECT_NEAR(rank, q, 0.02) << "q = " << q;
+    }
+}
+
+TEST(QuantileSketchTest, MemoryStaysBounded) {
+    stats::QuantileSketch sketch(200);
+    size_t peak = 0;
+    for (uint64_t i = 0; i < 2000000; i++) {
+        sketch.Add(static_cast<double>(i % 1000));
+        if (sketch.RetainedItems() > peak) {
+            peak = sketch.RetainedItems();
+        }
+    }
+    EXPECT_LT(peak, 1000u) << "O(k) items regardless of stream length";
+}
+
+TEST(QuantileSketchTest, MergedShardsMatchWholeStream) {
+    const uint64_t n = 1 << 16;
+    stats::QuantileSketch shards[4];
+    for (uint64_t i = 0; i < n; i++) {
+        shards[i % 4].Add(static_cast<double>(Scatter(i, n)));
+    }
+
+    stats::QuantileSketch merged;
+    for (const stats::QuantileSketch& shard : shards) {
+        merged.Merge(shard);
+    }
+
+    EXPECT_EQ(merged.Count(), n);
+    EXPECT_EQ(merged.Min(), 0.0);
+    EXPECT_EQ(merged.Max(), static_cast<double>(n - 1));
+    for (double q : {0.1, 0.5, 0.9}) {
+        EXPECT_NEAR(merged.Quantile(q) / static_cast<double>(n), q, 0.02) << "q = " << q;
+    }
+}
+
+// ============================================================================
+// Distinct Counter Tests
+// ============================================================================
+
+TEST(DistinctCounterTest, SmallCountsAreNearExact) {
+    stats::DistinctCounter counter;
+    EXPECT_EQ(counter.Estimate(), 0.0);
+    for (uint64_t i = 0; i < 10; i++) {
+        counter.Add(i);
+    }
+    EXPECT_NEAR(counter.Estimate(), 10.0, 0.5);
+}
+
+TEST(DistinctCounterTest, DuplicatesDoNotCount) {
+    stats::DistinctCounter counter;
+    for (int repeat = 0; repeat < 50; repeat++) {
+        for (uint64_t i = 0; i < 1000; i++) {
+            counter.Add(i);
+        }
+    }
+    EXPECT_NEAR(counter.Estimate(), 1000.0, 50.0);
+}
+
+TEST(DistinctCounterTest, LargeCountWithinStandardError) {
+    stats::DistinctCounter counter(12);
+    for (uint64_t i = 0; i < 200000; i++) {
+        counter.Add(i);
+    }
+    EXPECT_NEAR(counter.Estimate(), 200000.0, 200000.0 * 0.05);
+}
+
+TEST(DistinctCounterTest, MergeIsSetUnion) {
+    stats::DistinctCounter a;
+    stats::DistinctCounter b;
+    for (uint64_t i = 0; i < 30000; i++) {
+        a.Add(i);
+        b.Add(i + 20000);  // 10000 shared with a
+    }
+
+    ASSERT_TRUE(a.Merge(b));
+    EXPECT_NEAR(a.Estimate(), 50000.0, 50000.0 * 0.05);
+
+    stats::DistinctCounter coarse(8);
+    EXPECT_FALSE(a.Merge(coarse)) << "Precisions must match";
+}
@@ -22,12 +22,12 @@ class BurnDamageTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateCharmander();
-        defender = CreateBulbasaur();
+        block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 // ============================================================================
@@ -230,7 +230,7 @@ TEST_F(BurnDamageTest, AttackReduction_ReducesAttackBy50Percent) {
     domain::MoveData move = CreateTackle();
     move.power = 40;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Hit(ctx);
 
     // Expected damage with burn:
@@ -254,7 +254,7 @@ TEST_F(BurnDamageTest, AttackReduction_WithPositiveStatStages) {
     domain::MoveData move = CreateTackle();
     move.power = 40;
 
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &move);
+    battle::BattleContext ctx = CreateBattleContext(block, &move);
     battle::effects::Effect_Hit(ctx);
 
     // Expected calculation:
@@ -266,16 +266,16 @@ TEST_F(BurnDamageTest, AttackReduction_WithPositiveStatStages) {
     uint16_t damage_with_burn_and_boost = ctx.damage_dealt;
 
     // Compare to non-burned, non-boosted baseline
-    battle::state::Pokemon baseline_attacker = CreateCharmander();
+    battle::state::BattleState baseline = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+    battle::state::Pokemon& baseline_attacker = baseline.battlers[0];
     baseline_attacker.attack = 100;
     baseline_attacker.status1 = 0;                        // Not burned
     baseline_attacker.stat_stages[domain::STAT_ATK] = 0;  // No boost
 
-    battle::state::Pokemon baseline_defender = CreateBulbasaur();
+    battle::state::Pokemon& baseline_defender = baseline.battlers[1];
     baseline_defender.defense = 50;
 
-    battle::BattleContext baseline_ctx =
-        CreateBattleContext(&baseline_attacker, &baseline_defender, &move);
+    battle::BattleContext baseline_ctx = CreateBattleContext(baseline, &move);
     battle::effects::Effect_Hit(baseline_ctx);
 
     // Damage should be similar (burn cancels out the +2 boost)
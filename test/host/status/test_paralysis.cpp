@@ -31,12 +31,12 @@ class ParalysisTest : public ::testing::Test {
    protected:
     void SetUp() override {
         battle::random::Initialize(42);
-        attacker = CreateBulbasaur();
-        defender = CreatePikachu();
+        block = CreateBattleState(CreateBulbasaur(), CreatePikachu());
     }
 
-    battle::state::Pokemon attacker;
-    battle::state::Pokemon defender;
+    battle::state::BattleState block;
+    battle::state::Pokemon& attacker = block.battlers[0];
+    battle::state::Pokemon& defender = block.battlers[1];
 };
 
 // ============================================================================
@@ -46,7 +46,7 @@ class ParalysisTest : public ::testing::Test {
 TEST_F(ParalysisTest, Immunity_ElectricTypePure) {
     // Pure Electric type immune to Electric-type paralysis
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -57,7 +57,7 @@ TEST_F(ParalysisTest, Immunity_ElectricTypeDual) {
     // Electric/Flying type immune to Electric-type paralysis
     defender.type2 = domain::Type::Flying;
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -66,9 +66,10 @@ TEST_F(ParalysisTest, Immunity_ElectricTypeDual) {
 
 TEST_F(ParalysisTest, Immunity_NonElectricNotImmune) {
     // Fire type not immune to Electric-type paralysis
-    battle::state::Pokemon fire_defender = CreateCharmander();
+    battle::state::Pokemon& fire_defender = defender;
+    fire_defender = CreateCharmander();
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &fire_defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -79,7 +80,7 @@ TEST_F(ParalysisTest, Immunity_NonElectricNotImmune) {
 TEST_F(ParalysisTest, Immunity_OnlyElectricMovesBlocked) {
     // Electric type CAN be paralyzed by non-Electric moves (like Body Slam)
     domain::MoveData tackle = CreateTackle();  // Normal type move
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &defender, &tackle);
+    battle::BattleContext ctx = CreateBattleContext(block, &tackle);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -89,11 +90,12 @@ TEST_F(ParalysisTest, Immunity_OnlyElectricMovesBlocked) {
 
 TEST_F(ParalysisTest, Immunity_AlreadyStatused) {
     // Already burned Pokemon cannot be paralyzed
-    battle::state::Pokemon burned_defender = CreateCharmander();
+    battle::state::Pokemon& burned_defender = defender;
+    burned_defender = CreateCharmander();
     burned_defender.status1 = domain::Status1::BURN;
 
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &burned_defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -103,11 +105,12 @@ TEST_F(ParalysisTest, Immunity_AlreadyStatused) {
 
 TEST_F(ParalysisTest, Immunity_AlreadyParalyzed) {
     // Already paralyzed Pokemon cannot be re-paralyzed
-    battle::state::Pokemon paralyzed_defender = CreateCharmander();
+    battle::state::Pokemon& paralyzed_defender = defender;
+    paralyzed_defender = CreateCharmander();
     paralyzed_defender.status1 = domain::Status1::PARALYSIS;
 
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &paralyzed_defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -117,12 +120,13 @@ TEST_F(ParalysisTest, Immunity_AlreadyParalyzed) {
 
 TEST_F(ParalysisTest, Immunity_FaintedPokemon) {
     // Fainted Pokemon should not be affected by paralysis
-    battle::state::Pokemon fainted_defender = CreateCharmander();
+    battle::state::Pokemon& fainted_defender = defender;
+    fainted_defender = CreateCharmander();
     fainted_defender.current_hp = 0;
     fainted_defender.is_fainted = true;
 
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &fainted_defender, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -136,9 +140,10 @@ TEST_F(ParalysisTest, Immunity_FaintedPokemon) {
 
 TEST_F(ParalysisTest, Application_ThunderWaveAppliesParalysis) {
     // Thunder Wave should successfully paralyze non-Electric types
-    battle::state::Pokemon target = CreateCharmander();
+    battle::state::Pokemon& target = defender;
+    target = CreateCharmander();
     domain::MoveData thunder_wave = CreateThunderWave();
-    battle::BattleContext ctx = CreateBattleContext(&attacker, &target, &thunder_wave);
+    battle::BattleContext ctx = CreateBattleContext(block, &thunder_wave);
 
     battle::commands::TryApplyParalysis(ctx, 100);
 
@@ -156,9 +161,10 @@ TEST_F(ParalysisTest, Application_RespectsProbability) {
 
     for (int i = 0; i < trials; i++) {
         battle::random::Initialize(i);
-        battle::state::Pokemon target = CreateCharmander();
+        battle::state::Pokemon& target = defender;
+        target = CreateCharmander();
         domain::MoveData move = CreateTackle();
-        battle::BattleContext ctx = CreateBattleContext(&attacker, &target, &move);
+        battle::BattleContext ctx = CreateBattleContext(block, &move);
 
         // 50% chance
         battle::commands::TryApplyParalysis(ctx, 50);
@@ -179,9 +185,10 @@ TEST_F(ParalysisTest, Application_ZeroPercentNeverApplies) {
 
     for (int i = 0; i < trials; i++) {
         battle::random::Initialize(i);
-        battle::state::Pokemon target = CreateCharmander();
+        battle::state::Pokemon& target = defender;
+        target = CreateCharmander();
         domain::MoveData move = CreateTackle();
-        battle::BattleContext ctx = CreateBattleContext(&attacker, &target, &move);
+        battle::BattleContext ctx = CreateBattleContext(block, &move);
 
         battle::commands::TryApplyParalysis(ctx, 0);
 
@@ -195,9 +202,10 @@ TEST_F(ParalysisTest, Application_100PercentAlwaysApplies) {
 
     for (int i = 0; i < trials; i++) {
         battle::random::Initialize(i);
-        battle::state::Pokemon target = CreateCharmander();
+        battle::state::Pokemon& target = defender;
+        target = CreateCharmander();
         domain::MoveData move = CreateTackle();
-        battle::BattleContext ctx = CreateBattleContext(&attacker, &target, &move);
+        battle::BattleContext ctx = CreateBattleContext(block, &move);
 
         battle::commands::TryApplyParalysis(ctx, 100);
 
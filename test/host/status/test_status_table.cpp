@@ -0,0 +1,152 @@
+/**
+ * @file test/host/status/test_status_table.cpp
+ * @brief Primary status mechanics driven by the status1 table
+ *
+ * Tests for:
+ * - Table entries: action gate, status transition, residual damage
+ * - Sleep countdown (wakes up and acts the same turn, Gen III)
+ * - Freeze and thaw (1 in 5)
+ * - Poison (1/8 max HP) and toxic (counter/16 max HP, growing each turn)
+ */
+
+#include <gtest/gtest.h>
+
+#include "battle/status_tables.hpp"
+#include "domain/status.hpp"
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+const BattleAction PLAYER_GROWL = {ActionType::MOVE, Player::PLAYER, 0, Move::Growl};
+const BattleAction ENEMY_GROWL = {ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+
+}  // namespace
+
+// ============================================================================
+// Table entries
+// ============================================================================
+
+TEST(StatusTableTest, HealthyPokemonAlwaysActsWithoutDraw) {
+    const status::Entry& entry = status::Lookup(Status1::NONE);
+    EXPECT_EQ(entry.act_roll, 0);
+    EXPECT_EQ(entry.blocked_below, 0);
+    EXPECT_EQ(entry.residual_divisor, 0);
+}
+
+TEST(StatusTableTest, SleepCountsDown) {
+    const status::Entry& asleep = status::Lookup(3);
+    EXPECT_EQ(asleep.act_roll, 0);
+    EXPECT_EQ(asleep.blocked_below, 1) << "Blocked: the implied draw 0 is below 1";
+    EXPECT_EQ(asleep.status_if_blocked, 2);
+
+    const status::Entry& waking = status::Lookup(1);
+    EXPECT_EQ(waking.blocked_below, 0);
+    EXPECT_EQ(waking.status_if_acts, Status1::NONE);
+}
+
+TEST(StatusTableTest, ChanceGatesMatchChanceTables) {
+    const status::Entry& frozen = status::Lookup(Status1::FREEZE);
+    EXPECT_EQ(frozen.act_roll, 5);
+    EXPECT_EQ(frozen.blocked_below, 4);
+    EXPECT_EQ(frozen.status_if_acts, Status1::NONE);
+    EXPECT_EQ(frozen.status_if_blocked, Status1::FREEZE);
+
+    const status::Entry& paralyzed = status::Lookup(Status1::PARALYSIS);
+    EXPECT_EQ(paralyzed.act_roll, 4);
+    EXPECT_EQ(paralyzed.blocked_below, 1);
+    EXPECT_EQ(paralyzed.status_if_acts, Status1::PARALYSIS);
+}
+
+TEST(StatusTableTest, ResidualFractions) {
+    EXPECT_EQ(status::Lookup(Status1::BURN).residual_divisor, 8);
+    EXPECT_EQ(status::Lookup(Status1::POISON).residual_divisor, 8);
+    EXPECT_EQ(status::Lookup(Status1::TOXIC).residual_divisor, 16);
+    EXPECT_EQ(status::Lookup(Status1::TOXIC).toxic_step, 1);
+    EXPECT_EQ(status::Lookup(Status1::PARALYSIS).residual_divisor, 0);
+}
+
+// ============================================================================
+// Engine integration
+// ============================================================================
+
+TEST(StatusTableTest, SleepingPokemonWakesAndActsSameTurn) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 100, 100);
+    player.status1 = 2;  // Two turns of sleep
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 100));
+
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    EXPECT_EQ(engine.GetPlayer().status1, 1);
+    EXPECT_EQ(engine.GetEnemy().stat_stages[STAT_ATK], 0) << "Asleep: Growl not used";
+
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    EXPECT_EQ(engine.GetPlayer().status1, Status1::NONE);
+    EXPECT_EQ(engine.GetEnemy().stat_stages[STAT_ATK], -1) << "Woke up and used Growl";
+    EXPECT_TRUE(evaluation::Equal(engine.GetEvaluation(), engine.RecomputeEvaluation()));
+}
+
+TEST(StatusTableTest, FrozenPokemonThawsOnOneInFive) {
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 100, 100);
+    player.status1 = Status1::FREEZE;
+    BattleEngine engine;
+    engine.InitBattle(player, CreatePokemonWithStats(50, 50, 50, 100));
+    random::DrawRecord records[random::MAX_RECORDED_DRAWS];
+
+    const uint16_t stays[] = {3};
+    random::BeginForcedDraws(stays, 1);
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    random::EndForcedDraws(records);
+    EXPECT_EQ(records[0].bound, 5);
+    EXPECT_EQ(engine.GetPlayer().status1, Status1::FREEZE);
+    EXPECT_EQ(engine.GetEnemy().stat_stages[STAT_ATK], 0);
+
+    const uint16_t thaws[] = {4};
+    random::BeginForcedDraws(thaws, 1);
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    random::EndForcedDraws(records);
+    EXPECT_EQ(engine.GetPlayer().status1, Status1::NONE);
+    EXPECT_EQ(engine.GetEnemy().stat_stages[STAT_ATK], -1);
+    EXPECT_TRUE(evaluation::Equal(engine.GetEvaluation(), engine.RecomputeEvaluation()));
+}
+
+TEST(StatusTableTest, PoisonDealsEighthEachTurn) {
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 100);
+    enemy.status1 = Status1::POISON;
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 100), enemy);
+
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 88);
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 76);
+}
+
+TEST(StatusTableTest, ToxicDamageGrowsWithCounter) {
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 160);
+    enemy.status1 = Status1::TOXIC;
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 100), enemy);
+
+    uint16_t expected = 160;
+    for (uint8_t turn = 1; turn <= 4; turn++) {
+        engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+        expected -= 10 * turn;  // turn/16 of 160
+        EXPECT_EQ(engine.GetEnemy().current_hp, expected) << "turn " << int(turn);
+        EXPECT_EQ(engine.GetEnemy().toxic_counter, turn);
+    }
+}
+
+TEST(StatusTableTest, ToxicCounterStopsAtFifteen) {
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 999);
+    enemy.status1 = Status1::TOXIC;
+    enemy.toxic_counter = status::MAX_TOXIC_COUNTER;
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 100), enemy);
+
+    engine.ExecuteTurn(PLAYER_GROWL, ENEMY_GROWL);
+    EXPECT_EQ(engine.GetEnemy().toxic_counter, status::MAX_TOXIC_COUNTER);
+    EXPECT_EQ(engine.GetEnemy().current_hp, 999 - (999 / 16) * 15);
+}
@@ -0,0 +1,296 @@
+/**
+ * @file test/host/verify/test_shadow.cpp
+ * @brief Tests for shadow verification of fast stepping paths
+ *
+ * This file tests:
+ * - Sampling is stable per battle id and follows the configured rate
+ * - StepMany agrees with the reference Engine on every sampled turn
+ * - Sampled batches run through the fast path whole, in one call
+ * - Sampled battles consume the same RNG stream as unsampled ones
+ * - A faulty fast path is caught and its repro replays both results, including
+ *   a fault that only shows when battles are stepped grouped
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "verify/shadow.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+const Move MOVE_POOL[] = {Move::Tackle,    Move::Ember,     Move::ThunderWave, Move::Growl,
+                          Move::LeechSeed, Move::Sandstorm, Move::FuryAttack,  Move::Protect,
+                          Move::GigaDrain, Move::Hail,      Move::FutureSight, Move::SunnyDay};
+constexpr size_t MOVE_POOL_SIZE = sizeof(MOVE_POOL) / sizeof(MOVE_POOL[0]);
+
+std::vector<BattleEngine> CreateBattles(size_t n) {
+    std::vector<BattleEngine> engines(n);
+    for (size_t i = 0; i < n; i++) {
+        state::Pokemon player = CreatePokemonWithStats(40 + i * 7 % 60, 50, 30 + i * 13 % 70, 200);
+        state::Pokemon enemy = CreatePokemonWithStats(45 + i * 11 % 50, 55, 35 + i * 5 % 60, 190);
+        engines[i].InitBattle(player, enemy);
+    }
+    return engines;
+}
+
+std::vector<BattleAction> CreateActions(size_t n, uint8_t turn) {
+    std::vector<BattleAction> actions(2 * n);
+    for (size_t i = 0; i < n; i++) {
+        actions[2 * i] = {ActionType::MOVE, Player::PLAYER, 0,
+                          MOVE_POOL[(i * 3 + turn) % MOVE_POOL_SIZE]};
+        actions[2 * i + 1] = {ActionType::MOVE, Player::ENEMY, 0,
+                              MOVE_POOL[(i * 5 + turn * 7) % MOVE_POOL_SIZE]};
+    }
+    return actions;
+}
+
+/**
+ * @brief Faulty fast path: the enemy's Tackle silently becomes Growl
+ */
+void FaultyStep(BattleEngine* engines, const BattleAction* actions, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        BattleAction enemy = actions[2 * i + 1];
+        if (enemy.move == Move::Tackle) {
+            enemy.move = Move::Growl;
+        }
+        if (!engines[i].IsBattleOver()) {
+            engines[i].ExecuteTurn(actions[2 * i], enemy);
+        }
+    }
+}
+
+/**
+ * @brief Faulty grouped path: past the first StepMany group, the enemy always uses Growl
+ */
+void GroupFaultyStep(BattleEngine* engines, const BattleAction* actions, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        BattleAction enemy = actions[2 * i + 1];
+        if (i >= 8) {
+            enemy.move = Move::Growl;
+        }
+        if (!engines[i].IsBattleOver()) {
+            engines[i].ExecuteTurn(actions[2 * i], enemy);
+        }
+    }
+}
+
+size_t g_fast_battles = 0;
+size_t g_fast_calls = 0;
+
+void CountingStep(BattleEngine* engines, const BattleAction* actions, size_t n) {
+    g_fast_battles += n;
+    g_fast_calls++;
+    BattleEngine::StepMany(engines, actions, n);
+}
+
+}  // namespace
+
+TEST(ShadowVerifierTest, SamplingFollowsRate) {
+    verify::ShadowOptions options;
+    options.sample_one_in = 0;
+    verify::ShadowVerifier off(BattleEngine::StepMany, options);
+    options.sample_one_in = 1;
+    verify::ShadowVerifier all(BattleEngine::StepMany, options);
+    options.sample_one_in = 8;
+    verify::ShadowVerifier some(BattleEngine::StepMany, options);
+
+    int sampled = 0;
+    for (uint64_t id = 0; id < 8000; id++) {
+        EXPECT_FALSE(off.IsSampled(id));
+        EXPECT_TRUE(all.IsSampled(id));
+        EXPECT_EQ(some.IsSampled(id), some.IsSampled(id)) << "Sampling is stable per id";
+        sampled += some.IsSampled(id) ? 1 : 0;
+    }
+    EXPECT_GT(sampled, 800);
+    EXPECT_LT(sampled, 1200);
+}
+
+TEST(ShadowVerifierTest, StepManyAgreesWithReference) {
+    random::Initialize(2024);
+    const size_t n = 37;
+    std::vector<BattleEngine> engines = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = 1000 + i;
+    }
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 3;
+    verify::ShadowVerifier verifier(BattleEngine::StepMany, options);
+    for (uint8_t turn = 0; turn < 20; turn++) {
+        std::vector<BattleAction> actions = CreateActions(n, turn);
+        EXPECT_TRUE(verifier.StepMany(engines.data(), actions.data(), ids.data(), n));
+    }
+
+    EXPECT_FALSE(verifier.HasDivergence());
+    EXPECT_GT(verifier.Stats().turns_checked, 0u);
+    EXPECT_LT(verifier.Stats().turns_checked, verifier.Stats().turns_stepped);
+}
+
+TEST(ShadowVerifierTest, UnsampledBattlesRunOnlyTheFastPath) {
+    const size_t n = 20;
+    std::vector<BattleEngine> engines = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = i;
+    }
+    std::vector<BattleAction> actions = CreateActions(n, 0);
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 0;
+    verify::ShadowVerifier verifier(CountingStep, options);
+    g_fast_battles = 0;
+    verifier.StepMany(engines.data(), actions.data(), ids.data(), n);
+
+    EXPECT_EQ(g_fast_battles, n);
+    EXPECT_EQ(verifier.Stats().turns_checked, 0u);
+}
+
+TEST(ShadowVerifierTest, SampledBatchRunsWholeThroughFastPath) {
+    random::Initialize(11);
+    const size_t n = 37;
+    std::vector<BattleEngine> engines = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = i;
+    }
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 3;
+    verify::ShadowVerifier verifier(CountingStep, options);
+    g_fast_battles = 0;
+    g_fast_calls = 0;
+    for (uint8_t turn = 0; turn < 5; turn++) {
+        std::vector<BattleAction> actions = CreateActions(n, turn);
+        EXPECT_TRUE(verifier.StepMany(engines.data(), actions.data(), ids.data(), n));
+    }
+
+    EXPECT_EQ(g_fast_calls, 5u) << "One fast call per batch, sampled or not";
+    EXPECT_EQ(g_fast_battles, 5 * n);
+    EXPECT_GT(verifier.Stats().turns_checked, 0u);
+}
+
+TEST(ShadowVerifierTest, SamplingDoesNotPerturbBatchedRngStream) {
+    const size_t n = 29;
+    std::vector<BattleEngine> shadowed = CreateBattles(n);
+    std::vector<BattleEngine> plain = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = 300 + i;
+    }
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 2;
+    verify::ShadowVerifier verifier(BattleEngine::StepMany, options);
+    for (uint8_t turn = 0; turn < 12; turn++) {
+        std::vector<BattleAction> actions = CreateActions(n, turn);
+        random::Initialize(700 + turn);
+        EXPECT_TRUE(verifier.StepMany(shadowed.data(), actions.data(), ids.data(), n));
+        random::Initialize(700 + turn);
+        BattleEngine::StepMany(plain.data(), actions.data(), n);
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(shadowed[i].HashState(), plain[i].HashState())
+                << "turn " << int(turn) << " battle " << i;
+        }
+    }
+    EXPECT_GT(verifier.Stats().turns_checked, 0u);
+}
+
+TEST(ShadowVerifierTest, SamplingDoesNotPerturbRngStream) {
+    std::vector<BattleEngine> shadowed = CreateBattles(1);
+    std::vector<BattleEngine> plain = CreateBattles(1);
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 1;
+    verify::ShadowVerifier verifier(BattleEngine::StepMany, options);
+
+    for (uint8_t turn = 0; turn < 10; turn++) {
+        std::vector<BattleAction> actions = CreateActions(1, turn);
+        random::Initialize(500 + turn);
+        verifier.StepVerified(7, shadowed[0], actions[0], actions[1]);
+        random::Initialize(500 + turn);
+        BattleEngine::StepMany(plain.data(), actions.data(), 1);
+        ASSERT_EQ(shadowed[0].HashState(), plain[0].HashState()) << "turn " << int(turn);
+    }
+}
+
+TEST(ShadowVerifierTest, FaultyFastPathIsCaughtWithRepro) {
+    random::Initialize(99);
+    const size_t n = 16;
+    std::vector<BattleEngine> engines = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = i;
+    }
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 1;
+    options.repro_path = testing::TempDir() + "shadow_repro.bin";
+    verify::ShadowVerifier verifier(FaultyStep, options);
+
+    bool clean = true;
+    for (uint8_t turn = 0; turn < 10 && clean; turn++) {
+        std::vector<BattleAction> actions = CreateActions(n, turn);
+        clean = verifier.StepMany(engines.data(), actions.data(), ids.data(), n);
+    }
+    ASSERT_FALSE(clean);
+    ASSERT_TRUE(verifier.HasDivergence());
+
+    const verify::ShadowRepro& first = verifier.FirstDivergence();
+    EXPECT_EQ(first.enemy_action.move, Move::Tackle);
+    EXPECT_NE(first.fast_hash, first.reference_hash);
+
+    verify::ShadowRepro loaded;
+    ASSERT_TRUE(verify::ReadRepro(options.repro_path, &loaded));
+    EXPECT_EQ(loaded.battle_id, first.battle_id);
+    EXPECT_EQ(verify::ReplayRepro(loaded, verify::ReferenceStep), first.reference_hash);
+    EXPECT_EQ(verify::ReplayRepro(loaded, FaultyStep), first.fast_hash);
+}
+
+TEST(ShadowVerifierTest, GroupedOnlyFaultIsCaught) {
+    random::Initialize(31);
+    const size_t n = 16;
+    std::vector<BattleEngine> engines = CreateBattles(n);
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = i;
+    }
+
+    // Stepped alone, every battle is index 0 of its batch and the fault never shows
+    verify::ShadowOptions options;
+    options.sample_one_in = 1;
+    verify::ShadowVerifier alone(GroupFaultyStep, options);
+    std::vector<BattleEngine> copies = engines;
+    std::vector<BattleAction> actions = CreateActions(n, 0);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_TRUE(alone.StepVerified(ids[i], copies[i], actions[2 * i], actions[2 * i + 1]));
+    }
+
+    verify::ShadowVerifier batched(GroupFaultyStep, options);
+    EXPECT_FALSE(batched.StepMany(engines.data(), actions.data(), ids.data(), n));
+    ASSERT_TRUE(batched.HasDivergence());
+    EXPECT_GE(batched.FirstDivergence().battle_id, 8u);
+    EXPECT_EQ(batched.Stats().turns_checked, n);
+}
+
+TEST(ShadowVerifierTest, FinishedBattlesAreSkipped) {
+    BattleEngine engine;
+    state::Pokemon fainted = CreatePokemonWithStats(50, 50, 50);
+    fainted.current_hp = 0;
+    fainted.is_fainted = true;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 50), fainted);
+    uint64_t hash = engine.HashState();
+
+    verify::ShadowOptions options;
+    options.sample_one_in = 1;
+    verify::ShadowVerifier verifier(BattleEngine::StepMany, options);
+    BattleAction tackle{ActionType::MOVE, Player::PLAYER, 0, Move::Tackle};
+    EXPECT_TRUE(verifier.StepVerified(0, engine, tackle, tackle));
+    EXPECT_EQ(engine.HashState(), hash);
+    EXPECT_EQ(verifier.Stats().turns_checked, 0u);
+}
@@ -0,0 +1,287 @@
+/**
+ * @file test/host/weather/test_rain_sun_hail.cpp
+ * @brief Tests for Rain, Sun and Hail and the weather modifier tables
+ *
+ * This file tests:
+ * - Damage modifier table (Rain/Sun boost and weaken Water/Fire, others neutral)
+ * - Residual immunity masks (Sandstorm: Rock/Ground/Steel, Hail: Ice)
+ * - Rain Dance, Sunny Day and Hail set their weather for 5 turns
+ * - Weather moves fail without refreshing the duration if their weather is active
+ * - Weather-modified damage in CalculateDamage
+ * - Hail end-of-turn damage and Ice immunity
+ * - Solar Beam: no charge in sun, halved power in other weather
+ */
+
+#include <gtest/gtest.h>
+
+#include "test_common.hpp"
+
+using namespace battle;
+using namespace domain;
+
+namespace {
+
+uint16_t DamageUnder(Weather weather, Type move_type) {
+    state::BattleState block = CreateBattleState(CreatePokemonWithStats(80, 50, 60, 200),
+                                                 CreatePokemonWithStats(60, 50, 50, 200));
+    block.field = state::Field{weather, 5};
+    MoveData move{Move::Tackle, move_type, 80, 100, 10, 0, 0};
+
+    BattleContext ctx = CreateBattleContext(block, &move);
+    commands::CalculateDamage(ctx);
+    return ctx.damage_dealt;
+}
+
+}  // namespace
+
+// ============================================================================
+// Table Tests
+// ============================================================================
+
+TEST(WeatherTableTest, DamageModifiers) {
+    EXPECT_EQ(weather::DamageModifier(Weather::Rain, Type::Water), 15);
+    EXPECT_EQ(weather::DamageModifier(Weather::Rain, Type::Fire), 5);
+    EXPECT_EQ(weather::DamageModifier(Weather::Sun, Type::Fire), 15);
+    EXPECT_EQ(weather::DamageModifier(Weather::Sun, Type::Water), 5);
+
+    for (uint8_t t = 0; t < NUM_TYPES; t++) {
+        Type type = static_cast<Type>(t);
+        EXPECT_EQ(weather::DamageModifier(Weather::None, type), weather::MODIFIER_NEUTRAL);
+        EXPECT_EQ(weather::DamageModifier(Weather::Sandstorm, type), weather::MODIFIER_NEUTRAL);
+        EXPECT_EQ(weather::DamageModifier(Weather::Hail, type), weather::MODIFIER_NEUTRAL);
+        if (type != Type::Water && type != Type::Fire) {
+            EXPECT_EQ(weather::DamageModifier(Weather::Rain, type), weather::MODIFIER_NEUTRAL);
+            EXPECT_EQ(weather::DamageModifier(Weather::Sun, type), weather::MODIFIER_NEUTRAL);
+        }
+    }
+    EXPECT_EQ(weather::DamageModifier(Weather::Rain, Type::None), weather::MODIFIER_NEUTRAL);
+}
+
+TEST(WeatherTableTest, ResidualImmunityMasks) {
+    state::Pokemon normal = CreatePokemonWithStats(50, 50, 50);
+    state::Pokemon ice = normal;
+    ice.type1 = Type::Ice;
+    state::Pokemon water_ice = normal;
+    water_ice.type1 = Type::Water;
+    water_ice.type2 = Type::Ice;
+
+    EXPECT_TRUE(weather::TakesResidualDamage(Weather::Hail, normal));
+    EXPECT_FALSE(weather::TakesResidualDamage(Weather::Hail, ice));
+    EXPECT_FALSE(weather::TakesResidualDamage(Weather::Hail, water_ice)) << "Either slot counts";
+    EXPECT_TRUE(weather::TakesResidualDamage(Weather::Sandstorm, ice));
+
+    EXPECT_FALSE(weather::TakesResidualDamage(Weather::Sandstorm, CreateGeodude()));
+    EXPECT_FALSE(weather::TakesResidualDamage(Weather::Sandstorm, CreateSandshrew()));
+    EXPECT_FALSE(weather::TakesResidualDamage(Weather::Sandstorm, CreateSkarmory()));
+    EXPECT_TRUE(weather::TakesResidualDamage(Weather::Hail, CreateGeodude()));
+
+    for (Weather weather : {Weather::None, Weather::Rain, Weather::Sun}) {
+        EXPECT_FALSE(weather::TakesResidualDamage(weather, normal));
+    }
+}
+
+// ============================================================================
+// Damage Modifier Tests
+// ============================================================================
+
+TEST(WeatherDamageTest, RainBoostsWaterAndWeakensFire) {
+    uint16_t water = DamageUnder(Weather::None, Type::Water);
+    uint16_t fire = DamageUnder(Weather::None, Type::Fire);
+
+    // Base damage (before +2): 22 * 80 * 80 / 50 / 50 = 56
+    EXPECT_EQ(water, 58);
+    EXPECT_EQ(DamageUnder(Weather::Rain, Type::Water), 56 * 15 / 10 + 2);
+    EXPECT_EQ(DamageUnder(Weather::Rain, Type::Fire), 56 * 5 / 10 + 2);
+    EXPECT_EQ(DamageUnder(Weather::Rain, Type::Normal), water);
+    EXPECT_EQ(fire, water);
+}
+
+TEST(WeatherDamageTest, SunBoostsFireAndWeakensWater) {
+    EXPECT_EQ(DamageUnder(Weather::Sun, Type::Fire), 56 * 15 / 10 + 2);
+    EXPECT_EQ(DamageUnder(Weather::Sun, Type::Water), 56 * 5 / 10 + 2);
+    EXPECT_EQ(DamageUnder(Weather::Sun, Type::Grass), 58);
+}
+
+TEST(WeatherDamageTest, SandstormAndHailDoNotModifyDamage) {
+    EXPECT_EQ(DamageUnder(Weather::Sandstorm, Type::Fire), 58);
+    EXPECT_EQ(DamageUnder(Weather::Hail, Type::Water), 58);
+}
+
+// ============================================================================
+// Weather Move Tests
+// ============================================================================
+
+TEST(WeatherMoveTest, MovesSetWeatherForFiveTurns) {
+    struct Case {
+        void (*effect)(BattleContext&);
+        Weather expected;
+    };
+    const Case cases[] = {
+        {effects::Effect_RainDance, Weather::Rain},
+        {effects::Effect_SunnyDay, Weather::Sun},
+        {effects::Effect_Hail, Weather::Hail},
+    };
+
+    for (const Case& c : cases) {
+        state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+        block.field = state::Field{Weather::Sandstorm, 2};
+        BattleContext ctx = CreateBattleContext(block);
+
+        c.effect(ctx);
+        EXPECT_EQ(block.field.weather, c.expected) << "Weather replaces the previous one";
+        EXPECT_EQ(block.field.weather_duration, 5);
+    }
+}
+
+TEST(WeatherMoveTest, FailsIfWeatherAlreadyActive) {
+    struct Case {
+        void (*effect)(BattleContext&);
+        Weather weather;
+    };
+    const Case cases[] = {
+        {effects::Effect_RainDance, Weather::Rain},
+        {effects::Effect_SunnyDay, Weather::Sun},
+        {effects::Effect_Hail, Weather::Hail},
+        {effects::Effect_Sandstorm, Weather::Sandstorm},
+    };
+
+    for (const Case& c : cases) {
+        state::BattleState block = CreateBattleState(CreateCharmander(), CreateBulbasaur());
+        block.field = state::Field{c.weather, 2};
+        BattleContext ctx = CreateBattleContext(block);
+
+        c.effect(ctx);
+        EXPECT_TRUE(ctx.move_failed);
+        EXPECT_EQ(block.field.weather, c.weather);
+        EXPECT_EQ(block.field.weather_duration, 2) << "The duration is not refreshed";
+    }
+}
+
+TEST(WeatherMoveTest, EngineRepeatedRainDanceDoesNotExtendRain) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 160),
+                      CreatePokemonWithStats(50, 50, 50, 160));
+
+    BattleAction rain_dance{ActionType::MOVE, Player::PLAYER, 0, Move::RainDance};
+    BattleAction enemy_growl{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    engine.ExecuteTurn(rain_dance, enemy_growl);
+    uint8_t remaining = engine.GetState().field.weather_duration;
+    engine.ExecuteTurn(rain_dance, enemy_growl);
+
+    EXPECT_EQ(engine.GetState().field.weather, Weather::Rain);
+    EXPECT_EQ(engine.GetState().field.weather_duration, remaining - 1)
+        << "Second Rain Dance fails; the rain keeps counting down";
+}
+
+TEST(WeatherMoveTest, EngineRainBoostsEmberLess) {
+    // Ember under rain deals less than under sun (engine path, move database types)
+    auto run = [](Move weather_move) {
+        random::Initialize(1);
+        BattleEngine engine;
+        state::Pokemon player = CreatePokemonWithStats(50, 50, 100, 200);
+        state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 200);
+        engine.InitBattle(player, enemy);
+        engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, weather_move},
+                           BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Growl});
+        uint16_t before = engine.GetEnemy().current_hp;
+        engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Ember},
+                           BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Growl});
+        return static_cast<uint16_t>(before - engine.GetEnemy().current_hp);
+    };
+
+    uint16_t rain = run(Move::RainDance);
+    uint16_t sun = run(Move::SunnyDay);
+    EXPECT_GT(sun, rain);
+}
+
+// ============================================================================
+// Hail End-of-Turn Tests
+// ============================================================================
+
+TEST(HailTest, DamagesNonIceTypes) {
+    BattleEngine engine;
+    state::Pokemon player = CreatePokemonWithStats(50, 50, 100, 160);
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 160);
+    enemy.type1 = Type::Ice;
+    engine.InitBattle(player, enemy);
+
+    BattleAction hail{ActionType::MOVE, Player::PLAYER, 0, Move::Hail};
+    BattleAction protect{ActionType::MOVE, Player::ENEMY, 0, Move::Protect};
+    engine.ExecuteTurn(hail, protect);
+
+    EXPECT_EQ(engine.GetPlayer().current_hp, 150) << "160 / 16 = 10 hail damage";
+    EXPECT_EQ(engine.GetEnemy().current_hp, 160) << "Ice types are immune to hail";
+    EXPECT_EQ(engine.GetState().field.weather, Weather::Hail);
+}
+
+TEST(HailTest, ExpiresAfterFiveTurns) {
+    BattleEngine engine;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 160),
+                      CreatePokemonWithStats(50, 50, 50, 160));
+
+    BattleAction hail{ActionType::MOVE, Player::PLAYER, 0, Move::Hail};
+    BattleAction growl{ActionType::MOVE, Player::PLAYER, 0, Move::Growl};
+    BattleAction enemy_growl{ActionType::MOVE, Player::ENEMY, 0, Move::Growl};
+    engine.ExecuteTurn(hail, enemy_growl);
+    for (int turn = 2; turn <= 6; turn++) {
+        engine.ExecuteTurn(growl, enemy_growl);
+    }
+
+    EXPECT_EQ(engine.GetPlayer().current_hp, 110) << "Five turns of 10 damage, then none";
+    EXPECT_EQ(engine.GetState().field.weather, Weather::None);
+}
+
+TEST(HailTest, EvaluationCountsHailChip) {
+    BattleEngine engine;
+    state::Pokemon enemy = CreatePokemonWithStats(50, 50, 50, 160);
+    enemy.type1 = Type::Ice;
+    engine.InitBattle(CreatePokemonWithStats(50, 50, 100, 160), enemy);
+    engine.ExecuteTurn(BattleAction{ActionType::MOVE, Player::PLAYER, 0, Move::Hail},
+                       BattleAction{ActionType::MOVE, Player::ENEMY, 0, Move::Growl});
+
+    EXPECT_EQ(engine.GetEvaluation().hazards, 4) << "Only the player is pelted (player - enemy)";
+    EXPECT_TRUE(evaluation::Equal(engine.GetEvaluation(), engine.RecomputeEvaluation()));
+}
+
+// ============================================================================
+// Solar Beam Tests
+// ============================================================================
+
+TEST(SolarBeamWeatherTest, SunSkipsChargingTurn) {
+    state::BattleState block = CreateBattleState(CreateBulbasaur(), CreateCharmander());
+    state::Pokemon& attacker = block.battlers[0];
+    state::Pokemon& defender = block.battlers[1];
+    uint16_t original_hp = defender.current_hp;
+    block.field = state::Field{Weather::Sun, 5};
+    MoveData solar_beam = CreateSolarBeam();
+
+    BattleContext ctx = CreateBattleContext(block, &solar_beam);
+    effects::Effect_SolarBeam(ctx);
+
+    EXPECT_FALSE(attacker.is_charging) << "No charging turn in sun";
+    EXPECT_LT(defender.current_hp, original_hp) << "Attacks immediately";
+}
+
+TEST(SolarBeamWeatherTest, OtherWeatherHalvesPower) {
+    auto release_damage = [](Weather weather) {
+        state::BattleState block = CreateBattleState(CreatePokemonWithStats(80, 50, 60, 200),
+                                                     CreatePokemonWithStats(60, 50, 50, 200));
+        state::Pokemon& attacker = block.battlers[0];
+        attacker.is_charging = true;
+        attacker.charging_move = Move::SolarBeam;
+        block.field = state::Field{weather, 5};
+        MoveData solar_beam = CreateSolarBeam();
+
+        BattleContext ctx = CreateBattleContext(block, &solar_beam);
+        effects::Effect_SolarBeam(ctx);
+        return ctx.damage_dealt;
+    };
+
+    uint16_t clear = release_damage(Weather::None);
+    // 120 power: 22 * 120 * 80 / 50 / 50 = 84; 60 power: 42
+    EXPECT_EQ(clear, 86);
+    EXPECT_EQ(release_damage(Weather::Rain), 44);
+    EXPECT_EQ(release_damage(Weather::Sandstorm), 44);
+    EXPECT_EQ(release_damage(Weather::Hail), 44);
+    EXPECT_EQ(release_damage(Weather::Sun), clear);
+}